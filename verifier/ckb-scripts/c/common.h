@@ -35,6 +35,83 @@ Defines commonly used high level functions and constants.
 #define SINCE_VALUE_MASK 0x00ffffffffffffff
 #define SINCE_EPOCH_FRACTION_FLAG 0b00100000
 
+/* witness context */
+#define WITNESS_CONTEXT_SIZE 32768
+
+/* cell view */
+#define CELL_VIEW_HASH_SIZE 32
+#define CELL_VIEW_DATA_SIZE 16
+
+#define CELL_VIEW_LOCK_HASH 0x01
+#define CELL_VIEW_TYPE_HASH 0x02
+#define CELL_VIEW_CAPACITY 0x04
+#define CELL_VIEW_DATA 0x08
+
+/*
+ * The fields of a cell that scan loops care about. Only the fields requested
+ * in the mask are loaded, with exactly one syscall each. Data is loaded once,
+ * yielding both its first CELL_VIEW_DATA_SIZE bytes and its full length.
+ */
+typedef struct {
+  uint8_t lock_hash[CELL_VIEW_HASH_SIZE];
+  uint8_t type_hash[CELL_VIEW_HASH_SIZE];
+  int has_type;
+  uint64_t capacity;
+  uint8_t data[CELL_VIEW_DATA_SIZE];
+  uint64_t data_len;
+  int loaded;
+} CellView;
+
+/* Loads the fields in mask that are not loaded yet. Returns
+ CKB_INDEX_OUT_OF_BOUND when index is past the last cell of source. A missing
+ type script is not an error, it is reported through has_type. */
+int load_cell_view(CellView *view, size_t index, size_t source, int mask) {
+  int ret;
+  uint64_t len;
+  mask &= ~view->loaded;
+
+  if (mask & CELL_VIEW_LOCK_HASH) {
+    len = CELL_VIEW_HASH_SIZE;
+    ret = ckb_load_cell_by_field(view->lock_hash, &len, 0, index, source,
+                                 CKB_CELL_FIELD_LOCK_HASH);
+    if (ret != CKB_SUCCESS) {
+      return ret;
+    }
+  }
+  if (mask & CELL_VIEW_TYPE_HASH) {
+    len = CELL_VIEW_HASH_SIZE;
+    ret = ckb_load_cell_by_field(view->type_hash, &len, 0, index, source,
+                                 CKB_CELL_FIELD_TYPE_HASH);
+    if (ret != CKB_SUCCESS && ret != CKB_ITEM_MISSING) {
+      return ret;
+    }
+    view->has_type = ret == CKB_SUCCESS;
+  }
+  if (mask & CELL_VIEW_CAPACITY) {
+    len = sizeof(uint64_t);
+    ret = ckb_load_cell_by_field((uint8_t *)&view->capacity, &len, 0, index,
+                                 source, CKB_CELL_FIELD_CAPACITY);
+    if (ret != CKB_SUCCESS) {
+      return ret;
+    }
+  }
+  if (mask & CELL_VIEW_DATA) {
+    view->data_len = CELL_VIEW_DATA_SIZE;
+    ret = ckb_load_cell_data(view->data, &view->data_len, 0, index, source);
+    if (ret != CKB_SUCCESS) {
+      return ret;
+    }
+  }
+  view->loaded |= mask;
+  return CKB_SUCCESS;
+}
+
+/* Starts a fresh view of the cell at index and loads the fields in mask */
+int open_cell_view(CellView *view, size_t index, size_t source, int mask) {
+  view->loaded = 0;
+  return load_cell_view(view, index, source, mask);
+}
+
 /* calculate inputs length */
 int calculate_inputs_len() {
   uint64_t len = 0;
@@ -90,3 +167,60 @@ int extract_witness_lock(uint8_t *witness, uint64_t len,
   *lock_bytes_seg = MolReader_Bytes_raw_bytes(&lock_seg);
   return CKB_SUCCESS;
 }
+
+/*
+ * A witness loaded and parsed once, so that every check on the same witness
+ * shares one syscall, one WitnessArgs verification and one buffer. len is 0
+ * and lock is empty when the witness is missing or empty. input_type holds
+ * the raw bytes of the input_type field when has_input_type is set.
+ */
+typedef struct {
+  uint8_t witness[WITNESS_CONTEXT_SIZE];
+  uint64_t len;
+  mol_seg_t lock;
+  mol_seg_t input_type;
+  int has_input_type;
+} WitnessContext;
+
+/* Loads and parses the witness at index. A missing lock field is reported as
+ an empty lock, it is up to the caller to require a signature. */
+int load_witness_context(WitnessContext *ctx, size_t index, size_t source) {
+  ctx->len = WITNESS_CONTEXT_SIZE;
+  ctx->lock.ptr = ctx->witness;
+  ctx->lock.size = 0;
+  ctx->input_type.ptr = ctx->witness;
+  ctx->input_type.size = 0;
+  ctx->has_input_type = 0;
+
+  int ret = ckb_load_witness(ctx->witness, &ctx->len, 0, index, source);
+  if (ret == CKB_INDEX_OUT_OF_BOUND) {
+    ctx->len = 0;
+    return CKB_SUCCESS;
+  }
+  if (ret != CKB_SUCCESS) {
+    return ERROR_SYSCALL;
+  }
+  if (ctx->len > WITNESS_CONTEXT_SIZE) {
+    return ERROR_WITNESS_SIZE;
+  }
+  if (ctx->len == 0) {
+    return CKB_SUCCESS;
+  }
+
+  mol_seg_t witness_seg;
+  witness_seg.ptr = ctx->witness;
+  witness_seg.size = ctx->len;
+  if (MolReader_WitnessArgs_verify(&witness_seg, false) != MOL_OK) {
+    return ERROR_ENCODING;
+  }
+  mol_seg_t lock_seg = MolReader_WitnessArgs_get_lock(&witness_seg);
+  if (!MolReader_BytesOpt_is_none(&lock_seg)) {
+    ctx->lock = MolReader_Bytes_raw_bytes(&lock_seg);
+  }
+  mol_seg_t input_type_seg = MolReader_WitnessArgs_get_input_type(&witness_seg);
+  if (!MolReader_BytesOpt_is_none(&input_type_seg)) {
+    ctx->input_type = MolReader_Bytes_raw_bytes(&input_type_seg);
+    ctx->has_input_type = 1;
+  }
+  return CKB_SUCCESS;
+}
@@ -3,7 +3,7 @@
 
 
 #include "blockchain.h"
-#include "reuse_coin_payment_script.h"
+#include "reuse_coin_plugin.h"
 
 int main() {
   ckb_debug("I'm a reusable script! You have to pay my developer in order to use this!\n");
@@ -0,0 +1,268 @@
+// Type script for prepaid ReuseCoin usage credits.
+//
+// A dApp buys N uses of a reusable script up front by paying N * udt_rate into
+// the developer's cell wallet, and records them as a counter in a credit cell
+// guarded by this type script. Every later use only decrements the counter in
+// the dApp's own credit cell, which the payment script accepts as proof of
+// payment. Steady-state usage therefore never touches the developer's wallet.
+//
+// The wallet lock only checks that its balance grew by its own fees, so a
+// top-up deposit must not be counted twice: a top-up transaction may not use
+// any dep the wallet charges for, nor top up a second credit type paid into
+// the same wallet.
+#include "ckb_syscalls.h"
+#include "common.h"
+
+#include "blockchain.h"
+#include "reuse_coin_wallet_args.h"
+
+#define MAX_SCRIPT_SIZE 32768
+#define CREDIT_SIZE 8
+#define DATA_SIZE 16
+#define CREDIT_ARGS_LENGTH (BLAKE2B_BLOCK_SIZE + BALANCE_SIZE)
+// A credit type script serializes to the Script header, code hash, hash type
+// and args length, then its fixed size args
+#define CREDIT_ARGS_OFFSET (4 + 3 * 4 + BLAKE2B_BLOCK_SIZE + 1 + 4)
+#define CREDIT_SCRIPT_SIZE (CREDIT_ARGS_OFFSET + CREDIT_ARGS_LENGTH)
+
+#define ERROR_WALLET_QUANTITY -47
+#define ERROR_NO_INPUT_WALLET_FOUND -56
+#define ERROR_NO_OUTPUT_WALLET_FOUND -57
+#define ERROR_CREDIT_NOT_PAID -60
+#define ERROR_CREDIT_WALLET_DEPS -61
+#define ERROR_CREDIT_TYPE_QUANTITY -62
+
+int sum_credits(size_t source, uint64_t *total) {
+  int i = 0;
+  while (1) {
+    uint64_t credits;
+    uint64_t len = CREDIT_SIZE;
+    int ret = ckb_load_cell_data((uint8_t *)&credits, &len, 0, i, source);
+    if (ret == CKB_INDEX_OUT_OF_BOUND) {
+      break;
+    }
+    if (ret != CKB_SUCCESS) {
+      return ERROR_SYSCALL;
+    }
+    if (len != CREDIT_SIZE) {
+      ckb_debug("CREDIT CELL DATA MUST BE AN 8 BYTE COUNTER");
+      return ERROR_ENCODING;
+    }
+    if (*total + credits < *total) {
+      return ERROR_OVERFLOW;
+    }
+    *total += credits;
+    i++;
+  }
+  return CKB_SUCCESS;
+}
+
+// Loads the index and udt amount of the only cell with the wallet lock hash in
+// source
+int load_wallet_balance(size_t source, unsigned char *wallet_lock_hash, size_t *wallet_index,
+                        uint128_t *balance, int *wallet_count) {
+  int i = 0;
+  while (1) {
+    unsigned char lock_hash[BLAKE2B_BLOCK_SIZE];
+    uint64_t len = BLAKE2B_BLOCK_SIZE;
+    int ret = ckb_load_cell_by_field(lock_hash, &len, 0, i, source, CKB_CELL_FIELD_LOCK_HASH);
+    if (ret == CKB_INDEX_OUT_OF_BOUND) {
+      break;
+    }
+    if (ret != CKB_SUCCESS) {
+      return ERROR_SYSCALL;
+    }
+    if (hash32_eq(lock_hash, wallet_lock_hash)) {
+      *wallet_count += 1;
+      if (*wallet_count > 1) {
+        return ERROR_WALLET_QUANTITY;
+      }
+      *wallet_index = i;
+      uint64_t data_len = DATA_SIZE;
+      ret = ckb_load_cell_data((uint8_t *)balance, &data_len, 0, i, source);
+      if (ret != CKB_SUCCESS) {
+        return ERROR_SYSCALL;
+      }
+      if (data_len != DATA_SIZE) {
+        return ERROR_ENCODING;
+      }
+    }
+    i++;
+  }
+  return CKB_SUCCESS;
+}
+
+// Fails if the wallet input at wallet_index charges for any cell dep, which
+// it would pay for out of the top-up deposit
+int check_no_wallet_deps(size_t wallet_index, unsigned char *wallet_lock_hash) {
+  unsigned char lock[MAX_SHARD_SCRIPT_SIZE];
+  uint64_t len = MAX_SHARD_SCRIPT_SIZE;
+  int ret = ckb_load_cell_by_field(lock, &len, 0, wallet_index, CKB_SOURCE_INPUT,
+    CKB_CELL_FIELD_LOCK);
+  if (ret != CKB_SUCCESS) {
+    return ERROR_SYSCALL;
+  }
+  if (len > MAX_SHARD_SCRIPT_SIZE) {
+    return ERROR_ENCODING;
+  }
+
+  mol_seg_t lock_seg;
+  lock_seg.ptr = (uint8_t *)lock;
+  lock_seg.size = len;
+  if (MolReader_Script_verify(&lock_seg, false) != MOL_OK) {
+    return ERROR_ENCODING;
+  }
+  mol_seg_t args_seg = MolReader_Script_get_args(&lock_seg);
+  mol_seg_t raw_args = MolReader_Bytes_raw_bytes(&args_seg);
+  WalletArgs args;
+  ret = parse_wallet_args(&raw_args, &args);
+  if (ret != CKB_SUCCESS) {
+    return ret;
+  }
+  ReuseCoinShardFamily shard_family;
+  const ReuseCoinShardFamily *family = wallet_shard_family(&lock_seg, &args, &shard_family);
+
+  int i = 0;
+  while (1) {
+    int is_wallet;
+    ret = dep_is_wallet(i, family, wallet_lock_hash, &is_wallet);
+    if (ret == CKB_INDEX_OUT_OF_BOUND) {
+      break;
+    }
+    if (ret != CKB_SUCCESS) {
+      return ERROR_SYSCALL;
+    }
+    if (is_wallet) {
+      ckb_debug("CREDIT TOP UP CANNOT SHARE ITS DEPOSIT WITH WALLET DEPS");
+      return ERROR_CREDIT_WALLET_DEPS;
+    }
+    i++;
+  }
+  return CKB_SUCCESS;
+}
+
+// Fails if a cell in source has another credit type paid into the same
+// wallet, which would count the same deposit for its own top-up
+int check_single_credit_type(size_t source, mol_seg_t *script_seg) {
+  int i = 0;
+  while (1) {
+    unsigned char type[CREDIT_SCRIPT_SIZE];
+    uint64_t len = CREDIT_SCRIPT_SIZE;
+    int ret = ckb_load_cell_by_field(type, &len, 0, i, source, CKB_CELL_FIELD_TYPE);
+    if (ret == CKB_INDEX_OUT_OF_BOUND) {
+      break;
+    }
+    if (ret != CKB_SUCCESS && ret != CKB_ITEM_MISSING) {
+      return ERROR_SYSCALL;
+    }
+    // Same code, hash type and wallet, but another script: another price
+    if (ret == CKB_SUCCESS && len == script_seg->size &&
+        memcmp(type, script_seg->ptr, CREDIT_ARGS_OFFSET + BLAKE2B_BLOCK_SIZE) == 0 &&
+        memcmp(type, script_seg->ptr, len) != 0) {
+      ckb_debug("ONLY ONE CREDIT TYPE PER WALLET CAN BE TOPPED UP AT ONCE");
+      return ERROR_CREDIT_TYPE_QUANTITY;
+    }
+    i++;
+  }
+  return CKB_SUCCESS;
+}
+
+// Args:
+// 1. 32 byte lock hash of the cell wallet credits are paid into
+// 2. 16 byte udt price of a single credit
+//
+// Data:
+// 8 byte little endian count of remaining uses
+int main() {
+  ckb_debug("REUSE COIN CREDIT TYPE EXECUTING\n");
+
+  unsigned char script[MAX_SCRIPT_SIZE];
+  uint64_t script_len = MAX_SCRIPT_SIZE;
+  int ret = ckb_load_script(script, &script_len, 0);
+  if (ret != CKB_SUCCESS) {
+    return ERROR_SYSCALL;
+  }
+
+  mol_seg_t script_seg;
+  script_seg.ptr = (uint8_t *)script;
+  script_seg.size = script_len;
+
+  if (MolReader_Script_verify(&script_seg, false) != MOL_OK) {
+    ckb_debug("ERROR IN SCRIPT ENCODING OF CREDIT TYPE");
+    return ERROR_ENCODING;
+  }
+
+  mol_seg_t args_seg = MolReader_Script_get_args(&script_seg);
+  mol_seg_t raw_args = MolReader_Bytes_raw_bytes(&args_seg);
+  if (raw_args.size != CREDIT_ARGS_LENGTH) {
+    return ERROR_ARGUMENTS_LEN;
+  }
+  uint128_t credit_price;
+  memcpy(&credit_price, &raw_args.ptr[BLAKE2B_BLOCK_SIZE], BALANCE_SIZE);
+
+  uint64_t input_credits = 0;
+  uint64_t output_credits = 0;
+  ret = sum_credits(CKB_SOURCE_GROUP_INPUT, &input_credits);
+  if (ret != CKB_SUCCESS) {
+    return ret;
+  }
+  ret = sum_credits(CKB_SOURCE_GROUP_OUTPUT, &output_credits);
+  if (ret != CKB_SUCCESS) {
+    return ret;
+  }
+
+  // Spending credits is authorized by the credit cell's own lock
+  if (output_credits <= input_credits) {
+    return CKB_SUCCESS;
+  }
+
+  // Top up: the new credits must be paid into the wallet in this transaction
+  uint64_t bought = output_credits - input_credits;
+  uint128_t input_balance = 0;
+  uint128_t output_balance = 0;
+  int input_wallet_count = 0;
+  int output_wallet_count = 0;
+  size_t input_wallet_index = 0;
+  size_t output_wallet_index = 0;
+
+  ret = load_wallet_balance(CKB_SOURCE_INPUT, raw_args.ptr, &input_wallet_index, &input_balance,
+    &input_wallet_count);
+  if (ret != CKB_SUCCESS) {
+    return ret;
+  }
+  if (input_wallet_count < 1) {
+    return ERROR_NO_INPUT_WALLET_FOUND;
+  }
+  ret = load_wallet_balance(CKB_SOURCE_OUTPUT, raw_args.ptr, &output_wallet_index, &output_balance,
+    &output_wallet_count);
+  if (ret != CKB_SUCCESS) {
+    return ret;
+  }
+  if (output_wallet_count < 1) {
+    return ERROR_NO_OUTPUT_WALLET_FOUND;
+  }
+
+  // The deposit pays for this top-up alone
+  ret = check_no_wallet_deps(input_wallet_index, raw_args.ptr);
+  if (ret != CKB_SUCCESS) {
+    return ret;
+  }
+  ret = check_single_credit_type(CKB_SOURCE_INPUT, &script_seg);
+  if (ret != CKB_SUCCESS) {
+    return ret;
+  }
+  ret = check_single_credit_type(CKB_SOURCE_OUTPUT, &script_seg);
+  if (ret != CKB_SUCCESS) {
+    return ret;
+  }
+
+  uint128_t cost = credit_price * bought;
+  if (bought != 0 && cost / bought != credit_price) {
+    return ERROR_OVERFLOW;
+  }
+  if (output_balance < input_balance || output_balance - input_balance < cost) {
+    ckb_debug("CREDIT TOP UP NOT PAID INTO WALLET");
+    return ERROR_CREDIT_NOT_PAID;
+  }
+  return CKB_SUCCESS;
+}
@@ -0,0 +1,130 @@
+#ifndef REUSE_COIN_HINTS_H_
+#define REUSE_COIN_HINTS_H_
+
+// Optional cell index hints for the payment script and the cell wallet lock.
+//
+// A transaction may put a ReuseCoinHints table in the input_type field of the
+// first witness of a script group. The scripts then only look at the hinted
+// cells instead of scanning every input, output and cell dep:
+//
+//   wallet_input:  index of the wallet cell in inputs
+//   wallet_output: index of the wallet cell in outputs
+//   deps:          for the wallet, the cell deps it charges for, in strictly
+//                  ascending order. For the payment script, the cell dep that
+//                  holds the script's own code.
+//
+// The deps charged by the wallet are only trusted because every payment script
+// that runs in the transaction, in any payment mode, proves that its own code
+// dep is in the wallet's list. That list is read from the witness of the
+// wallet group's first input, the one the wallet lock reads, which need not be
+// the hinted wallet_input when a settlement wallet spans several cells.
+// Scripts fall back to full scans when hints are absent.
+#include "blockchain.h"
+#include "ckb_syscalls.h"
+
+#define HINTS_INDEX_SIZE 4
+#define MAX_HINTS_WITNESS_SIZE 32768
+
+#define ERROR_HINTS_ENCODING -70
+#define ERROR_HINTS_MISMATCH -71
+
+typedef struct {
+  int present;
+  uint32_t wallet_input;
+  uint32_t wallet_output;
+  mol_seg_t deps;
+} ReuseCoinHints;
+
+// Parses hints from the raw bytes of an already verified input_type field,
+// or reports no hints when hints_seg is NULL. The deps segment points into
+// the same buffer as hints_seg.
+int reuse_coin_parse_hints_seg(mol_seg_t *hints_seg, ReuseCoinHints *hints) {
+  hints->present = 0;
+  if (hints_seg == NULL) {
+    return CKB_SUCCESS;
+  }
+  if (MolReader_ReuseCoinHints_verify(hints_seg, false) != MOL_OK) {
+    return ERROR_HINTS_ENCODING;
+  }
+
+  mol_seg_t wallet_input_seg = MolReader_ReuseCoinHints_get_wallet_input(hints_seg);
+  mol_seg_t wallet_output_seg = MolReader_ReuseCoinHints_get_wallet_output(hints_seg);
+  hints->wallet_input = mol_unpack_number(wallet_input_seg.ptr);
+  hints->wallet_output = mol_unpack_number(wallet_output_seg.ptr);
+  hints->deps = MolReader_ReuseCoinHints_get_deps(hints_seg);
+  hints->present = 1;
+  return CKB_SUCCESS;
+}
+
+// Parses hints from a loaded witness. The deps segment points into witness,
+// which must outlive hints.
+int reuse_coin_parse_hints(uint8_t *witness, uint64_t witness_len,
+                           ReuseCoinHints *hints) {
+  hints->present = 0;
+  if (witness_len == 0) {
+    return CKB_SUCCESS;
+  }
+
+  mol_seg_t witness_seg;
+  witness_seg.ptr = witness;
+  witness_seg.size = witness_len;
+  if (MolReader_WitnessArgs_verify(&witness_seg, false) != MOL_OK) {
+    return ERROR_HINTS_ENCODING;
+  }
+  mol_seg_t input_type_seg = MolReader_WitnessArgs_get_input_type(&witness_seg);
+  if (MolReader_BytesOpt_is_none(&input_type_seg)) {
+    return CKB_SUCCESS;
+  }
+  mol_seg_t hints_seg = MolReader_Bytes_raw_bytes(&input_type_seg);
+  return reuse_coin_parse_hints_seg(&hints_seg, hints);
+}
+
+// Loads hints from the witness at index/source. The deps segment points into
+// witness, which must hold MAX_HINTS_WITNESS_SIZE bytes and outlive hints.
+int reuse_coin_load_hints(uint8_t *witness, size_t index, size_t source,
+                          ReuseCoinHints *hints) {
+  hints->present = 0;
+
+  uint64_t witness_len = MAX_HINTS_WITNESS_SIZE;
+  int ret = ckb_load_witness(witness, &witness_len, 0, index, source);
+  if (ret == CKB_INDEX_OUT_OF_BOUND) {
+    return CKB_SUCCESS;
+  }
+  if (ret != CKB_SUCCESS) {
+    return ret;
+  }
+  if (witness_len > MAX_HINTS_WITNESS_SIZE) {
+    return ERROR_HINTS_ENCODING;
+  }
+  return reuse_coin_parse_hints(witness, witness_len, hints);
+}
+
+mol_num_t reuse_coin_hint_dep_count(ReuseCoinHints *hints) {
+  return MolReader_Uint32Vec_length(&hints->deps);
+}
+
+uint32_t reuse_coin_hint_dep(ReuseCoinHints *hints, mol_num_t i) {
+  mol_seg_res_t dep = MolReader_Uint32Vec_get(&hints->deps, i);
+  return mol_unpack_number(dep.seg.ptr);
+}
+
+// Binary search over the strictly ascending deps of the wallet's hints
+int reuse_coin_hints_charge_dep(ReuseCoinHints *hints, uint32_t dep_index) {
+  mol_num_t lo = 0;
+  mol_num_t hi = reuse_coin_hint_dep_count(hints);
+  while (lo < hi) {
+    mol_num_t mid = lo + (hi - lo) / 2;
+    uint32_t current = reuse_coin_hint_dep(hints, mid);
+    if (current == dep_index) {
+      return 1;
+    }
+    if (current < dep_index) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return 0;
+}
+
+#endif /* REUSE_COIN_HINTS_H_ */
@@ -0,0 +1,176 @@
+#ifndef REUSE_COIN_LEDGER_H_
+#define REUSE_COIN_LEDGER_H_
+
+// Per wallet ledger for settling several cell wallets in one transaction.
+//
+// The ledger is seeded with the lock hashes of the wallets being settled and
+// is then filled in a single pass over the inputs and a single pass over the
+// outputs. Every cell whose lock hash is in the ledger adds its udt amount
+// and capacity to that wallet's entry, so the cost of a pass does not grow
+// with the number of wallets beyond a binary search per cell.
+//
+// Cells are read through the CellView of common.h, which has no include
+// guard, so it must be included before this file.
+#include "blockchain.h"
+#include "ckb_syscalls.h"
+
+#define LEDGER_HASH_SIZE 32
+#define LEDGER_AMOUNT_SIZE 16
+#define MAX_LEDGER_WALLETS 64
+
+#define ERROR_LEDGER_WALLETS -72
+#define ERROR_LEDGER_ENCODING -73
+#define ERROR_LEDGER_OVERFLOW -74
+
+typedef struct {
+  uint8_t lock_hash[LEDGER_HASH_SIZE];
+  uint8_t token_type[LEDGER_HASH_SIZE];
+  unsigned __int128 udt_in;
+  unsigned __int128 udt_out;
+  // Fee the wallet must be credited with, filled in by the caller
+  unsigned __int128 udt_due;
+  uint64_t capacity_in;
+  uint64_t capacity_out;
+  uint32_t inputs;
+  uint32_t outputs;
+} ReuseCoinLedgerEntry;
+
+typedef struct {
+  ReuseCoinLedgerEntry entries[MAX_LEDGER_WALLETS];
+  size_t count;
+} ReuseCoinLedger;
+
+void reuse_coin_ledger_init(ReuseCoinLedger *ledger) { ledger->count = 0; }
+
+// Adds a wallet to the ledger, keeping entries sorted by lock hash. A wallet
+// may only be added once.
+int reuse_coin_ledger_add(ReuseCoinLedger *ledger, const uint8_t *lock_hash) {
+  if (ledger->count >= MAX_LEDGER_WALLETS) {
+    return ERROR_LEDGER_WALLETS;
+  }
+  size_t pos = ledger->count;
+  while (pos > 0) {
+    int cmp = memcmp(ledger->entries[pos - 1].lock_hash, lock_hash,
+                     LEDGER_HASH_SIZE);
+    if (cmp == 0) {
+      return ERROR_LEDGER_WALLETS;
+    }
+    if (cmp < 0) {
+      break;
+    }
+    ledger->entries[pos] = ledger->entries[pos - 1];
+    pos--;
+  }
+  ReuseCoinLedgerEntry *entry = &ledger->entries[pos];
+  memset(entry, 0, sizeof(ReuseCoinLedgerEntry));
+  memcpy(entry->lock_hash, lock_hash, LEDGER_HASH_SIZE);
+  ledger->count++;
+  return CKB_SUCCESS;
+}
+
+ReuseCoinLedgerEntry *reuse_coin_ledger_find(ReuseCoinLedger *ledger,
+                                             const uint8_t *lock_hash) {
+  size_t lo = 0;
+  size_t hi = ledger->count;
+  while (lo < hi) {
+    size_t mid = lo + (hi - lo) / 2;
+    int cmp = memcmp(ledger->entries[mid].lock_hash, lock_hash,
+                     LEDGER_HASH_SIZE);
+    if (cmp == 0) {
+      return &ledger->entries[mid];
+    }
+    if (cmp < 0) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return NULL;
+}
+
+// Returns the entry of a wallet, adding the wallet when it is not tracked yet
+int reuse_coin_ledger_get(ReuseCoinLedger *ledger, const uint8_t *lock_hash,
+                          ReuseCoinLedgerEntry **entry) {
+  *entry = reuse_coin_ledger_find(ledger, lock_hash);
+  if (*entry != NULL) {
+    return CKB_SUCCESS;
+  }
+  int ret = reuse_coin_ledger_add(ledger, lock_hash);
+  if (ret != CKB_SUCCESS) {
+    return ret;
+  }
+  *entry = reuse_coin_ledger_find(ledger, lock_hash);
+  return CKB_SUCCESS;
+}
+
+// Adds the wallet cell at index/source, whose view already holds its lock
+// hash, to its entry. All cells of a wallet must hold the same token.
+int reuse_coin_ledger_record_cell(ReuseCoinLedgerEntry *entry, CellView *view,
+                                  size_t index, size_t source) {
+  int ret = load_cell_view(view, index, source,
+                           CELL_VIEW_TYPE_HASH | CELL_VIEW_DATA |
+                               CELL_VIEW_CAPACITY);
+  if (ret != CKB_SUCCESS) {
+    return ret;
+  }
+  if (!view->has_type || view->data_len != LEDGER_AMOUNT_SIZE) {
+    return ERROR_LEDGER_ENCODING;
+  }
+  if (entry->inputs + entry->outputs == 0) {
+    memcpy(entry->token_type, view->type_hash, LEDGER_HASH_SIZE);
+  } else if (!hash32_eq(entry->token_type, view->type_hash)) {
+    return ERROR_LEDGER_ENCODING;
+  }
+
+  unsigned __int128 amount;
+  memcpy(&amount, view->data, LEDGER_AMOUNT_SIZE);
+  unsigned __int128 *udt = source == CKB_SOURCE_INPUT ? &entry->udt_in
+                                                      : &entry->udt_out;
+  uint64_t *ckbytes = source == CKB_SOURCE_INPUT ? &entry->capacity_in
+                                                 : &entry->capacity_out;
+  if (*udt + amount < *udt || *ckbytes + view->capacity < *ckbytes) {
+    return ERROR_LEDGER_OVERFLOW;
+  }
+  *udt += amount;
+  *ckbytes += view->capacity;
+  if (source == CKB_SOURCE_INPUT) {
+    entry->inputs++;
+  } else {
+    entry->outputs++;
+  }
+  return CKB_SUCCESS;
+}
+
+// One pass over CKB_SOURCE_INPUT or CKB_SOURCE_OUTPUT
+int reuse_coin_ledger_record(ReuseCoinLedger *ledger, size_t source) {
+  size_t i = 0;
+  while (1) {
+    CellView view;
+    int ret = open_cell_view(&view, i, source, CELL_VIEW_LOCK_HASH);
+    if (ret == CKB_INDEX_OUT_OF_BOUND) {
+      break;
+    }
+    if (ret != CKB_SUCCESS) {
+      return ret;
+    }
+    ReuseCoinLedgerEntry *entry = reuse_coin_ledger_find(ledger, view.lock_hash);
+    if (entry != NULL) {
+      ret = reuse_coin_ledger_record_cell(entry, &view, i, source);
+      if (ret != CKB_SUCCESS) {
+        return ret;
+      }
+    }
+    i++;
+  }
+  return CKB_SUCCESS;
+}
+
+int reuse_coin_ledger_build(ReuseCoinLedger *ledger) {
+  int ret = reuse_coin_ledger_record(ledger, CKB_SOURCE_INPUT);
+  if (ret != CKB_SUCCESS) {
+    return ret;
+  }
+  return reuse_coin_ledger_record(ledger, CKB_SOURCE_OUTPUT);
+}
+
+#endif /* REUSE_COIN_LEDGER_H_ */
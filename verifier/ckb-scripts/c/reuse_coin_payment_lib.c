@@ -0,0 +1,10 @@
+// reuse_coin_payment_script.h built as a shared library, so the payment logic
+// is deployed once in a dep cell and loaded by every monetised script through
+// reuse_coin_plugin.h.
+#include "ckb_syscalls.h"
+#include "common.h"
+
+#include "blockchain.h"
+
+#define REUSE_COIN_EXPORT __attribute__((visibility("default")))
+#include "reuse_coin_payment_script.h"
@@ -1,103 +1,581 @@
 // This library should be included in any script to make it
 // reuse coin compatible. All you have to do is include it and run reuse_coin_verify()
-// at the beginning of your script. Right now, you have to include this in your script entirely.
-// In the future, this will be deployed on-chain and all you will need to do is use the simple reuse_coin_plugin
-// that will dynamically load this script at execution time from the dep cells in a tx.
-
-
-// TO DO
-// Safe arithmetic protect from overflow
-// Make shared library
-// Make compatible w/ native CKBytes
+// at the beginning of your script. It is also built on its own as
+// build/reuse_coin_payment_lib.so, which scripts load at execution time from the
+// dep cells in a tx by including reuse_coin_plugin.h instead of this file.
+//
+// Usage fees are paid in the wallet's token only. Fees in CKBytes are
+// enforced by the wallet lock itself, through the capacity of the wallet
+// cells.
 #include "blockchain.h"
 #include "ckb_syscalls.h"
+#include "reuse_coin_shard.h"
+#include "reuse_coin_hints.h"
+#include "reuse_coin_ledger.h"
 
 #define MAX_SCRIPT_SIZE 32768
 #define HASH_SIZE 32
 #define BALANCE_SIZE 16
+#define REUSE_COIN_MODE_SIZE 1
+
+// Payment modes, selected by the byte following the wallet lock hash in args
+#define REUSE_COIN_MODE_SINGLE 0
+#define REUSE_COIN_MODE_SHARDED 1
+#define REUSE_COIN_MODE_RECEIPT 2
+#define REUSE_COIN_MODE_CREDIT 3
+#define REUSE_COIN_MODE_SETTLEMENT 4
+#define REUSE_COIN_MODE_ROUTER 5
+
+#define RECEIPT_ARGS_LENGTH (HASH_SIZE + HASH_SIZE + BALANCE_SIZE)
+#define CREDIT_SIZE 8
+#define HASH_TYPE_DATA 0
+#define HASH_TYPE_TYPE 1
 
 
 #define ERROR_ARGS_ENCODING -51
 #define ERROR_INSUFFICIENT_PAYMENT -52
 #define ERROR_CELL_WALLET -53
 
+// Set to a visibility attribute by the shared library build
+#ifndef REUSE_COIN_EXPORT
+#define REUSE_COIN_EXPORT
+#endif
+
 typedef unsigned __int128 uint128_t;
-// Expected args:
-// The args are expected to be serialized in molecule according to ReuseCoinArgs schema.
-// The reuse coin specific args are the following:
-// 1. 32 byte lock hash of the cell wallet that your funds will be transferred to
-int reuse_coin_verify() {
 
-  // First, load args and verify
-  unsigned char script[MAX_SCRIPT_SIZE];
-  uint64_t script_size = MAX_SCRIPT_SIZE;
-  int script_load_ret = ckb_load_script(script, &script_size, 0);
+int reuse_coin_count_lock_hash(size_t source, const uint8_t *lock_hash, int *count) {
+  int i = 0;
+  while (1) {
+    unsigned char temp_hash[HASH_SIZE];
+    uint64_t lock_hash_size = HASH_SIZE;
 
-  if (script_load_ret != CKB_SUCCESS) {
-    return script_load_ret;
+    int lock_hash_ret = ckb_load_cell_by_field(temp_hash, &lock_hash_size, 0, i,
+      source, CKB_CELL_FIELD_LOCK_HASH);
+    if (lock_hash_ret == CKB_INDEX_OUT_OF_BOUND) {
+      break;
+    }
+    if (lock_hash_ret != CKB_SUCCESS) {
+      return lock_hash_ret;
+    }
+
+    if (hash32_eq(temp_hash, lock_hash)) {
+      *count += 1;
+    }
+    i++;
   }
+  return CKB_SUCCESS;
+}
 
-  mol_seg_t script_seg;
-  script_seg.ptr = (uint8_t *)script;
-  script_seg.size = script_size;
+int reuse_coin_cell_has_lock_hash(size_t index, size_t source, const uint8_t *lock_hash) {
+  unsigned char temp_hash[HASH_SIZE];
+  uint64_t lock_hash_size = HASH_SIZE;
+  int ret = ckb_load_cell_by_field(temp_hash, &lock_hash_size, 0, index,
+    source, CKB_CELL_FIELD_LOCK_HASH);
+  if (ret != CKB_SUCCESS) {
+    return ret;
+  }
+  if (!hash32_eq(temp_hash, lock_hash)) {
+    return ERROR_HINTS_MISMATCH;
+  }
+  return CKB_SUCCESS;
+}
 
-  mol_seg_t script_args = MolReader_Script_get_args(&script_seg);
-  mol_seg_t raw_args = MolReader_Bytes_raw_bytes(&script_args);
+// Finds the hinted dep holding this script's own code
+int reuse_coin_find_code_dep(mol_seg_t *script_seg, ReuseCoinHints *hints, uint32_t *code_dep) {
+  mol_seg_t code_hash_seg = MolReader_Script_get_code_hash(script_seg);
+  mol_seg_t hash_type_seg = MolReader_Script_get_hash_type(script_seg);
+  size_t field = CKB_CELL_FIELD_DATA_HASH;
+  if (*hash_type_seg.ptr == HASH_TYPE_TYPE) {
+    field = CKB_CELL_FIELD_TYPE_HASH;
+  }
 
-  if (raw_args.size < HASH_SIZE) {
-    return ERROR_ENCODING;
+  mol_num_t count = reuse_coin_hint_dep_count(hints);
+  for (mol_num_t n = 0; n < count; n++) {
+    uint32_t index = reuse_coin_hint_dep(hints, n);
+    unsigned char temp_hash[HASH_SIZE];
+    uint64_t hash_size = HASH_SIZE;
+    int ret = ckb_load_cell_by_field(temp_hash, &hash_size, 0, index,
+      CKB_SOURCE_CELL_DEP, field);
+    if (ret == CKB_SUCCESS && hash32_eq(temp_hash, code_hash_seg.ptr)) {
+      *code_dep = index;
+      return CKB_SUCCESS;
+    }
+    if (ret != CKB_SUCCESS && ret != CKB_ITEM_MISSING) {
+      return ret;
+    }
+  }
+  return ERROR_HINTS_MISMATCH;
+}
+
+// Finds the first input locked by lock_hash among the first limit inputs
+int reuse_coin_find_first_input(const uint8_t *lock_hash, size_t limit, size_t *index, int *found) {
+  *found = 0;
+  for (size_t i = 0; i < limit; i++) {
+    unsigned char temp_hash[HASH_SIZE];
+    uint64_t lock_hash_size = HASH_SIZE;
+    int ret = ckb_load_cell_by_field(temp_hash, &lock_hash_size, 0, i,
+      CKB_SOURCE_INPUT, CKB_CELL_FIELD_LOCK_HASH);
+    if (ret == CKB_INDEX_OUT_OF_BOUND) {
+      break;
+    }
+    if (ret != CKB_SUCCESS) {
+      return ret;
+    }
+    if (hash32_eq(temp_hash, lock_hash)) {
+      *index = i;
+      *found = 1;
+      break;
+    }
   }
+  return CKB_SUCCESS;
+}
 
+// A wallet with hints only charges the deps listed in the first witness of
+// its script group, so this script's code dep must be in that list. The
+// wallet's first input is at wallet_input. When code_dep is NULL the list is
+// searched for a dep holding this script's code.
+int reuse_coin_check_wallet_hints(mol_seg_t *script_seg, size_t wallet_input,
+                                  const uint32_t *code_dep) {
+  // Without hints of its own the wallet scans and charges every dep
+  unsigned char wallet_witness[MAX_HINTS_WITNESS_SIZE];
+  ReuseCoinHints wallet_hints;
+  int ret = reuse_coin_load_hints(wallet_witness, wallet_input, CKB_SOURCE_INPUT, &wallet_hints);
+  if (ret != CKB_SUCCESS) {
+    return ret;
+  }
+  if (!wallet_hints.present) {
+    return CKB_SUCCESS;
+  }
+  if (code_dep != NULL) {
+    return reuse_coin_hints_charge_dep(&wallet_hints, *code_dep) ? CKB_SUCCESS
+                                                                  : ERROR_HINTS_MISMATCH;
+  }
+  uint32_t wallet_code_dep;
+  return reuse_coin_find_code_dep(script_seg, &wallet_hints, &wallet_code_dep);
+}
+
+// Same as reuse_coin_check_wallet_hints for the wallet with wallet_lock_hash,
+// whose first input is looked for among the first limit inputs. A wallet that
+// is not spent charges no deps.
+int reuse_coin_verify_wallet_hints(mol_seg_t *script_seg, const uint8_t *wallet_lock_hash,
+                                   size_t limit, const uint32_t *code_dep) {
+  size_t wallet_input;
+  int found;
+  int ret = reuse_coin_find_first_input(wallet_lock_hash, limit, &wallet_input, &found);
+  if (ret != CKB_SUCCESS || !found) {
+    return ret;
+  }
+  return reuse_coin_check_wallet_hints(script_seg, wallet_input, code_dep);
+}
+
+// Checks only the hinted wallet input and output. Uniqueness of the wallet
+// input is enforced by the wallet lock over its own script group, and the
+// wallet only inspects the hinted output. What remains is proving that this
+// script's code dep is among the deps the wallet charges for.
+int reuse_coin_verify_single_hinted(mol_seg_t *script_seg, const uint8_t *wallet_lock_hash,
+                                    ReuseCoinHints *hints) {
+  int ret = reuse_coin_cell_has_lock_hash(hints->wallet_input, CKB_SOURCE_INPUT, wallet_lock_hash);
+  if (ret != CKB_SUCCESS) {
+    return ret;
+  }
+  ret = reuse_coin_cell_has_lock_hash(hints->wallet_output, CKB_SOURCE_OUTPUT, wallet_lock_hash);
+  if (ret != CKB_SUCCESS) {
+    return ret;
+  }
+
+  uint32_t code_dep;
+  ret = reuse_coin_find_code_dep(script_seg, hints, &code_dep);
+  if (ret != CKB_SUCCESS) {
+    return ret;
+  }
+
+  // A settlement wallet may have several inputs and the hinted one need not
+  // be the first, which is where the wallet reads its hints
+  return reuse_coin_verify_wallet_hints(script_seg, wallet_lock_hash,
+                                        (size_t)hints->wallet_input + 1, &code_dep);
+}
+
+// Exactly one input and one output carry the wallet lock hash
+int reuse_coin_verify_single(const uint8_t *wallet_lock_hash) {
   int found_in_input = 0;
   int found_in_output = 0;
 
+  int ret = reuse_coin_count_lock_hash(CKB_SOURCE_INPUT, wallet_lock_hash, &found_in_input);
+  if (ret != CKB_SUCCESS) {
+    return ret;
+  }
+  ret = reuse_coin_count_lock_hash(CKB_SOURCE_OUTPUT, wallet_lock_hash, &found_in_output);
+  if (ret != CKB_SUCCESS) {
+    return ret;
+  }
+
+  if (found_in_input == 1 && found_in_output == 1) {
+    return CKB_SUCCESS;
+  } else {
+    return ERROR_CELL_WALLET;
+  }
+}
+
+// Exactly one input belongs to the shard family, and exactly one output
+// carries the lock hash of that shard
+int reuse_coin_verify_sharded(mol_seg_t *script_seg, mol_seg_t *family_seg) {
+  if (family_seg->size <= SHARD_CODE_HASH_SIZE + 1) {
+    return ERROR_ARGS_ENCODING;
+  }
+  ReuseCoinShardFamily family;
+  family.code_hash = family_seg->ptr;
+  family.hash_type = family_seg->ptr[SHARD_CODE_HASH_SIZE];
+  family.args_prefix = &family_seg->ptr[SHARD_CODE_HASH_SIZE + 1];
+  family.args_prefix_len = family_seg->size - SHARD_CODE_HASH_SIZE - 1;
+
+  int shard_inputs = 0;
+  size_t shard_input = 0;
+  unsigned char shard_lock_hash[HASH_SIZE];
+
+  int i = 0;
+  while (1) {
+    int is_shard;
+    int ret = reuse_coin_cell_is_shard(i, CKB_SOURCE_INPUT, &family, &is_shard);
+    if (ret == CKB_INDEX_OUT_OF_BOUND) {
+      break;
+    }
+    if (ret != CKB_SUCCESS) {
+      return ret;
+    }
+    if (is_shard) {
+      shard_inputs += 1;
+      if (shard_inputs > 1) {
+        return ERROR_CELL_WALLET;
+      }
+      shard_input = i;
+      uint64_t lock_hash_size = HASH_SIZE;
+      ret = ckb_load_cell_by_field(shard_lock_hash, &lock_hash_size, 0, i,
+        CKB_SOURCE_INPUT, CKB_CELL_FIELD_LOCK_HASH);
+      if (ret != CKB_SUCCESS) {
+        return ret;
+      }
+    }
+    i++;
+  }
+
+  if (shard_inputs != 1) {
+    return ERROR_CELL_WALLET;
+  }
+
+  int found_in_output = 0;
+  int ret = reuse_coin_count_lock_hash(CKB_SOURCE_OUTPUT, shard_lock_hash, &found_in_output);
+  if (ret != CKB_SUCCESS) {
+    return ret;
+  }
+  if (found_in_output != 1) {
+    return ERROR_CELL_WALLET;
+  }
+  // The shard is the only input of its family, so it is the first of its group
+  return reuse_coin_check_wallet_hints(script_seg, shard_input, NULL);
+}
+
+// Number of uses of the wallet's scripts charged in this transaction: one per
+// cell dep locked by the wallet, the same deps the wallet lock charges for.
+// At least one, for this script itself.
+int reuse_coin_count_wallet_deps(const uint8_t *wallet_lock_hash, uint64_t *uses) {
+  int deps = 0;
+  int ret = reuse_coin_count_lock_hash(CKB_SOURCE_CELL_DEP, wallet_lock_hash, &deps);
+  if (ret != CKB_SUCCESS) {
+    return ret;
+  }
+  *uses = deps > 1 ? (uint64_t)deps : 1;
+  return CKB_SUCCESS;
+}
+
+// Outputs locked with the receipt lock of the wallet together carry the usage
+// fee in the wallet's token for every use of the wallet's scripts, since each
+// script in RECEIPT mode sees the same receipts. Falls back to the wallet
+// input/output pair when the receipts fall short.
+int reuse_coin_verify_receipt(const uint8_t *wallet_lock_hash, mol_seg_t *receipt_seg) {
+  if (receipt_seg->size != RECEIPT_ARGS_LENGTH) {
+    return ERROR_ARGS_ENCODING;
+  }
+  const uint8_t *receipt_lock_hash = receipt_seg->ptr;
+  const uint8_t *token_type = &receipt_seg->ptr[HASH_SIZE];
+  uint128_t udt_rate;
+  memcpy(&udt_rate, &receipt_seg->ptr[HASH_SIZE + HASH_SIZE], BALANCE_SIZE);
+
+  uint64_t uses;
+  int ret = reuse_coin_count_wallet_deps(wallet_lock_hash, &uses);
+  if (ret != CKB_SUCCESS) {
+    return ret;
+  }
+  if (udt_rate != 0 && (uint128_t)uses > (~(uint128_t)0) / udt_rate) {
+    return ERROR_OVERFLOW;
+  }
+  uint128_t expected_udt = udt_rate * uses;
+
+  uint128_t receipt_udt = 0;
+  int receipts = 0;
   int i = 0;
   while (1) {
     unsigned char temp_hash[HASH_SIZE];
-    uint64_t lock_hash_size = HASH_SIZE;
+    uint64_t hash_size = HASH_SIZE;
 
-    int lock_hash_ret = ckb_load_cell_by_field(temp_hash, &lock_hash_size, 0, i,
-      CKB_SOURCE_INPUT, CKB_CELL_FIELD_LOCK_HASH);
-    if (lock_hash_ret == CKB_INDEX_OUT_OF_BOUND) {
+    ret = ckb_load_cell_by_field(temp_hash, &hash_size, 0, i,
+      CKB_SOURCE_OUTPUT, CKB_CELL_FIELD_LOCK_HASH);
+    if (ret == CKB_INDEX_OUT_OF_BOUND) {
       break;
     }
-    if (lock_hash_ret  != CKB_SUCCESS) {
-      return lock_hash_ret ;
+    if (ret != CKB_SUCCESS) {
+      return ret;
+    }
+    if (!hash32_eq(temp_hash, receipt_lock_hash)) {
+      i++;
+      continue;
     }
 
-    if (memcmp(temp_hash, raw_args.ptr, HASH_SIZE) == 0) {
-         found_in_input += 1;
+    hash_size = HASH_SIZE;
+    ret = ckb_load_cell_by_field(temp_hash, &hash_size, 0, i,
+      CKB_SOURCE_OUTPUT, CKB_CELL_FIELD_TYPE_HASH);
+    if (ret == CKB_SUCCESS && hash32_eq(temp_hash, token_type)) {
+      uint128_t udt_amt;
+      uint64_t data_len = BALANCE_SIZE;
+      ret = ckb_load_cell_data((uint8_t *)&udt_amt, &data_len, 0, i, CKB_SOURCE_OUTPUT);
+      if (ret != CKB_SUCCESS) {
+        return ret;
       }
+      if (data_len == BALANCE_SIZE) {
+        if (receipt_udt + udt_amt < receipt_udt) {
+          return ERROR_OVERFLOW;
+        }
+        receipt_udt += udt_amt;
+        receipts += 1;
+      }
+    } else if (ret != CKB_SUCCESS && ret != CKB_ITEM_MISSING) {
+      return ret;
+    }
     i++;
   }
 
-  i = 0;
+  if (receipts > 0 && receipt_udt >= expected_udt) {
+    return CKB_SUCCESS;
+  }
+  return reuse_coin_verify_single(wallet_lock_hash);
+}
 
+int reuse_coin_sum_credits(size_t source, const uint8_t *credit_type_hash, uint64_t *total) {
+  int i = 0;
   while (1) {
     unsigned char temp_hash[HASH_SIZE];
-    uint64_t lock_hash_size = HASH_SIZE;
-
-    int lock_hash_ret = ckb_load_cell_by_field(temp_hash, &lock_hash_size, 0, i,
-      CKB_SOURCE_OUTPUT, CKB_CELL_FIELD_LOCK_HASH);
+    uint64_t hash_size = HASH_SIZE;
 
-    if (lock_hash_ret == CKB_INDEX_OUT_OF_BOUND) {
+    int ret = ckb_load_cell_by_field(temp_hash, &hash_size, 0, i,
+      source, CKB_CELL_FIELD_TYPE_HASH);
+    if (ret == CKB_INDEX_OUT_OF_BOUND) {
       break;
     }
-    if (lock_hash_ret != CKB_SUCCESS) {
-      return lock_hash_ret;
+    if (ret == CKB_SUCCESS && hash32_eq(temp_hash, credit_type_hash)) {
+      // The layout of each cell is enforced by the credit type script, not
+      // the sum over several cells
+      uint64_t credits;
+      uint64_t data_len = CREDIT_SIZE;
+      ret = ckb_load_cell_data((uint8_t *)&credits, &data_len, 0, i, source);
+      if (ret != CKB_SUCCESS) {
+        return ret;
+      }
+      if (*total + credits < *total) {
+        return ERROR_OVERFLOW;
+      }
+      *total += credits;
+    } else if (ret != CKB_SUCCESS && ret != CKB_ITEM_MISSING) {
+      return ret;
     }
+    i++;
+  }
+  return CKB_SUCCESS;
+}
 
-    if (memcmp(temp_hash, raw_args.ptr, HASH_SIZE) == 0) {
-          found_in_output += 1;
-      }
+// One prepaid credit of the developer's credit type is consumed for every use
+// of the wallet's scripts, since each script in CREDIT mode sees the same
+// credit cells
+int reuse_coin_verify_credit(const uint8_t *wallet_lock_hash, mol_seg_t *credit_seg) {
+  if (credit_seg->size != HASH_SIZE) {
+    return ERROR_ARGS_ENCODING;
+  }
+  uint64_t uses;
+  int ret = reuse_coin_count_wallet_deps(wallet_lock_hash, &uses);
+  if (ret != CKB_SUCCESS) {
+    return ret;
+  }
+  uint64_t input_credits = 0;
+  uint64_t output_credits = 0;
+
+  ret = reuse_coin_sum_credits(CKB_SOURCE_INPUT, credit_seg->ptr, &input_credits);
+  if (ret != CKB_SUCCESS) {
+    return ret;
+  }
+  ret = reuse_coin_sum_credits(CKB_SOURCE_OUTPUT, credit_seg->ptr, &output_credits);
+  if (ret != CKB_SUCCESS) {
+    return ret;
+  }
+  if (input_credits <= output_credits || input_credits - output_credits < uses) {
+    return ERROR_INSUFFICIENT_PAYMENT;
+  }
+  return CKB_SUCCESS;
+}
+
+// Every settled wallet has at least one input and one output, and its udt
+// balance grows. Each wallet's own lock enforces the exact amounts; the
+// ledger only proves that all of them are unlocked in this transaction.
+int reuse_coin_verify_settlement(const uint8_t *wallet_lock_hash, mol_seg_t *wallets_seg) {
+  if (wallets_seg->size % HASH_SIZE != 0) {
+    return ERROR_ARGS_ENCODING;
+  }
+  ReuseCoinLedger ledger;
+  reuse_coin_ledger_init(&ledger);
+  int ret = reuse_coin_ledger_add(&ledger, wallet_lock_hash);
+  if (ret != CKB_SUCCESS) {
+    return ret;
+  }
+  for (size_t offset = 0; offset < wallets_seg->size; offset += HASH_SIZE) {
+    ret = reuse_coin_ledger_add(&ledger, &wallets_seg->ptr[offset]);
+    if (ret != CKB_SUCCESS) {
+      return ret;
+    }
+  }
 
+  ret = reuse_coin_ledger_build(&ledger);
+  if (ret != CKB_SUCCESS) {
+    return ret;
+  }
+  for (size_t i = 0; i < ledger.count; i++) {
+    ReuseCoinLedgerEntry *entry = &ledger.entries[i];
+    if (entry->inputs < 1 || entry->outputs < 1) {
+      return ERROR_CELL_WALLET;
+    }
+    if (entry->udt_out <= entry->udt_in) {
+      return ERROR_INSUFFICIENT_PAYMENT;
+    }
+  }
+  return CKB_SUCCESS;
+}
+
+// The payment router verifies every fee in the transaction, so this script
+// only needs a router cell among the outputs. Hints are not used to find it:
+// their wallet_output names the wallet output that the wallet lock and
+// reuse_coin_verify_wallet_hints check, not the router.
+int reuse_coin_verify_router(mol_seg_t *router_seg) {
+  if (router_seg->size != HASH_SIZE) {
+    return ERROR_ARGS_ENCODING;
+  }
+
+  int i = 0;
+  while (1) {
+    CellView view;
+    int ret = open_cell_view(&view, i, CKB_SOURCE_OUTPUT, CELL_VIEW_TYPE_HASH);
+    if (ret == CKB_INDEX_OUT_OF_BOUND) {
+      break;
+    }
+    if (ret != CKB_SUCCESS) {
+      return ret;
+    }
+    if (view.has_type && hash32_eq(view.type_hash, router_seg->ptr)) {
+      return CKB_SUCCESS;
+    }
     i++;
   }
+  return ERROR_INSUFFICIENT_PAYMENT;
+}
 
-  if (found_in_input == 1 && found_in_output == 1) {
-    return CKB_SUCCESS;
-  } else {
-    return ERROR_CELL_WALLET;
+// Expected args:
+// The args are expected to be serialized in molecule according to ReuseCoinArgs schema.
+// The reuse coin specific args are the following:
+// 1. 32 byte lock hash of the cell wallet that your funds will be transferred to
+// 2. Optional 1 byte payment mode, followed by mode specific args:
+//    REUSE_COIN_MODE_SINGLE:  nothing, same as omitting the mode. Honors the
+//                             ReuseCoinHints described in reuse_coin_hints.h
+//    REUSE_COIN_MODE_SHARDED: 32 byte code hash and 1 byte hash type of the wallet
+//                             lock, followed by the wallet args of the shards without
+//                             the trailing shard index. Payment may be made to any shard.
+//    REUSE_COIN_MODE_RECEIPT: 32 byte lock hash of the wallet's receipt lock, 32 byte
+//                             token type hash and 16 byte udt rate. Receipt outputs
+//                             carrying the fee for every dep locked by the wallet
+//                             replace the wallet input/output pair.
+//    REUSE_COIN_MODE_CREDIT:  32 byte type hash of the wallet's credit type. Consuming a
+//                             prepaid credit for every dep locked by the wallet
+//                             replaces the wallet input/output pair.
+//    REUSE_COIN_MODE_SETTLEMENT: 32 byte lock hashes of further wallets settled along
+//                             with the first one, possibly of other developers and
+//                             tokens. Each wallet may span several cells.
+//    REUSE_COIN_MODE_ROUTER:  32 byte type hash of the payment router, which
+//                             verifies the fees of every script in the transaction.
+REUSE_COIN_EXPORT int reuse_coin_verify() {
+
+  // First, load args and verify
+  unsigned char script[MAX_SCRIPT_SIZE];
+  uint64_t script_size = MAX_SCRIPT_SIZE;
+  int script_load_ret = ckb_load_script(script, &script_size, 0);
+
+  if (script_load_ret != CKB_SUCCESS) {
+    return script_load_ret;
+  }
+
+  mol_seg_t script_seg;
+  script_seg.ptr = (uint8_t *)script;
+  script_seg.size = script_size;
+
+  mol_seg_t script_args = MolReader_Script_get_args(&script_seg);
+  mol_seg_t raw_args = MolReader_Bytes_raw_bytes(&script_args);
+
+  if (raw_args.size < HASH_SIZE) {
+    return ERROR_ENCODING;
+  }
+
+  uint8_t mode = REUSE_COIN_MODE_SINGLE;
+  if (raw_args.size > HASH_SIZE) {
+    mode = raw_args.ptr[HASH_SIZE];
   }
 
+  int ret;
+  if (mode == REUSE_COIN_MODE_SINGLE) {
+    // Optional index hints in the input_type of the group's first witness
+    unsigned char hints_witness[MAX_HINTS_WITNESS_SIZE];
+    ReuseCoinHints hints;
+    ret = reuse_coin_load_hints(hints_witness, 0, CKB_SOURCE_GROUP_INPUT, &hints);
+    if (ret != CKB_SUCCESS) {
+      return ret;
+    }
+    if (hints.present) {
+      return reuse_coin_verify_single_hinted(&script_seg, raw_args.ptr, &hints);
+    }
+    ret = reuse_coin_verify_single(raw_args.ptr);
+  } else if (mode == REUSE_COIN_MODE_SHARDED) {
+    mol_seg_t family_seg;
+    family_seg.ptr = &raw_args.ptr[HASH_SIZE + REUSE_COIN_MODE_SIZE];
+    family_seg.size = raw_args.size - HASH_SIZE - REUSE_COIN_MODE_SIZE;
+    return reuse_coin_verify_sharded(&script_seg, &family_seg);
+  } else if (mode == REUSE_COIN_MODE_RECEIPT) {
+    mol_seg_t receipt_seg;
+    receipt_seg.ptr = &raw_args.ptr[HASH_SIZE + REUSE_COIN_MODE_SIZE];
+    receipt_seg.size = raw_args.size - HASH_SIZE - REUSE_COIN_MODE_SIZE;
+    ret = reuse_coin_verify_receipt(raw_args.ptr, &receipt_seg);
+  } else if (mode == REUSE_COIN_MODE_CREDIT) {
+    mol_seg_t credit_seg;
+    credit_seg.ptr = &raw_args.ptr[HASH_SIZE + REUSE_COIN_MODE_SIZE];
+    credit_seg.size = raw_args.size - HASH_SIZE - REUSE_COIN_MODE_SIZE;
+    ret = reuse_coin_verify_credit(raw_args.ptr, &credit_seg);
+  } else if (mode == REUSE_COIN_MODE_SETTLEMENT) {
+    mol_seg_t wallets_seg;
+    wallets_seg.ptr = &raw_args.ptr[HASH_SIZE + REUSE_COIN_MODE_SIZE];
+    wallets_seg.size = raw_args.size - HASH_SIZE - REUSE_COIN_MODE_SIZE;
+    ret = reuse_coin_verify_settlement(raw_args.ptr, &wallets_seg);
+  } else if (mode == REUSE_COIN_MODE_ROUTER) {
+    mol_seg_t router_seg;
+    router_seg.ptr = &raw_args.ptr[HASH_SIZE + REUSE_COIN_MODE_SIZE];
+    router_seg.size = raw_args.size - HASH_SIZE - REUSE_COIN_MODE_SIZE;
+    ret = reuse_coin_verify_router(&router_seg);
+  } else {
+    return ERROR_ARGS_ENCODING;
+  }
+  if (ret != CKB_SUCCESS) {
+    return ret;
+  }
+  // Whatever paid the fee, a wallet spent with hints must charge this script
+  return reuse_coin_verify_wallet_hints(&script_seg, raw_args.ptr, SIZE_MAX, NULL);
 }
@@ -0,0 +1,39 @@
+#ifndef REUSE_COIN_PLUGIN_H_
+#define REUSE_COIN_PLUGIN_H_
+
+// Drop in replacement for reuse_coin_payment_script.h.
+//
+// Instead of compiling the payment logic into the script, reuse_coin_verify()
+// loads build/reuse_coin_payment_lib.so from the cell dep with its data hash
+// and runs the library's reuse_coin_verify(). The library runs inside the
+// calling script, so it checks the payment against that script's own args.
+// Payment fixes ship by deploying a new library cell, and rebuilding scripts
+// against its hash.
+#include "ckb_dlfcn.h"
+#include "reuse_coin_payment_lib_hash.h"
+
+#define REUSE_COIN_PLUGIN_CODE_SIZE (128 * 1024)
+
+uint8_t reuse_coin_plugin_code[REUSE_COIN_PLUGIN_CODE_SIZE]
+    __attribute__((aligned(RISCV_PGSIZE)));
+
+typedef int (*reuse_coin_verify_fn)();
+
+int reuse_coin_verify() {
+  void *handle = NULL;
+  size_t consumed_size = 0;
+  int ret = ckb_dlopen(reuse_coin_payment_lib_hash, reuse_coin_plugin_code,
+                       REUSE_COIN_PLUGIN_CODE_SIZE, &handle, &consumed_size);
+  if (ret != CKB_SUCCESS) {
+    ckb_debug("REUSE COIN PAYMENT LIBRARY NOT FOUND IN CELL DEPS");
+    return ret;
+  }
+  reuse_coin_verify_fn verify =
+      (reuse_coin_verify_fn)ckb_dlsym(handle, "reuse_coin_verify");
+  if (verify == NULL) {
+    return ERROR_SYMBOL_NOT_FOUND;
+  }
+  return verify();
+}
+
+#endif /* REUSE_COIN_PLUGIN_H_ */
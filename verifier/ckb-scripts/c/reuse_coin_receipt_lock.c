@@ -0,0 +1,283 @@
+// Receipt lock for ReuseCoin payments.
+//
+// Instead of mutating the developer's wallet cell, a payer may create a fresh
+// receipt cell that carries the usage fee and is locked with this script. The
+// payment script accepts such an output in place of a wallet input/output
+// pair, so payers never contend on a shared cell.
+//
+// Receipts can only be spent by the wallet's owner consolidating them into
+// the wallet they were paid to: every receipt in the script group must end up
+// in the single wallet output of the transaction. The owner proves itself
+// once for the whole group, with an input locked by the wallet's owner lock,
+// or else with a signature in the group's first witness, so the owner can
+// sweep hundreds of receipts at the cost of a single check. Without it anyone
+// could fold receipts into the wallet and pass their value off as the fee of
+// their own payment.
+#include "blake2b.h"
+#include "ckb_syscalls.h"
+#include "common.h"
+
+#include "blockchain.h"
+#include "secp256k1_helper.h"
+#include "secp256k1_schnorr.h"
+#include "secp256k1_lock.h"
+#include "reuse_coin_wallet_args.h"
+
+#define MAX_SCRIPT_SIZE 32768
+#define MAX_WALLET_LOCK_SIZE 512
+#define DATA_SIZE 16
+
+#define ERROR_WALLET_QUANTITY -47
+#define ERROR_RECEIPT_MISSING_TYPE -53
+#define ERROR_RECEIPT_WRONG_TOKEN_TYPE -54
+#define ERROR_NO_INPUT_WALLET_FOUND -56
+#define ERROR_NO_OUTPUT_WALLET_FOUND -57
+#define ERROR_RECEIPT_NOT_CONSOLIDATED -59
+#define ERROR_RECEIPT_OWNER_MISSING -60
+
+// Finds the only cell with the wallet lock hash in source, and loads its
+// index, udt amount, capacity and type hash
+int load_wallet(size_t source, unsigned char *wallet_lock_hash, size_t *wallet_index,
+                uint128_t *udt_balance, uint64_t *capacity, unsigned char *type_hash,
+                int *wallet_count) {
+  int i = 0;
+  while (1) {
+    unsigned char lock_hash[BLAKE2B_BLOCK_SIZE];
+    uint64_t len = BLAKE2B_BLOCK_SIZE;
+    int ret = ckb_load_cell_by_field(lock_hash, &len, 0, i, source, CKB_CELL_FIELD_LOCK_HASH);
+    if (ret == CKB_INDEX_OUT_OF_BOUND) {
+      break;
+    }
+    if (ret != CKB_SUCCESS) {
+      return ERROR_SYSCALL;
+    }
+    if (!hash32_eq(lock_hash, wallet_lock_hash)) {
+      i++;
+      continue;
+    }
+
+    *wallet_count += 1;
+    if (*wallet_count > 1) {
+      ckb_debug("Receipts can only be consolidated into a single wallet");
+      return ERROR_WALLET_QUANTITY;
+    }
+    *wallet_index = i;
+
+    uint64_t type_len = BLAKE2B_BLOCK_SIZE;
+    ret = ckb_load_cell_by_field(type_hash, &type_len, 0, i, source, CKB_CELL_FIELD_TYPE_HASH);
+    if (ret == CKB_ITEM_MISSING) {
+      return ERROR_RECEIPT_MISSING_TYPE;
+    }
+    if (ret != CKB_SUCCESS) {
+      return ERROR_SYSCALL;
+    }
+
+    uint64_t data_len = DATA_SIZE;
+    ret = ckb_load_cell_data((uint8_t *)udt_balance, &data_len, 0, i, source);
+    if (ret != CKB_SUCCESS) {
+      return ERROR_SYSCALL;
+    }
+    if (data_len != DATA_SIZE) {
+      return ERROR_ENCODING;
+    }
+
+    uint64_t capacity_len = CAPACITY_SIZE;
+    ret = ckb_checked_load_cell_by_field((uint8_t *)capacity, &capacity_len, 0, i,
+      source, CKB_CELL_FIELD_CAPACITY);
+    if (ret != CKB_SUCCESS) {
+      return ERROR_SYSCALL;
+    }
+    i++;
+  }
+  return CKB_SUCCESS;
+}
+
+// Sums the udt amounts and capacities of all receipts in the script group
+int sum_receipts(unsigned char *token_type, uint128_t *udt_total, uint64_t *capacity_total) {
+  int i = 0;
+  while (1) {
+    unsigned char type_hash[BLAKE2B_BLOCK_SIZE];
+    uint64_t len = BLAKE2B_BLOCK_SIZE;
+    int ret = ckb_load_cell_by_field(type_hash, &len, 0, i,
+      CKB_SOURCE_GROUP_INPUT, CKB_CELL_FIELD_TYPE_HASH);
+    if (ret == CKB_INDEX_OUT_OF_BOUND) {
+      break;
+    }
+    if (ret == CKB_ITEM_MISSING) {
+      return ERROR_RECEIPT_MISSING_TYPE;
+    }
+    if (ret != CKB_SUCCESS) {
+      return ERROR_SYSCALL;
+    }
+    if (!hash32_eq(type_hash, token_type)) {
+      return ERROR_RECEIPT_WRONG_TOKEN_TYPE;
+    }
+
+    uint128_t udt_amt;
+    uint64_t data_len = DATA_SIZE;
+    ret = ckb_load_cell_data((uint8_t *)&udt_amt, &data_len, 0, i, CKB_SOURCE_GROUP_INPUT);
+    if (ret != CKB_SUCCESS) {
+      return ERROR_SYSCALL;
+    }
+    if (data_len != DATA_SIZE) {
+      return ERROR_ENCODING;
+    }
+
+    uint64_t capacity;
+    uint64_t capacity_len = CAPACITY_SIZE;
+    ret = ckb_checked_load_cell_by_field((uint8_t *)&capacity, &capacity_len, 0, i,
+      CKB_SOURCE_GROUP_INPUT, CKB_CELL_FIELD_CAPACITY);
+    if (ret != CKB_SUCCESS) {
+      return ERROR_SYSCALL;
+    }
+
+    if (*udt_total + udt_amt < *udt_total) {
+      return ERROR_OVERFLOW;
+    }
+    if (*capacity_total + capacity < *capacity_total) {
+      return ERROR_OVERFLOW;
+    }
+    *udt_total += udt_amt;
+    *capacity_total += capacity;
+    i++;
+  }
+  return CKB_SUCCESS;
+}
+
+// Checks that the owner of the wallet input at wallet_index takes part in the
+// transaction, the same way the wallet lock's owner path does
+int check_wallet_owner(size_t wallet_index) {
+  unsigned char lock[MAX_WALLET_LOCK_SIZE];
+  uint64_t len = MAX_WALLET_LOCK_SIZE;
+  int ret = ckb_load_cell_by_field(lock, &len, 0, wallet_index, CKB_SOURCE_INPUT,
+    CKB_CELL_FIELD_LOCK);
+  if (ret != CKB_SUCCESS) {
+    return ERROR_SYSCALL;
+  }
+  if (len > MAX_WALLET_LOCK_SIZE) {
+    return ERROR_ENCODING;
+  }
+
+  mol_seg_t lock_seg;
+  lock_seg.ptr = (uint8_t *)lock;
+  lock_seg.size = len;
+  if (MolReader_Script_verify(&lock_seg, false) != MOL_OK) {
+    return ERROR_ENCODING;
+  }
+  mol_seg_t args_seg = MolReader_Script_get_args(&lock_seg);
+  mol_seg_t raw_args = MolReader_Bytes_raw_bytes(&args_seg);
+  WalletArgs args;
+  ret = parse_wallet_args(&raw_args, &args);
+  if (ret != CKB_SUCCESS) {
+    return ret;
+  }
+
+  // pubkey_hash is unused by wallets with an owner lock
+  if (args.flags & WALLET_FLAG_OWNER_LOCK) {
+    int owner_present;
+    ret = check_owner_lock(args.owner_lock_hash, &owner_present);
+    if (ret != CKB_SUCCESS) {
+      return ret;
+    }
+    if (!owner_present) {
+      ckb_debug("RECEIPTS CAN ONLY BE CONSOLIDATED BY THE WALLET OWNER");
+      return ERROR_RECEIPT_OWNER_MISSING;
+    }
+    return CKB_SUCCESS;
+  }
+
+  WitnessContext first_witness;
+  ret = load_witness_context(&first_witness, 0, CKB_SOURCE_GROUP_INPUT);
+  if (ret != CKB_SUCCESS) {
+    return ret;
+  }
+  if (args.flags & WALLET_FLAG_SCHNORR) {
+    return verify_schnorr_blake160_sighash_all(args.pubkey_hash, &first_witness);
+  }
+  return verify_secp256k1_blake160_sighash_all(args.pubkey_hash, &first_witness);
+}
+
+// Args:
+// 1. 32 byte lock hash of the cell wallet the receipts are paid to
+int main() {
+  ckb_debug("REUSE COIN RECEIPT LOCK EXECUTING\n");
+
+  unsigned char script[MAX_SCRIPT_SIZE];
+  uint64_t script_len = MAX_SCRIPT_SIZE;
+  int ret = ckb_load_script(script, &script_len, 0);
+  if (ret != CKB_SUCCESS) {
+    return ERROR_SYSCALL;
+  }
+
+  mol_seg_t script_seg;
+  script_seg.ptr = (uint8_t *)script;
+  script_seg.size = script_len;
+
+  if (MolReader_Script_verify(&script_seg, false) != MOL_OK) {
+    ckb_debug("ERROR IN SCRIPT ENCODING OF RECEIPT LOCK");
+    return ERROR_ENCODING;
+  }
+
+  mol_seg_t args_seg = MolReader_Script_get_args(&script_seg);
+  mol_seg_t raw_args = MolReader_Bytes_raw_bytes(&args_seg);
+  if (raw_args.size != BLAKE2B_BLOCK_SIZE) {
+    return ERROR_ARGUMENTS_LEN;
+  }
+
+  uint128_t input_udt_balance = 0;
+  uint128_t output_udt_balance = 0;
+  uint64_t input_wallet_capacity = 0;
+  uint64_t output_wallet_capacity = 0;
+  unsigned char input_token_type[BLAKE2B_BLOCK_SIZE];
+  unsigned char output_token_type[BLAKE2B_BLOCK_SIZE];
+  int input_wallet_count = 0;
+  int output_wallet_count = 0;
+  size_t input_wallet_index = 0;
+  size_t output_wallet_index = 0;
+
+  ret = load_wallet(CKB_SOURCE_INPUT, raw_args.ptr, &input_wallet_index, &input_udt_balance,
+    &input_wallet_capacity, input_token_type, &input_wallet_count);
+  if (ret != CKB_SUCCESS) {
+    return ret;
+  }
+  if (input_wallet_count < 1) {
+    return ERROR_NO_INPUT_WALLET_FOUND;
+  }
+
+  ret = check_wallet_owner(input_wallet_index);
+  if (ret != CKB_SUCCESS) {
+    return ret;
+  }
+
+  ret = load_wallet(CKB_SOURCE_OUTPUT, raw_args.ptr, &output_wallet_index, &output_udt_balance,
+    &output_wallet_capacity, output_token_type, &output_wallet_count);
+  if (ret != CKB_SUCCESS) {
+    return ret;
+  }
+  if (output_wallet_count < 1) {
+    return ERROR_NO_OUTPUT_WALLET_FOUND;
+  }
+
+  if (!hash32_eq(input_token_type, output_token_type)) {
+    return ERROR_RECEIPT_WRONG_TOKEN_TYPE;
+  }
+
+  uint128_t receipt_udt = 0;
+  uint64_t receipt_capacity = 0;
+  ret = sum_receipts(output_token_type, &receipt_udt, &receipt_capacity);
+  if (ret != CKB_SUCCESS) {
+    return ret;
+  }
+
+  // Every receipt must flow into the wallet, both its tokens and its capacity
+  if (input_udt_balance + receipt_udt < input_udt_balance ||
+      input_wallet_capacity + receipt_capacity < input_wallet_capacity) {
+    return ERROR_OVERFLOW;
+  }
+  if (output_udt_balance < input_udt_balance + receipt_udt ||
+      output_wallet_capacity < input_wallet_capacity + receipt_capacity) {
+    ckb_debug("RECEIPTS NOT CONSOLIDATED INTO WALLET");
+    return ERROR_RECEIPT_NOT_CONSOLIDATED;
+  }
+  return CKB_SUCCESS;
+}
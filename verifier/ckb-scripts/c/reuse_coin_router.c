@@ -0,0 +1,162 @@
+// Payment router for ReuseCoin fees.
+//
+// Every reusable script that includes reuse_coin_payment_script.h checks its
+// own payment, so a transaction using N monetised scripts scans its inputs and
+// outputs N times. The router is a type script that verifies the fees of all
+// of them at once: it collects every cell dep locked by a cell wallet, adds up
+// the fee owed to each wallet and checks every wallet's balance change in a
+// single pass over the inputs and outputs. Reusable scripts in
+// REUSE_COIN_MODE_ROUTER then only check that a router cell is present.
+//
+// The router charges each wallet the flat udt rate in its args once per
+// transaction, as the wallet lock does. Wallets with a rate table or a unique
+// script still enforce their exact fees in their own lock, which runs once
+// per wallet regardless of the router.
+#include "ckb_syscalls.h"
+#include "common.h"
+
+#include "blockchain.h"
+#include "reuse_coin_ledger.h"
+
+#define BLAKE2B_BLOCK_SIZE 32
+#define MAX_SCRIPT_SIZE 32768
+#define MAX_WALLET_LOCK_SIZE 512
+#define BLAKE160_SIZE 20
+#define CAPACITY_SIZE 8
+#define BALANCE_SIZE 16
+#define WALLET_ARGS_MIN_LENGTH (BLAKE160_SIZE + CAPACITY_SIZE + BALANCE_SIZE + BLAKE2B_BLOCK_SIZE)
+#define ROUTER_ARGS_LENGTH (BLAKE2B_BLOCK_SIZE + 1)
+
+#define ERROR_NO_INPUT_WALLET_FOUND -56
+#define ERROR_NO_OUTPUT_WALLET_FOUND -57
+#define ERROR_WALLET_UNLOCK -58
+typedef unsigned __int128 uint128_t;
+
+// Checks whether the dep at index is locked by a cell wallet, and if so loads
+// the wallet's udt rate and the view's lock hash
+int load_wallet_dep(size_t index, mol_seg_t *wallet_code, CellView *view,
+                    uint128_t *udt_rate, int *is_wallet) {
+  *is_wallet = 0;
+  unsigned char lock[MAX_WALLET_LOCK_SIZE];
+  uint64_t len = MAX_WALLET_LOCK_SIZE;
+  int ret = ckb_load_cell_by_field(lock, &len, 0, index, CKB_SOURCE_CELL_DEP,
+    CKB_CELL_FIELD_LOCK);
+  if (ret != CKB_SUCCESS) {
+    return ret;
+  }
+  // Wallet locks are far smaller, anything larger is some other lock
+  if (len > MAX_WALLET_LOCK_SIZE) {
+    return CKB_SUCCESS;
+  }
+
+  mol_seg_t lock_seg;
+  lock_seg.ptr = (uint8_t *)lock;
+  lock_seg.size = len;
+  if (MolReader_Script_verify(&lock_seg, false) != MOL_OK) {
+    return ERROR_ENCODING;
+  }
+  mol_seg_t code_hash_seg = MolReader_Script_get_code_hash(&lock_seg);
+  mol_seg_t hash_type_seg = MolReader_Script_get_hash_type(&lock_seg);
+  if (!hash32_eq(code_hash_seg.ptr, wallet_code->ptr) ||
+      *hash_type_seg.ptr != wallet_code->ptr[BLAKE2B_BLOCK_SIZE]) {
+    return CKB_SUCCESS;
+  }
+
+  mol_seg_t args_seg = MolReader_Script_get_args(&lock_seg);
+  mol_seg_t raw_args = MolReader_Bytes_raw_bytes(&args_seg);
+  if (raw_args.size < WALLET_ARGS_MIN_LENGTH) {
+    return ERROR_ARGUMENTS_LEN;
+  }
+  memcpy(udt_rate, &raw_args.ptr[BLAKE160_SIZE + CAPACITY_SIZE], BALANCE_SIZE);
+
+  ret = open_cell_view(view, index, CKB_SOURCE_CELL_DEP, CELL_VIEW_LOCK_HASH);
+  if (ret != CKB_SUCCESS) {
+    return ret;
+  }
+  *is_wallet = 1;
+  return CKB_SUCCESS;
+}
+
+// Adds every wallet with a locked dep to the ledger, owing its udt rate
+int collect_fees(mol_seg_t *wallet_code, ReuseCoinLedger *ledger) {
+  size_t i = 0;
+  while (1) {
+    CellView view;
+    uint128_t udt_rate;
+    int is_wallet;
+    int ret = load_wallet_dep(i, wallet_code, &view, &udt_rate, &is_wallet);
+    if (ret == CKB_INDEX_OUT_OF_BOUND) {
+      break;
+    }
+    if (ret != CKB_SUCCESS) {
+      return ret;
+    }
+    if (is_wallet) {
+      ReuseCoinLedgerEntry *entry;
+      ret = reuse_coin_ledger_get(ledger, view.lock_hash, &entry);
+      if (ret != CKB_SUCCESS) {
+        return ret;
+      }
+      // Every dep of a wallet carries the same args, so the same rate
+      entry->udt_due = udt_rate;
+    }
+    i++;
+  }
+  return CKB_SUCCESS;
+}
+
+// Args:
+// 1. 32 byte code hash of the cell wallet lock
+// 2. 1 byte hash type of the cell wallet lock
+int main() {
+  ckb_debug("REUSE COIN PAYMENT ROUTER EXECUTING\n");
+
+  unsigned char script[MAX_SCRIPT_SIZE];
+  uint64_t script_len = MAX_SCRIPT_SIZE;
+  int ret = ckb_load_script(script, &script_len, 0);
+  if (ret != CKB_SUCCESS) {
+    return ERROR_SYSCALL;
+  }
+
+  mol_seg_t script_seg;
+  script_seg.ptr = (uint8_t *)script;
+  script_seg.size = script_len;
+
+  if (MolReader_Script_verify(&script_seg, false) != MOL_OK) {
+    ckb_debug("ERROR IN SCRIPT ENCODING OF PAYMENT ROUTER");
+    return ERROR_ENCODING;
+  }
+
+  mol_seg_t args_seg = MolReader_Script_get_args(&script_seg);
+  mol_seg_t raw_args = MolReader_Bytes_raw_bytes(&args_seg);
+  if (raw_args.size != ROUTER_ARGS_LENGTH) {
+    return ERROR_ARGUMENTS_LEN;
+  }
+
+  ReuseCoinLedger ledger;
+  reuse_coin_ledger_init(&ledger);
+  ret = collect_fees(&raw_args, &ledger);
+  if (ret != CKB_SUCCESS) {
+    return ret;
+  }
+  ret = reuse_coin_ledger_build(&ledger);
+  if (ret != CKB_SUCCESS) {
+    return ret;
+  }
+
+  for (size_t i = 0; i < ledger.count; i++) {
+    ReuseCoinLedgerEntry *entry = &ledger.entries[i];
+    if (entry->inputs < 1) {
+      return ERROR_NO_INPUT_WALLET_FOUND;
+    }
+    if (entry->outputs < 1) {
+      return ERROR_NO_OUTPUT_WALLET_FOUND;
+    }
+    if (entry->udt_out <= entry->udt_in ||
+        entry->udt_out - entry->udt_in < entry->udt_due) {
+      ckb_debug("WALLET NOT PAID THROUGH ROUTER");
+      return ERROR_WALLET_UNLOCK;
+    }
+  }
+  return CKB_SUCCESS;
+}
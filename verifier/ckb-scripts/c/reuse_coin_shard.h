@@ -0,0 +1,79 @@
+#ifndef REUSE_COIN_SHARD_H_
+#define REUSE_COIN_SHARD_H_
+
+// Helpers shared by the cell wallet lock and the payment script for sharded
+// wallets.
+//
+// A sharded wallet is a family of wallet cells whose lock scripts share the
+// same code hash, hash type and args, except for a trailing shard index. Since
+// the shard index is always the last field of the wallet args, every shard of
+// a family can be recognised by comparing its lock script against the shared
+// args prefix.
+#include "blockchain.h"
+#include "ckb_syscalls.h"
+
+#define SHARD_CODE_HASH_SIZE 32
+#define SHARD_INDEX_SIZE 4
+// Serialized Script header: total size + 3 field offsets, then code_hash,
+// hash_type and the length prefix of args
+#define SHARD_SCRIPT_OVERHEAD (4 + 3 * 4 + SHARD_CODE_HASH_SIZE + 1 + 4)
+#define MAX_SHARD_SCRIPT_SIZE 512
+
+typedef struct {
+  const uint8_t *code_hash;
+  uint8_t hash_type;
+  const uint8_t *args_prefix;
+  size_t args_prefix_len;
+} ReuseCoinShardFamily;
+
+// Checks whether a serialized lock script belongs to the shard family
+int reuse_coin_script_is_shard(mol_seg_t *script_seg,
+                               const ReuseCoinShardFamily *family) {
+  mol_seg_t code_hash_seg = MolReader_Script_get_code_hash(script_seg);
+  mol_seg_t hash_type_seg = MolReader_Script_get_hash_type(script_seg);
+  mol_seg_t args_seg = MolReader_Script_get_args(script_seg);
+  mol_seg_t raw_args = MolReader_Bytes_raw_bytes(&args_seg);
+
+  if (raw_args.size != family->args_prefix_len + SHARD_INDEX_SIZE) {
+    return 0;
+  }
+  if (*hash_type_seg.ptr != family->hash_type) {
+    return 0;
+  }
+  if (!hash32_eq(code_hash_seg.ptr, family->code_hash)) {
+    return 0;
+  }
+  return memcmp(raw_args.ptr, family->args_prefix, family->args_prefix_len) ==
+         0;
+}
+
+// Loads the lock of the cell at index/source and checks whether it belongs
+// to the shard family. Returns CKB_INDEX_OUT_OF_BOUND past the last cell.
+int reuse_coin_cell_is_shard(size_t index, size_t source,
+                             const ReuseCoinShardFamily *family,
+                             int *is_shard) {
+  unsigned char lock[MAX_SHARD_SCRIPT_SIZE];
+  uint64_t len = MAX_SHARD_SCRIPT_SIZE;
+  *is_shard = 0;
+
+  int ret = ckb_load_cell_by_field(lock, &len, 0, index, source,
+                                   CKB_CELL_FIELD_LOCK);
+  if (ret != CKB_SUCCESS) {
+    return ret;
+  }
+  // All shards of a family serialize to the same size, anything else can be
+  // skipped without parsing
+  if (len > MAX_SHARD_SCRIPT_SIZE ||
+      len != SHARD_SCRIPT_OVERHEAD + family->args_prefix_len +
+                 SHARD_INDEX_SIZE) {
+    return CKB_SUCCESS;
+  }
+
+  mol_seg_t lock_seg;
+  lock_seg.ptr = (uint8_t *)lock;
+  lock_seg.size = len;
+  *is_shard = reuse_coin_script_is_shard(&lock_seg, family);
+  return CKB_SUCCESS;
+}
+
+#endif /* REUSE_COIN_SHARD_H_ */
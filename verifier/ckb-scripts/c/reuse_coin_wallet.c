@@ -1,19 +1,33 @@
+#include <stdlib.h>
+
 #include "blake2b.h"
 #include "ckb_syscalls.h"
 #include "common.h"
 
 
 #include "blockchain.h"
+#ifdef REUSE_COIN_DYNAMIC_SECP256K1
+// Owner signatures are checked by secp256k1_sighash_all_lib, loaded from a
+// cell dep, instead of by a secp256k1 linked into this binary
+#include "ckb_dlfcn.h"
+#include "secp256k1_sighash_all_lib_hash.h"
+#else
 #include "secp256k1_helper.h"
+#include "secp256k1_schnorr.h"
 #include "secp256k1_lock.h"
+#endif
+#include "reuse_coin_shard.h"
+#include "reuse_coin_hints.h"
+#include "reuse_coin_wallet_args.h"
 
-#define BLAKE2B_BLOCK_SIZE 32
 #define MAX_SCRIPT_SIZE 32768
 #define DATA_SIZE 16
-#define BALANCE_SIZE 16
-#define CAPACITY_SIZE 8
-#define MIN_ARGS_LENGTH (BLAKE160_SIZE + CAPACITY_SIZE + BALANCE_SIZE + BLAKE2B_BLOCK_SIZE)
-#define MAX_ARGS_LENGTH (MIN_ARGS_LENGTH + BLAKE2B_BLOCK_SIZE)
+
+// Rate table cell data: entries of script type hash | udt rate, strictly
+// ascending by type hash. The table cell must not be locked by the wallet,
+// or it would be charged as a script. The table is loaded into a heap block
+// of its own size, so its length is only bounded by CKB_HEAP_SIZE.
+#define RATE_ENTRY_SIZE (BLAKE2B_BLOCK_SIZE + BALANCE_SIZE)
 
 #define ERROR_WALLET_QUANTITY -47
 #define ERROR_AMOUNT -48
@@ -28,165 +42,319 @@
 #define ERROR_NO_INPUT_WALLET_FOUND -56
 #define ERROR_NO_OUTPUT_WALLET_FOUND -57
 #define ERROR_WALLET_UNLOCK -58
-typedef unsigned __int128 uint128_t;
-
-
+#define ERROR_RATE_TABLE_MISSING -61
+#define ERROR_UNPRICED_SCRIPT -62
+#define ERROR_SECP256K1_LIB_SYMBOL -63
+
+typedef struct {
+  uint8_t *entries;
+  size_t count;
+} RateTable;
+
+int witness_has_signature(size_t index, size_t source, int *has_sig) {
+  WitnessContext witness;
+  int ret = load_witness_context(&witness, index, source);
+  if (ret != CKB_SUCCESS) {
+    return ret;
+  }
+  *has_sig = witness.lock.size > 0;
+  return CKB_SUCCESS;
+}
 
-int has_signature(int *has_sig) {
-  int ret;
-  unsigned char temp[MAX_WITNESS_SIZE];
+#ifdef REUSE_COIN_DYNAMIC_SECP256K1
+// Memory for the library's loaded segments, see make wallet-sizes
+#ifndef SECP256K1_LIB_CODE_SIZE
+#define SECP256K1_LIB_CODE_SIZE (256 * 1024)
+#endif
+uint8_t secp256k1_lib_code[SECP256K1_LIB_CODE_SIZE] __attribute__((aligned(RISCV_PGSIZE)));
+typedef int (*verify_sighash_all_fn)(unsigned char *pubkey_hash, WitnessContext *first_witness);
+#endif
+
+// Verifies the owner's signature in the lock field of the group's first
+// witness, with the scheme selected by the wallet flags
+int verify_owner_signature(WalletArgs *args, WitnessContext *first_witness) {
+#ifdef REUSE_COIN_DYNAMIC_SECP256K1
+  void *handle = NULL;
+  size_t consumed_size = 0;
+  int ret = ckb_dlopen(secp256k1_sighash_all_lib_hash, secp256k1_lib_code,
+                       SECP256K1_LIB_CODE_SIZE, &handle, &consumed_size);
+  if (ret != CKB_SUCCESS) {
+    return ret;
+  }
+  const char *symbol = (args->flags & WALLET_FLAG_SCHNORR) ? "verify_schnorr_sighash_all"
+                                                          : "verify_sighash_all";
+  verify_sighash_all_fn verify = (verify_sighash_all_fn)ckb_dlsym(handle, symbol);
+  if (verify == NULL) {
+    return ERROR_SECP256K1_LIB_SYMBOL;
+  }
+  return verify(args->pubkey_hash, first_witness);
+#else
+  if (args->flags & WALLET_FLAG_SCHNORR) {
+    return verify_schnorr_blake160_sighash_all(args->pubkey_hash, first_witness);
+  }
+  return verify_secp256k1_blake160_sighash_all(args->pubkey_hash, first_witness);
+#endif
+}
 
-  /* Load witness of first input */
-  uint64_t witness_len = MAX_WITNESS_SIZE;
-  ret = ckb_load_witness(temp, &witness_len, 0, 0, CKB_SOURCE_GROUP_INPUT);
+// A shard that carries no signature may still be unlocked when the owner
+// sweeps the wallet: the first input of any sibling shard must carry a
+// signature. Sharded wallets never fall back to the payment path once a
+// signature is present, so that sibling's own lock guarantees it is valid.
+int check_signed_sibling(const ReuseCoinShardFamily *family, unsigned char *lock_hash, int *signed_sibling) {
+  *signed_sibling = 0;
+  int i = 0;
+  while (1) {
+    int is_shard;
+    int ret = reuse_coin_cell_is_shard(i, CKB_SOURCE_INPUT, family, &is_shard);
+    if (ret == CKB_INDEX_OUT_OF_BOUND) {
+      break;
+    }
+    if (ret != CKB_SUCCESS) {
+      return ERROR_SYSCALL;
+    }
+    if (is_shard) {
+      unsigned char shard_lock_hash[BLAKE2B_BLOCK_SIZE];
+      uint64_t len = BLAKE2B_BLOCK_SIZE;
+      ret = ckb_load_cell_by_field(shard_lock_hash, &len, 0, i,
+        CKB_SOURCE_INPUT, CKB_CELL_FIELD_LOCK_HASH);
+      if (ret != CKB_SUCCESS) {
+        return ERROR_SYSCALL;
+      }
+      if (!hash32_eq(shard_lock_hash, lock_hash)) {
+        // First input of a sibling is the first input of its script group
+        return witness_has_signature(i, CKB_SOURCE_INPUT, signed_sibling);
+      }
+    }
+    i++;
+  }
+  return CKB_SUCCESS;
+}
 
-  if ((ret == CKB_INDEX_OUT_OF_BOUND) ||
-      (ret == CKB_SUCCESS && witness_len == 0)) {
-    *has_sig = 0;
-    return CKB_SUCCESS;
+// Loads the rate table from the cell dep whose data hash is table_hash
+int load_rate_table(unsigned char *table_hash, RateTable *table) {
+  size_t index;
+  int ret = ckb_look_for_dep_with_hash(table_hash, &index);
+  if (ret != CKB_SUCCESS) {
+    ckb_debug("RATE TABLE CELL NOT FOUND IN CELL DEPS");
+    return ERROR_RATE_TABLE_MISSING;
   }
 
+  uint64_t size = 0;
+  ret = ckb_load_cell_data(NULL, &size, 0, index, CKB_SOURCE_CELL_DEP);
   if (ret != CKB_SUCCESS) {
     return ERROR_SYSCALL;
   }
+  if (size % RATE_ENTRY_SIZE != 0) {
+    ckb_debug("INVALID RATE TABLE SIZE");
+    return ERROR_ENCODING;
+  }
+  table->entries = malloc(size);
+  if (table->entries == NULL) {
+    ckb_debug("RATE TABLE TOO LARGE");
+    return ERROR_ENCODING;
+  }
+  uint64_t len = size;
+  ret = ckb_load_cell_data(table->entries, &len, 0, index, CKB_SOURCE_CELL_DEP);
+  if (ret != CKB_SUCCESS || len != size) {
+    return ERROR_SYSCALL;
+  }
+  table->count = size / RATE_ENTRY_SIZE;
 
-  if (witness_len > MAX_WITNESS_SIZE) {
-    return ERROR_WITNESS_SIZE;
+  for (size_t i = 1; i < table->count; i++) {
+    if (memcmp(&table->entries[(i - 1) * RATE_ENTRY_SIZE],
+               &table->entries[i * RATE_ENTRY_SIZE], BLAKE2B_BLOCK_SIZE) >= 0) {
+      ckb_debug("RATE TABLE MUST BE STRICTLY ASCENDING");
+      return ERROR_ENCODING;
+    }
   }
+  return CKB_SUCCESS;
+}
 
-  /* load signature */
-  mol_seg_t lock_bytes_seg;
-  ret = extract_witness_lock(temp, witness_len, &lock_bytes_seg);
-  if (ret != 0) {
-    ckb_debug("ERROR ENCODING IN WITNESS LOCK");
-    return ERROR_ENCODING;
+// Binary search for the rate of the script with type_hash
+int rate_table_lookup(const RateTable *table, const unsigned char *type_hash, uint128_t *rate) {
+  size_t lo = 0;
+  size_t hi = table->count;
+  while (lo < hi) {
+    size_t mid = lo + (hi - lo) / 2;
+    const uint8_t *entry = &table->entries[mid * RATE_ENTRY_SIZE];
+    int cmp = memcmp(entry, type_hash, BLAKE2B_BLOCK_SIZE);
+    if (cmp == 0) {
+      memcpy(rate, &entry[BLAKE2B_BLOCK_SIZE], BALANCE_SIZE);
+      return 1;
+    }
+    if (cmp < 0) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return 0;
+}
+
+// Counts the wallet's dep at index, and adds the rate of the dep's type
+// script when the wallet has a rate table
+int charge_dep(size_t index, int uniq_script, unsigned char *script_type_hash, const RateTable *rates, uint128_t *expected_udt_pay, int *deps_with_lock_hash) {
+  *deps_with_lock_hash += 1;
+  if (uniq_script && *deps_with_lock_hash > 1) {
+    return ERROR_UNIQUE_SCRIPT_VIOLATION;
+  }
+
+  uint128_t fee = 0;
+  if (uniq_script || rates != NULL) {
+
+    CellView view;
+    int type_ret = open_cell_view(&view, index, CKB_SOURCE_CELL_DEP, CELL_VIEW_TYPE_HASH);
+    if (type_ret != CKB_SUCCESS) {
+      return ERROR_SYSCALL;
+    }
+
+    if (!view.has_type) {
+      ckb_debug("Unique script or rate table requires type hash on reusable script!");
+      return ERROR_UNIQUE_SCRIPT_MISSING_TYPE_FIELD;
+    }
+
+    if (uniq_script && !hash32_eq(script_type_hash, view.type_hash)) {
+      return ERROR_UNIQUE_SCRIPT_MISMATCH;
+    }
+
+    if (rates != NULL && !rate_table_lookup(rates, view.type_hash, &fee)) {
+      ckb_debug("REUSABLE SCRIPT HAS NO RATE IN WALLET RATE TABLE");
+      return ERROR_UNPRICED_SCRIPT;
+    }
   }
 
-  *has_sig = lock_bytes_seg.size > 0;
+  if (*expected_udt_pay + fee < *expected_udt_pay) {
+    return ERROR_OVERFLOW;
+  }
+  *expected_udt_pay += fee;
   return CKB_SUCCESS;
 }
 
-int check_deps(int uniq_script, unsigned char *script_type_hash, uint128_t* expected_udt_pay, unsigned char *lock_hash, uint128_t udt_rate) {
+int check_deps(int uniq_script, unsigned char *script_type_hash, const RateTable *rates, uint128_t* expected_udt_pay, unsigned char *lock_hash, const ReuseCoinShardFamily *family) {
 
   int i = 0;
   int deps_with_lock_hash = 0;
 
   while (1) {
-    if (uniq_script && deps_with_lock_hash > 1) {
-      return ERROR_UNIQUE_SCRIPT_VIOLATION;
-    }
-    unsigned char dep_lock_hash[BLAKE2B_BLOCK_SIZE];
-    uint64_t len = BLAKE2B_BLOCK_SIZE;
-    int ret = ckb_load_cell_by_field(dep_lock_hash, &len, 0, i,
-      CKB_SOURCE_CELL_DEP, CKB_CELL_FIELD_LOCK_HASH);
+    int is_wallet;
+    int ret = dep_is_wallet(i, family, lock_hash, &is_wallet);
     if (ret == CKB_INDEX_OUT_OF_BOUND) {
       break;
     }
     if (ret != CKB_SUCCESS) {
       return ERROR_CELL_DEP_LOAD;
     }
-    if (memcmp(lock_hash, dep_lock_hash, BLAKE2B_BLOCK_SIZE) == 0) {
-      *expected_udt_pay += udt_rate;
-      deps_with_lock_hash++;
-
-      if (uniq_script) {
+    if (is_wallet) {
+      ret = charge_dep(i, uniq_script, script_type_hash, rates, expected_udt_pay, &deps_with_lock_hash);
+      if (ret != CKB_SUCCESS) {
+        return ret;
+      }
+    }
+    i++;
+  }
+  return CKB_SUCCESS;
+}
 
-        unsigned char dep_type_hash[BLAKE2B_BLOCK_SIZE];
-        uint64_t hash_len = BLAKE2B_BLOCK_SIZE;
-        int type_ret = ckb_load_cell_by_field(dep_lock_hash, &hash_len, 0, i,
-          CKB_SOURCE_CELL_DEP, CKB_CELL_FIELD_TYPE_HASH);
+// Charges only the deps listed in the hints. Each listed dep must be locked
+// by the wallet, and every payment script proves its own code dep is listed.
+int check_hinted_deps(ReuseCoinHints *hints, int uniq_script, unsigned char *script_type_hash, const RateTable *rates, uint128_t* expected_udt_pay, unsigned char *lock_hash, const ReuseCoinShardFamily *family) {
+  int deps_with_lock_hash = 0;
+  uint32_t previous = 0;
+  mol_num_t count = reuse_coin_hint_dep_count(hints);
+
+  for (mol_num_t n = 0; n < count; n++) {
+    uint32_t index = reuse_coin_hint_dep(hints, n);
+    if (n > 0 && index <= previous) {
+      ckb_debug("HINTED DEPS MUST BE STRICTLY ASCENDING");
+      return ERROR_HINTS_ENCODING;
+    }
+    previous = index;
 
-        if (type_ret == CKB_ITEM_MISSING) {
-          ckb_debug("Unique script requires type hash on reusable script!");
-          return ERROR_UNIQUE_SCRIPT_MISSING_TYPE_FIELD;
-        }
+    int is_wallet;
+    int ret = dep_is_wallet(index, family, lock_hash, &is_wallet);
+    if (ret != CKB_SUCCESS) {
+      return ERROR_CELL_DEP_LOAD;
+    }
+    if (!is_wallet) {
+      return ERROR_HINTS_MISMATCH;
+    }
+    ret = charge_dep(index, uniq_script, script_type_hash, rates, expected_udt_pay, &deps_with_lock_hash);
+    if (ret != CKB_SUCCESS) {
+      return ret;
+    }
+  }
+  return CKB_SUCCESS;
+}
 
-        if (type_ret != CKB_SUCCESS) {
-          return ERROR_SYSCALL;
-        }
+// Records the udt amount and capacity of a wallet cell, whose type hash must
+// match the token type. Settlement wallets add up all of their cells.
+int record_wallet(CellView *view, size_t i, size_t source, int settlement, uint128_t *udt_balance, uint64_t *capacity, int *wallet_count, unsigned char *token_type) {
+  int ret = load_cell_view(view, i, source, CELL_VIEW_TYPE_HASH);
+  if (ret != CKB_SUCCESS) {
+    return ERROR_SYSCALL;
+  }
+  if (!view->has_type) {
+    ckb_debug("WALLET EXPECTED TYPE SCRIPT and did not find one");
+    return ERROR_WALLET_CELL_MISSING_TYPE;
+  }
+  if (!hash32_eq(view->type_hash, token_type)) {
+    ckb_debug("Mismatch between wallet's expected token type and actual token type");
+    return ERROR_WALLET_EXPECTS_DIFFERENT_TOKEN_TYPE;
+  }
+  *wallet_count += 1;
+  if (!settlement && *wallet_count > 1) {
+    ckb_debug("Too many wallets of same type. You can only use 1 wallet with same lock hash");
+    return ERROR_TOO_MANY_WALLETS_OF_SAME_TYPE;
+  }
 
-        if (memcmp(script_type_hash, dep_type_hash,
-          BLAKE2B_BLOCK_SIZE) != 0) {
-          return ERROR_UNIQUE_SCRIPT_MISMATCH;
-        }
-      }
-    }
-    i++;
+  // Get udt amount and ckbytes in wallet cell
+  ret = load_cell_view(view, i, source, CELL_VIEW_DATA | CELL_VIEW_CAPACITY);
+  if (ret != CKB_SUCCESS) {
+    ckb_debug("ERROR loading wallet amount and capacity");
+    return ERROR_SYSCALL;
+  }
+  if (view->data_len != DATA_SIZE) {
+    ckb_debug("ERROR IN UDT AMOUNT ON WALLET");
+    return ERROR_ENCODING;
   }
+  uint128_t udt_amt;
+  memcpy(&udt_amt, view->data, DATA_SIZE);
+  if (*udt_balance + udt_amt < *udt_balance || *capacity + view->capacity < *capacity) {
+    return ERROR_OVERFLOW;
+  }
+  *udt_balance += udt_amt;
+  *capacity += view->capacity;
   return CKB_SUCCESS;
 }
 
-int check_inputs(uint128_t *input_udt_balance, uint64_t *input_capacity, int *wallet_count, unsigned char *token_type, unsigned char *lock_hash) {
+int check_inputs(int settlement, uint128_t *input_udt_balance, uint64_t *input_capacity, int *wallet_count, unsigned char *token_type, unsigned char *lock_hash) {
   int i = 0;
   while (1) {
-
-    unsigned char type_hash[BLAKE2B_BLOCK_SIZE];
-    uint64_t len = BLAKE2B_BLOCK_SIZE;
-    int ret = ckb_load_cell_by_field(type_hash, &len, 0, i,
-      CKB_SOURCE_GROUP_INPUT, CKB_CELL_FIELD_TYPE_HASH);
+    CellView view;
+    int ret = open_cell_view(&view, i, CKB_SOURCE_GROUP_INPUT, CELL_VIEW_TYPE_HASH);
     if (ret == CKB_INDEX_OUT_OF_BOUND) {
       break;
     }
-
-    if (ret == CKB_ITEM_MISSING) {
-      return ERROR_WALLET_CELL_MISSING_TYPE;
-    }
-
     if (ret != CKB_SUCCESS) {
       return ERROR_SYSCALL;
     }
-
-
-    if (memcmp(type_hash, token_type, BLAKE2B_BLOCK_SIZE) != 0) {
-      return ERROR_WALLET_EXPECTS_DIFFERENT_TOKEN_TYPE;
-    } else {
-      
-      *wallet_count += 1;
-      if (*wallet_count > 1) {
-        ckb_debug("Too many input wallets of same type");
-        return ERROR_TOO_MANY_WALLETS_OF_SAME_TYPE;
-      }
-      // get data field in wallet and add to input_udt balance
-      ckb_debug("ADDING UDT AMOUNT FROM INPUT WALLET");
-      uint128_t udt_amt;
-      uint64_t data_len = DATA_SIZE;
-      int data_ret = ckb_load_cell_data((uint8_t *)&udt_amt, &data_len, 0, i, CKB_SOURCE_GROUP_INPUT);
-      if (data_ret != CKB_SUCCESS) {
-        return ERROR_SYSCALL;
-      }
-      if (data_len != DATA_SIZE) {
-        ckb_debug("ERROR IN UDT AMOUNT ON INPUT WALLET");
-        return ERROR_ENCODING;
-      }
-
-      *input_udt_balance = udt_amt;
-
-
-      // get input wallet's capacity
-      uint64_t ckbytes;
-      uint64_t capacity_len = CAPACITY_SIZE;
-      int ckbyte_load = ckb_checked_load_cell_by_field((uint8_t *)&ckbytes, &capacity_len,
-        0, i, CKB_SOURCE_GROUP_INPUT, CKB_CELL_FIELD_CAPACITY);
-
-      if (ckbyte_load != CKB_SUCCESS) {
-        ckb_debug("ERROR loading input wallet capacity");
-        return ERROR_SYSCALL;
-      }
-      *input_capacity = ckbytes;
+    ckb_debug("ADDING UDT AMOUNT FROM INPUT WALLET");
+    ret = record_wallet(&view, i, CKB_SOURCE_GROUP_INPUT, settlement, input_udt_balance, input_capacity, wallet_count, token_type);
+    if (ret != CKB_SUCCESS) {
+      return ret;
     }
     i++;
   }
   return CKB_SUCCESS;
 }
 
-int check_outputs(uint128_t *output_udt_balance, uint64_t *output_capacity, int *wallet_count, unsigned char *token_type, unsigned char *lock_hash) {
+int check_outputs(int settlement, uint128_t *output_udt_balance, uint64_t *output_capacity, int *wallet_count, unsigned char *token_type, unsigned char *lock_hash) {
   int i = 0;
   while (1) {
     // find output w/ this lock_hash
     // if its type hash != token_type, return error
-    unsigned char script[BLAKE2B_BLOCK_SIZE];
-    uint64_t len = BLAKE2B_BLOCK_SIZE;
-    int ret = ckb_load_cell_by_field(script, &len, 0, i, CKB_SOURCE_OUTPUT, CKB_CELL_FIELD_LOCK_HASH);
+    CellView view;
+    int ret = open_cell_view(&view, i, CKB_SOURCE_OUTPUT, CELL_VIEW_LOCK_HASH);
     if (ret == CKB_INDEX_OUT_OF_BOUND) {
       break;
     }
@@ -194,62 +362,34 @@ int check_outputs(uint128_t *output_udt_balance, uint64_t *output_capacity, int
       ckb_debug("error loading output lock hash in wallet script");
       return ERROR_SYSCALL;
     }
-    if (memcmp(script, lock_hash, BLAKE2B_BLOCK_SIZE) != 0) {
-      i++;
-      continue;
-    }
-
-    unsigned char type_script[BLAKE2B_BLOCK_SIZE];
-    uint64_t type_len = BLAKE2B_BLOCK_SIZE;
-    int type_ret = ckb_load_cell_by_field(type_script, &type_len, 0, i, CKB_SOURCE_OUTPUT, CKB_CELL_FIELD_TYPE_HASH);
-    if (type_ret == CKB_INDEX_OUT_OF_BOUND) {
-      break;
-    }
-    if (type_ret == CKB_ITEM_MISSING) {
-      ckb_debug("OUTPUT WALLET EXPECTED TYPE SCRIPT and did not find one");
-      return ERROR_WALLET_CELL_MISSING_TYPE;
-    }
-    if (type_ret != CKB_SUCCESS) {
-      ckb_debug("Unknown error in loading output wallet's type hash");
-      return type_ret;
-    }
-    if (memcmp(type_script, token_type, BLAKE2B_BLOCK_SIZE) != 0){
-      ckb_debug("Mismatch between output wallet's expected token type and actual token type");
-      return ERROR_WALLET_EXPECTS_DIFFERENT_TOKEN_TYPE;
-    }
-    *wallet_count += 1;
-    if (*wallet_count > 1) {
-      ckb_debug("Too many wallets in output. You can only use 1 wallet with same lock hash");
-      return ERROR_TOO_MANY_WALLETS_OF_SAME_TYPE;
-    }
-    // Get udt amount in wallet cell
-    uint128_t udt_amt;
-    uint64_t data_len = DATA_SIZE;
-    int data_ret = ckb_load_cell_data((uint8_t*)&udt_amt, &data_len, 0, i, CKB_SOURCE_OUTPUT);
-    if (data_ret != CKB_SUCCESS) {
-      return ERROR_SYSCALL;
-    }
-    ckb_debug("ADDING UDT AMOUNT FROM OUTPUT WALLET");
-
-    *output_udt_balance = udt_amt;
-
-
-    // Get ckbytes in wallet cell
-    uint64_t ckbytes;
-    uint64_t capacity_len = CAPACITY_SIZE;
-    int ckbyte_load = ckb_checked_load_cell_by_field((uint8_t *)&ckbytes, &capacity_len,
-      0, i, CKB_SOURCE_OUTPUT, CKB_CELL_FIELD_CAPACITY);
-
-    if (ckbyte_load != CKB_SUCCESS) {
-      ckb_debug("ERROR loading output wallet capacity");
-      return ERROR_SYSCALL;
+    if (hash32_eq(view.lock_hash, lock_hash)) {
+      ckb_debug("ADDING UDT AMOUNT FROM OUTPUT WALLET");
+      ret = record_wallet(&view, i, CKB_SOURCE_OUTPUT, settlement, output_udt_balance, output_capacity, wallet_count, token_type);
+      if (ret != CKB_SUCCESS) {
+        return ret;
+      }
     }
-    *output_capacity = ckbytes;
     i++;
   }
   return CKB_SUCCESS;
 }
 
+// Only the hinted output is inspected. Other outputs with this lock hash can
+// only be created by the payer and belong to the owner, so they cannot be
+// used to underpay.
+int check_hinted_output(ReuseCoinHints *hints, int settlement, uint128_t *output_udt_balance, uint64_t *output_capacity, int *wallet_count, unsigned char *token_type, unsigned char *lock_hash) {
+  CellView view;
+  int ret = open_cell_view(&view, hints->wallet_output, CKB_SOURCE_OUTPUT, CELL_VIEW_LOCK_HASH);
+  if (ret != CKB_SUCCESS) {
+    ckb_debug("error loading hinted output lock hash in wallet script");
+    return ERROR_SYSCALL;
+  }
+  if (!hash32_eq(view.lock_hash, lock_hash)) {
+    return ERROR_HINTS_MISMATCH;
+  }
+  return record_wallet(&view, hints->wallet_output, CKB_SOURCE_OUTPUT, settlement, output_udt_balance, output_capacity, wallet_count, token_type);
+}
+
 int main () {
   // int has_unique_script;
   ckb_debug("REUSE COIN WALLET LOCK SCRIPT EXECUTING\n");
@@ -285,53 +425,78 @@ int main () {
   mol_seg_t args_seg = MolReader_Script_get_args(&script_seg);
   mol_seg_t raw_args = MolReader_Bytes_raw_bytes(&args_seg);
 
-  if (raw_args.size < MIN_ARGS_LENGTH) {
-    ckb_debug("ARGS IN WALLET TOO SHORT");
-    return ERROR_ARGUMENTS_LEN;
-  }
-
-  if (raw_args.size > MAX_ARGS_LENGTH) {
-    ckb_debug("ARGS IN WALLET TOO LONG");
-    return ERROR_ARGUMENTS_LEN;
+  WalletArgs args;
+  int parse_ret = parse_wallet_args(&raw_args, &args);
+  if (parse_ret != CKB_SUCCESS) {
+    return parse_ret;
   }
+  uniq_mode = (args.flags & WALLET_FLAG_UNIQUE_SCRIPT) != 0;
+  int settlement_mode = (args.flags & WALLET_FLAG_SETTLEMENT) != 0;
 
-  if (raw_args.size != MIN_ARGS_LENGTH &&
-      raw_args.size != MAX_ARGS_LENGTH) {
-        ckb_debug("ARGS IN WALLET CAN ONLY BE 77 or 109 bytes long");
-        return ERROR_ARGUMENTS_LEN;
-      }
-  unsigned char pubkey_hash[BLAKE160_SIZE];
-  unsigned char ckb_rate[CAPACITY_SIZE];
-  unsigned char udt_rate[BALANCE_SIZE];
-  unsigned char token_type[BLAKE2B_BLOCK_SIZE];
-  unsigned char reusable_script_type_hash[BLAKE2B_BLOCK_SIZE];
-
-  memcpy(pubkey_hash, raw_args.ptr, BLAKE160_SIZE);
-  memcpy(ckb_rate, &raw_args.ptr[BLAKE160_SIZE], CAPACITY_SIZE);
-  memcpy(udt_rate, &raw_args.ptr[BLAKE160_SIZE + CAPACITY_SIZE], BALANCE_SIZE);
-  memcpy(token_type, &raw_args.ptr[BLAKE160_SIZE + CAPACITY_SIZE + BALANCE_SIZE], BLAKE2B_BLOCK_SIZE);
-
-  if (raw_args.size == MAX_ARGS_LENGTH) {
-    uniq_mode = 1;
-    memcpy(reusable_script_type_hash, &raw_args.ptr[MIN_ARGS_LENGTH], BLAKE2B_BLOCK_SIZE);
-  }
+  ReuseCoinShardFamily shard_family;
+  const ReuseCoinShardFamily *family = wallet_shard_family(&script_seg, &args, &shard_family);
 
+  uint64_t ckb_pay_amt = args.ckb_rate;
+  uint128_t udt_pay_amt = args.udt_rate;
 
 
-  uint64_t ckb_pay_amt = *(uint64_t *)ckb_rate;
-  uint128_t udt_pay_amt = *(uint128_t *)udt_rate;
 
 
+  // First witness of the group, loaded once for the owner and payment paths
+  WitnessContext first_witness;
+  int witness_ret = load_witness_context(&first_witness, 0, CKB_SOURCE_GROUP_INPUT);
+  if (witness_ret != CKB_SUCCESS) {
+    return witness_ret;
+  }
 
+  // Owner path. The owner may withdraw or destroy the wallet, so it is
+  // checked before any of the payment constraints.
+  if (args.flags & WALLET_FLAG_OWNER_LOCK) {
+    // Every shard sees the same owner input, so no sibling sweep is needed,
+    // and the pubkey hash is unused
+    int owner_present;
+    int owner_ret = check_owner_lock(args.owner_lock_hash, &owner_present);
+    if (owner_ret != CKB_SUCCESS) {
+      return owner_ret;
+    }
+    if (owner_present) {
+      ckb_debug("WALLET UNLOCKED BY OWNER LOCK");
+      return CKB_SUCCESS;
+    }
+  } else {
+    has_sig = first_witness.lock.size > 0;
+    if (has_sig) {
+      if (verify_owner_signature(&args, &first_witness) == CKB_SUCCESS) {
+        return CKB_SUCCESS;
+      }
+      if (family != NULL) {
+        ckb_debug("INVALID OWNER SIGNATURE ON WALLET SHARD");
+        return ERROR_WALLET_UNLOCK;
+      }
+    } else if (family != NULL) {
+      int signed_sibling;
+      int sibling_ret = check_signed_sibling(family, lock_hash, &signed_sibling);
+      if (sibling_ret != CKB_SUCCESS) {
+        return sibling_ret;
+      }
+      if (signed_sibling) {
+        ckb_debug("SHARD SWEPT ALONG WITH SIGNED SIBLING");
+        return CKB_SUCCESS;
+      }
+    }
+  }
 
-  int sig_check_ret = has_signature(&has_sig);
 
-  if (sig_check_ret != CKB_SUCCESS) {
-    return sig_check_ret;
+  // Optional index hints in the input_type of the group's first witness,
+  // which load_witness_context has already verified
+  ReuseCoinHints hints;
+  int hints_ret = reuse_coin_parse_hints_seg(
+      first_witness.has_input_type ? &first_witness.input_type : NULL, &hints);
+  if (hints_ret != CKB_SUCCESS) {
+    return hints_ret;
   }
 
-
-  uint128_t expected_udt_pay = udt_pay_amt;
+  uint128_t expected_udt_pay = 0;
   uint128_t input_udt_balance = 0;
   uint128_t output_udt_balance = 0;
   uint64_t input_wallet_capacity = 0;
@@ -345,10 +510,30 @@ int main () {
       // and that dep cell's type script matches reusable script type hash
       // else
       // add expected amount for each dep cell found with this lock hash
-    int dep_check = check_deps(uniq_mode, reusable_script_type_hash, &expected_udt_pay, lock_hash, udt_pay_amt);
+    RateTable rate_table;
+    RateTable *rates = NULL;
+    if (args.flags & WALLET_FLAG_RATE_TABLE) {
+      int table_ret = load_rate_table(args.rate_table_hash, &rate_table);
+      if (table_ret != CKB_SUCCESS) {
+        return table_ret;
+      }
+      rates = &rate_table;
+    }
+
+    int dep_check;
+    if (hints.present) {
+      dep_check = check_hinted_deps(&hints, uniq_mode, args.reusable_script_type_hash, rates, &expected_udt_pay, lock_hash, family);
+    } else {
+      dep_check = check_deps(uniq_mode, args.reusable_script_type_hash, rates, &expected_udt_pay, lock_hash, family);
+    }
     if (dep_check != CKB_SUCCESS) {
       return dep_check;
     }
+    // Only a rate table prices each dep. Other wallets take the flat udt_rate
+    // once per transaction, as does a deposit that uses no priced script.
+    if (expected_udt_pay == 0) {
+      expected_udt_pay = udt_pay_amt;
+    }
 
     ckb_debug("AFTER DEP CHECK");
     // loop through inputs
@@ -357,7 +542,7 @@ int main () {
     // record udt_in_amt and increment wallet count
     // record capacity amount
     ckb_debug("BEFORE INPUT CHECK");
-    int input_check = check_inputs(&input_udt_balance, &input_wallet_capacity, &input_wallet_count, token_type, lock_hash);
+    int input_check = check_inputs(settlement_mode, &input_udt_balance, &input_wallet_capacity, &input_wallet_count, args.token_type, lock_hash);
     if (input_check != CKB_SUCCESS) {
       return input_check;
     }
@@ -371,7 +556,12 @@ int main () {
     // record udt_out_amt and increment wallet count
     // record capacity amount
     ckb_debug("BEFORE OUPUT CHECK");
-    int output_check = check_outputs(&output_udt_balance, &output_wallet_capacity, &output_wallet_count, token_type, lock_hash);
+    int output_check;
+    if (hints.present) {
+      output_check = check_hinted_output(&hints, settlement_mode, &output_udt_balance, &output_wallet_capacity, &output_wallet_count, args.token_type, lock_hash);
+    } else {
+      output_check = check_outputs(settlement_mode, &output_udt_balance, &output_wallet_capacity, &output_wallet_count, args.token_type, lock_hash);
+    }
     if (output_check != CKB_SUCCESS) {
       return output_check;
     }
@@ -389,19 +579,16 @@ int main () {
                             ckb_pay_amt);
     int udt_amt_correct = (output_udt_balance > input_udt_balance) &&
                           ((output_udt_balance - input_udt_balance) >=
-                          udt_pay_amt);
+                          expected_udt_pay);
 
-    int wallet_count_correct = (output_wallet_count == 1 && input_wallet_count == 1);
+    int wallet_count_correct = settlement_mode ||
+                               (output_wallet_count == 1 && input_wallet_count == 1);
 
 
-    if (has_sig && verify_secp256k1_blake160_sighash_all(pubkey_hash) == CKB_SUCCESS) {
+    if (capacity_correct && udt_amt_correct && wallet_count_correct) {
       return CKB_SUCCESS;
     } else {
-      if (capacity_correct && udt_amt_correct && wallet_count_correct) {
-        return CKB_SUCCESS;
-      } else {
-        return ERROR_WALLET_UNLOCK;
-      }
+      return ERROR_WALLET_UNLOCK;
     }
 }
 
@@ -413,6 +600,7 @@ int main () {
   conditions (possible states the script can be in):
     has_sig -- Denotes if the input locked by this script has a signature attached to it
     has_unique_script -- Denotes if the wallet has a single script associated with this wallet
+    is_sharded -- Denotes if the wallet is one of several shards sharing owner, rates and token
 
   attributes (elements of the script's state):
     token_type: Denotes the type hash of the token that this wallet stores. The reason for this is that
@@ -420,12 +608,21 @@ int main () {
     udt_rate:   Denotes the amount of token that must be transferred to this wallet in a transaction
     reuse_script_hash: Denotes the script that this wallet is associated with IF the developer wants to
                         only allow funds from the use of a specific script to be stored in this wallet
-    pubkey_hash: Denotes the pubkey_hash of the owner of the wallet who is allowed to withdraw the funds
+    rate_table_hash: Optional. Denotes the data hash of a cell dep holding a sorted table of script type
+                     hashes and their udt rates, so one wallet can price many scripts differently
+    pubkey_hash: Denotes the pubkey_hash of the owner of the wallet who is allowed to withdraw the funds.
+                 With the schnorr flag it is the hash of a BIP340 x-only pubkey, and the owner's witness
+                 lock holds that pubkey followed by a Schnorr signature
+    owner_lock_hash: Optional. Denotes the lock hash of a cell owned by the wallet's owner. When set, the
+                     owner withdraws by spending such a cell in the same transaction and pubkey_hash is unused
+    shard_index: Distinguishes the shards of a sharded wallet. Payers may settle against any shard, so
+                 several payments can land in the same block without contending on one cell
 
 
     constraints:
       Funds Amount: The amount transferred to this wallet is equal to:
-                    (# of scripts associated w/ this wallet) * udt_rate
+                    udt_rate once per transaction, or with a rate table, the sum of each
+                    used script's rate from the table. A deposit with no script pays udt_rate
       Minimum_positive_deposit: If the wallet is not being unlocked by owner,
                                 then output w/ same lock hash must have capacity
                                  == prev_capacity + ckb_rate AND udt_amount ==
@@ -435,7 +632,17 @@ int main () {
       Exact_LockType_Combinations: For each wallet cell in input, there must be exactly one wallet cell
                                   in output with the same lock hash
       Max_Input_Wallets_of_Type: For any cell in inputs, if that cell is a wallet cell,
-                                 then no other input cell has the same lock hash
+                                 then no other input cell has the same lock hash, unless the
+                                 wallet is a settlement wallet. Settlement wallets sum the amounts
+                                 and capacities of all their cells in inputs and in outputs
+      Shard_Sweep: A shard without a signature may be unlocked if the first input of another
+                   shard of the same wallet carries the owner's signature. Sharded wallets reject
+                   invalid signatures instead of falling back to the payment path, so the owner
+                   can consolidate all shards in one transaction while signing only once
+
+      Owner_Lock: If the wallet has an owner lock hash, any input with that lock hash unlocks the
+                  wallet. The owner's signature is checked once by that lock, so many wallets can be
+                  swept without a secp256k1 verification each
 
       Uses:
         1. Many to one: Many scripts' usage fees deposited into same wallet
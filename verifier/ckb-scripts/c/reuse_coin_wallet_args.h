@@ -0,0 +1,179 @@
+#ifndef REUSE_COIN_WALLET_ARGS_H_
+#define REUSE_COIN_WALLET_ARGS_H_
+
+// Cell wallet args and owner checks, shared by the cell wallet lock, the
+// receipt lock, which only lets the wallet's owner consolidate receipts, and
+// the credit type, which must know which deps the wallet charges for.
+//
+// common.h has no include guard, so it must be included before this file.
+#include "blockchain.h"
+#include "reuse_coin_shard.h"
+
+#define BLAKE2B_BLOCK_SIZE 32
+#define BLAKE160_SIZE 20
+#define BALANCE_SIZE 16
+#define CAPACITY_SIZE 8
+#define MIN_ARGS_LENGTH (BLAKE160_SIZE + CAPACITY_SIZE + BALANCE_SIZE + BLAKE2B_BLOCK_SIZE)
+#define MAX_ARGS_LENGTH (MIN_ARGS_LENGTH + BLAKE2B_BLOCK_SIZE)
+#define WALLET_FLAGS_SIZE 1
+
+// Extended args: the 76 base bytes, a flags byte, then each optional field
+// whose flag is set: unique script type hash, owner lock hash, rate table
+// data hash, shard index.
+// The shard index is always last so that all shards of a wallet share a
+// common args prefix.
+#define WALLET_FLAG_UNIQUE_SCRIPT 0x01
+#define WALLET_FLAG_SHARDED 0x02
+#define WALLET_FLAG_OWNER_LOCK 0x04
+#define WALLET_FLAG_RATE_TABLE 0x08
+// Allows several wallet cells with the same lock hash in a transaction. Their
+// balances and capacities are settled in aggregate. Has no args field.
+#define WALLET_FLAG_SETTLEMENT 0x10
+// The owner signs with BIP340 Schnorr instead of recoverable ECDSA, and
+// pubkey_hash is the blake160 of the x-only pubkey. Has no args field.
+#define WALLET_FLAG_SCHNORR 0x20
+#define WALLET_KNOWN_FLAGS (WALLET_FLAG_UNIQUE_SCRIPT | WALLET_FLAG_SHARDED | WALLET_FLAG_OWNER_LOCK | WALLET_FLAG_RATE_TABLE | WALLET_FLAG_SETTLEMENT | WALLET_FLAG_SCHNORR)
+
+typedef unsigned __int128 uint128_t;
+
+typedef struct {
+  unsigned char pubkey_hash[BLAKE160_SIZE];
+  uint64_t ckb_rate;
+  uint128_t udt_rate;
+  unsigned char token_type[BLAKE2B_BLOCK_SIZE];
+  uint8_t flags;
+  unsigned char reusable_script_type_hash[BLAKE2B_BLOCK_SIZE];
+  unsigned char owner_lock_hash[BLAKE2B_BLOCK_SIZE];
+  unsigned char rate_table_hash[BLAKE2B_BLOCK_SIZE];
+  uint32_t shard_index;
+} WalletArgs;
+
+int parse_wallet_args(mol_seg_t *raw_args, WalletArgs *args) {
+  if (raw_args->size < MIN_ARGS_LENGTH) {
+    ckb_debug("ARGS IN WALLET TOO SHORT");
+    return ERROR_ARGUMENTS_LEN;
+  }
+
+  memcpy(args->pubkey_hash, raw_args->ptr, BLAKE160_SIZE);
+  memcpy(&args->ckb_rate, &raw_args->ptr[BLAKE160_SIZE], CAPACITY_SIZE);
+  memcpy(&args->udt_rate, &raw_args->ptr[BLAKE160_SIZE + CAPACITY_SIZE], BALANCE_SIZE);
+  memcpy(args->token_type, &raw_args->ptr[BLAKE160_SIZE + CAPACITY_SIZE + BALANCE_SIZE], BLAKE2B_BLOCK_SIZE);
+  args->flags = 0;
+  args->shard_index = 0;
+
+  // Legacy layouts without a flags byte
+  if (raw_args->size == MIN_ARGS_LENGTH) {
+    return CKB_SUCCESS;
+  }
+  if (raw_args->size == MAX_ARGS_LENGTH) {
+    args->flags = WALLET_FLAG_UNIQUE_SCRIPT;
+    memcpy(args->reusable_script_type_hash, &raw_args->ptr[MIN_ARGS_LENGTH], BLAKE2B_BLOCK_SIZE);
+    return CKB_SUCCESS;
+  }
+
+  args->flags = raw_args->ptr[MIN_ARGS_LENGTH];
+  if ((args->flags & ~WALLET_KNOWN_FLAGS) != 0) {
+    ckb_debug("UNKNOWN WALLET FLAGS");
+    return ERROR_ARGUMENTS_LEN;
+  }
+
+  size_t offset = MIN_ARGS_LENGTH + WALLET_FLAGS_SIZE;
+  size_t expected_len = offset;
+  if (args->flags & WALLET_FLAG_UNIQUE_SCRIPT) {
+    expected_len += BLAKE2B_BLOCK_SIZE;
+  }
+  if (args->flags & WALLET_FLAG_OWNER_LOCK) {
+    expected_len += BLAKE2B_BLOCK_SIZE;
+  }
+  if (args->flags & WALLET_FLAG_RATE_TABLE) {
+    expected_len += BLAKE2B_BLOCK_SIZE;
+  }
+  if (args->flags & WALLET_FLAG_SHARDED) {
+    expected_len += SHARD_INDEX_SIZE;
+  }
+  if (raw_args->size != expected_len) {
+    ckb_debug("ARGS IN WALLET DO NOT MATCH WALLET FLAGS");
+    return ERROR_ARGUMENTS_LEN;
+  }
+  // A unique script wallet has a single rate already
+  if ((args->flags & WALLET_FLAG_UNIQUE_SCRIPT) && (args->flags & WALLET_FLAG_RATE_TABLE)) {
+    ckb_debug("UNIQUE SCRIPT WALLETS CANNOT HAVE A RATE TABLE");
+    return ERROR_ARGUMENTS_LEN;
+  }
+
+  if (args->flags & WALLET_FLAG_UNIQUE_SCRIPT) {
+    memcpy(args->reusable_script_type_hash, &raw_args->ptr[offset], BLAKE2B_BLOCK_SIZE);
+    offset += BLAKE2B_BLOCK_SIZE;
+  }
+  if (args->flags & WALLET_FLAG_OWNER_LOCK) {
+    memcpy(args->owner_lock_hash, &raw_args->ptr[offset], BLAKE2B_BLOCK_SIZE);
+    offset += BLAKE2B_BLOCK_SIZE;
+  }
+  if (args->flags & WALLET_FLAG_RATE_TABLE) {
+    memcpy(args->rate_table_hash, &raw_args->ptr[offset], BLAKE2B_BLOCK_SIZE);
+    offset += BLAKE2B_BLOCK_SIZE;
+  }
+  if (args->flags & WALLET_FLAG_SHARDED) {
+    memcpy(&args->shard_index, &raw_args->ptr[offset], SHARD_INDEX_SIZE);
+  }
+  return CKB_SUCCESS;
+}
+
+// Every shard shares the wallet's code, hash type and args up to the trailing
+// shard index. Returns NULL for a wallet that is not sharded.
+const ReuseCoinShardFamily *wallet_shard_family(mol_seg_t *script_seg, WalletArgs *args,
+                                                ReuseCoinShardFamily *family) {
+  if (!(args->flags & WALLET_FLAG_SHARDED)) {
+    return NULL;
+  }
+  mol_seg_t code_hash_seg = MolReader_Script_get_code_hash(script_seg);
+  mol_seg_t hash_type_seg = MolReader_Script_get_hash_type(script_seg);
+  mol_seg_t args_seg = MolReader_Script_get_args(script_seg);
+  mol_seg_t raw_args = MolReader_Bytes_raw_bytes(&args_seg);
+  family->code_hash = code_hash_seg.ptr;
+  family->hash_type = *hash_type_seg.ptr;
+  family->args_prefix = raw_args.ptr;
+  family->args_prefix_len = raw_args.size - SHARD_INDEX_SIZE;
+  return family;
+}
+
+// A dep is counted if it is locked by this wallet, or by any shard of the
+// wallet when family is not NULL
+int dep_is_wallet(size_t index, const ReuseCoinShardFamily *family, unsigned char *lock_hash, int *is_wallet) {
+  if (family != NULL) {
+    return reuse_coin_cell_is_shard(index, CKB_SOURCE_CELL_DEP, family, is_wallet);
+  }
+  CellView view;
+  int ret = open_cell_view(&view, index, CKB_SOURCE_CELL_DEP, CELL_VIEW_LOCK_HASH);
+  if (ret != CKB_SUCCESS) {
+    return ret;
+  }
+  *is_wallet = hash32_eq(lock_hash, view.lock_hash);
+  return CKB_SUCCESS;
+}
+
+// The owner of a wallet with an owner lock hash unlocks it by spending any
+// cell with that lock in the same transaction, the same way sudt.c grants
+// its governance script permission. The owner lock does the signature check.
+int check_owner_lock(unsigned char *owner_lock_hash, int *owner_present) {
+  *owner_present = 0;
+  int i = 0;
+  while (1) {
+    CellView view;
+    int ret = open_cell_view(&view, i, CKB_SOURCE_INPUT, CELL_VIEW_LOCK_HASH);
+    if (ret == CKB_INDEX_OUT_OF_BOUND) {
+      break;
+    }
+    if (ret != CKB_SUCCESS) {
+      return ERROR_SYSCALL;
+    }
+    if (hash32_eq(view.lock_hash, owner_lock_hash)) {
+      *owner_present = 1;
+      break;
+    }
+    i++;
+  }
+  return CKB_SUCCESS;
+}
+
+#endif /* REUSE_COIN_WALLET_ARGS_H_ */
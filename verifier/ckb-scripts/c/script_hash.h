@@ -0,0 +1,40 @@
+#ifndef CKB_SCRIPT_HASH_H_
+#define CKB_SCRIPT_HASH_H_
+
+// Hash of a Script built from its parts.
+//
+// When a script knows exactly which type script it is looking for, it can
+// hash that script once and compare it with CKB_CELL_FIELD_TYPE_HASH of each
+// cell, instead of loading and parsing every cell's full type script.
+//
+// blake2b.h has no include guard, so it must be included before this file.
+
+#define SCRIPT_HASH_SIZE 32
+#define SCRIPT_CODE_HASH_SIZE 32
+#define SCRIPT_HASH_TYPE_SIZE 1
+// Molecule table header of Script: total size and 3 field offsets
+#define SCRIPT_HEADER_SIZE 16
+
+// Hashes the molecule serialization of
+// Script { code_hash, hash_type, args }, which is what CKB returns as the
+// script hash
+void calculate_script_hash(const uint8_t *code_hash, uint8_t hash_type,
+                           const uint8_t *args, uint32_t args_len,
+                           uint8_t *hash) {
+  uint32_t header[4];
+  header[1] = SCRIPT_HEADER_SIZE;
+  header[2] = header[1] + SCRIPT_CODE_HASH_SIZE;
+  header[3] = header[2] + SCRIPT_HASH_TYPE_SIZE;
+  header[0] = header[3] + sizeof(uint32_t) + args_len;
+
+  blake2b_state blake2b_ctx;
+  blake2b_init(&blake2b_ctx, SCRIPT_HASH_SIZE);
+  blake2b_update(&blake2b_ctx, header, SCRIPT_HEADER_SIZE);
+  blake2b_update(&blake2b_ctx, code_hash, SCRIPT_CODE_HASH_SIZE);
+  blake2b_update(&blake2b_ctx, &hash_type, SCRIPT_HASH_TYPE_SIZE);
+  blake2b_update(&blake2b_ctx, &args_len, sizeof(uint32_t));
+  blake2b_update(&blake2b_ctx, args, args_len);
+  blake2b_final(&blake2b_ctx, hash, SCRIPT_HASH_SIZE);
+}
+
+#endif /* CKB_SCRIPT_HASH_H_ */
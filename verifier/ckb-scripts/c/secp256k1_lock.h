@@ -4,54 +4,64 @@
 #define BLAKE2B_BLOCK_SIZE 32
 #define BLAKE160_SIZE 20
 #define PUBKEY_SIZE 33
-#define TEMP_SIZE 32768
 #define RECID_INDEX 64
 /* 32 KB */
 #define MAX_WITNESS_SIZE 32768
 #define SCRIPT_SIZE 32768
 #define SIGNATURE_SIZE 65
-
-#if (MAX_WITNESS_SIZE > TEMP_SIZE) || (SCRIPT_SIZE > TEMP_SIZE)
-#error "Temp buffer is not big enough!"
-#endif
+/* BIP340 locks carry the x-only pubkey, then the signature */
+#define SCHNORR_LOCK_SIZE (SCHNORR_PUBKEY_SIZE + SCHNORR_SIGNATURE_SIZE)
+#define MAX_LOCK_SIZE SCHNORR_LOCK_SIZE
+/* Witnesses are hashed in chunks of this size, so they may be of any size */
+#define WITNESS_CHUNK_SIZE 4096
 
 /*
- * Arguments:
- * pubkey blake160 hash, blake2b hash of pubkey first 20 bytes, used to
- * shield the real pubkey.
- *
- * Witness:
- * WitnessArgs with a signature in lock field used to present ownership.
+ * Digests the length and content of the witness at index, loading it chunk by
+ * chunk through the syscall offset. Returns CKB_INDEX_OUT_OF_BOUND past the
+ * last witness.
  */
-int verify_secp256k1_blake160_sighash_all(unsigned char pubkey_hash[BLAKE160_SIZE]) {
-  int ret;
-  uint64_t len = 0;
-  unsigned char temp[TEMP_SIZE];
-  unsigned char lock_bytes[SIGNATURE_SIZE];
-
-  /* Load witness of first input */
-  uint64_t witness_len = MAX_WITNESS_SIZE;
-  ret = ckb_load_witness(temp, &witness_len, 0, 0, CKB_SOURCE_GROUP_INPUT);
+int blake2b_update_witness(blake2b_state *blake2b_ctx, size_t index, size_t source) {
+  unsigned char chunk[WITNESS_CHUNK_SIZE];
+  uint64_t len = WITNESS_CHUNK_SIZE;
+  int ret = ckb_load_witness(chunk, &len, 0, index, source);
   if (ret != CKB_SUCCESS) {
-    return ERROR_SYSCALL;
-  }
-
-  if (witness_len > MAX_WITNESS_SIZE) {
-    return ERROR_WITNESS_SIZE;
+    return ret;
   }
+  /* len is the full witness length, whatever the chunk size */
+  uint64_t witness_len = len;
+  blake2b_update(blake2b_ctx, (char *)&witness_len, sizeof(uint64_t));
 
-  /* load signature */
-  mol_seg_t lock_bytes_seg;
-  ret = extract_witness_lock(temp, witness_len, &lock_bytes_seg);
-  if (ret != 0) {
-    ckb_debug("ERROR ENCODING IN EXTRACT WITNESS LOCK INSIDE SECP SCRIPT");
-    return ERROR_ENCODING;
+  uint64_t offset = 0;
+  while (1) {
+    uint64_t chunk_len = len < WITNESS_CHUNK_SIZE ? len : WITNESS_CHUNK_SIZE;
+    blake2b_update(blake2b_ctx, chunk, chunk_len);
+    offset += chunk_len;
+    if (offset >= witness_len) {
+      break;
+    }
+    len = WITNESS_CHUNK_SIZE;
+    ret = ckb_load_witness(chunk, &len, offset, index, source);
+    if (ret != CKB_SUCCESS) {
+      return ERROR_SYSCALL;
+    }
   }
+  return CKB_SUCCESS;
+}
 
-  if (lock_bytes_seg.size != SIGNATURE_SIZE) {
+/*
+ * Computes the sighash all message: the tx hash, then the first witness of
+ * the script group with its lock field read as zeros, then the rest of the
+ * group's witnesses and the witnesses not covered by inputs. The lock field
+ * must be at most MAX_LOCK_SIZE bytes and the loaded witness is not modified.
+ */
+int calculate_sighash_all(WitnessContext *first_witness,
+                          unsigned char message[BLAKE2B_BLOCK_SIZE]) {
+  int ret;
+  uint64_t len = 0;
+  mol_seg_t lock_bytes_seg = first_witness->lock;
+  if (lock_bytes_seg.size > MAX_LOCK_SIZE) {
     return ERROR_ARGUMENTS_LEN;
   }
-  memcpy(lock_bytes, lock_bytes_seg.ptr, lock_bytes_seg.size);
 
   /* Load tx hash */
   unsigned char tx_hash[BLAKE2B_BLOCK_SIZE];
@@ -65,53 +75,77 @@ int verify_secp256k1_blake160_sighash_all(unsigned char pubkey_hash[BLAKE160_SIZ
   }
 
   /* Prepare sign message */
-  unsigned char message[BLAKE2B_BLOCK_SIZE];
   blake2b_state blake2b_ctx;
   blake2b_init(&blake2b_ctx, BLAKE2B_BLOCK_SIZE);
   blake2b_update(&blake2b_ctx, tx_hash, BLAKE2B_BLOCK_SIZE);
 
-  /* Clear lock field to zero, then digest the first witness */
-  memset((void *)lock_bytes_seg.ptr, 0, lock_bytes_seg.size);
-  blake2b_update(&blake2b_ctx, (char *)&witness_len, sizeof(uint64_t));
-  blake2b_update(&blake2b_ctx, temp, witness_len);
+  /* Digest the first witness with its lock field read as zeros */
+  unsigned char zero_lock[MAX_LOCK_SIZE];
+  memset(zero_lock, 0, MAX_LOCK_SIZE);
+  uint64_t lock_offset = lock_bytes_seg.ptr - first_witness->witness;
+  uint64_t lock_end = lock_offset + lock_bytes_seg.size;
+  blake2b_update(&blake2b_ctx, (char *)&first_witness->len, sizeof(uint64_t));
+  blake2b_update(&blake2b_ctx, first_witness->witness, lock_offset);
+  blake2b_update(&blake2b_ctx, zero_lock, lock_bytes_seg.size);
+  blake2b_update(&blake2b_ctx, &first_witness->witness[lock_end],
+                 first_witness->len - lock_end);
 
   /* Digest same group witnesses */
   size_t i = 1;
   while (1) {
-    len = MAX_WITNESS_SIZE;
-    ret = ckb_load_witness(temp, &len, 0, i, CKB_SOURCE_GROUP_INPUT);
+    ret = blake2b_update_witness(&blake2b_ctx, i, CKB_SOURCE_GROUP_INPUT);
     if (ret == CKB_INDEX_OUT_OF_BOUND) {
       break;
     }
     if (ret != CKB_SUCCESS) {
       return ERROR_SYSCALL;
     }
-    if (len > MAX_WITNESS_SIZE) {
-      return ERROR_WITNESS_SIZE;
-    }
-    blake2b_update(&blake2b_ctx, (char *)&len, sizeof(uint64_t));
-    blake2b_update(&blake2b_ctx, temp, len);
     i += 1;
   }
   /* Digest witnesses that not covered by inputs */
   i = calculate_inputs_len();
   while (1) {
-    len = MAX_WITNESS_SIZE;
-    ret = ckb_load_witness(temp, &len, 0, i, CKB_SOURCE_INPUT);
+    ret = blake2b_update_witness(&blake2b_ctx, i, CKB_SOURCE_INPUT);
     if (ret == CKB_INDEX_OUT_OF_BOUND) {
       break;
     }
     if (ret != CKB_SUCCESS) {
       return ERROR_SYSCALL;
     }
-    if (len > MAX_WITNESS_SIZE) {
-      return ERROR_WITNESS_SIZE;
-    }
-    blake2b_update(&blake2b_ctx, (char *)&len, sizeof(uint64_t));
-    blake2b_update(&blake2b_ctx, temp, len);
     i += 1;
   }
   blake2b_final(&blake2b_ctx, message, BLAKE2B_BLOCK_SIZE);
+  return CKB_SUCCESS;
+}
+
+/*
+ * Arguments:
+ * pubkey blake160 hash, blake2b hash of pubkey first 20 bytes, used to
+ * shield the real pubkey.
+ *
+ * Witness:
+ * WitnessArgs with a signature in lock field used to present ownership.
+ * first_witness is the already loaded first witness of the script group.
+ * Its lock field is hashed as zeros without modifying the loaded witness.
+ */
+int verify_secp256k1_blake160_sighash_all(unsigned char pubkey_hash[BLAKE160_SIZE],
+                                          WitnessContext *first_witness) {
+  int ret;
+  unsigned char temp[BLAKE2B_BLOCK_SIZE];
+  unsigned char lock_bytes[SIGNATURE_SIZE];
+
+  /* load signature */
+  mol_seg_t lock_bytes_seg = first_witness->lock;
+  if (lock_bytes_seg.size != SIGNATURE_SIZE) {
+    return ERROR_ARGUMENTS_LEN;
+  }
+  memcpy(lock_bytes, lock_bytes_seg.ptr, lock_bytes_seg.size);
+
+  unsigned char message[BLAKE2B_BLOCK_SIZE];
+  ret = calculate_sighash_all(first_witness, message);
+  if (ret != CKB_SUCCESS) {
+    return ret;
+  }
 
   /* Load signature */
   secp256k1_context context;
@@ -134,14 +168,16 @@ int verify_secp256k1_blake160_sighash_all(unsigned char pubkey_hash[BLAKE160_SIZ
   }
 
   /* Check pubkey hash */
+  unsigned char pubkey_bytes[PUBKEY_SIZE];
   size_t pubkey_size = PUBKEY_SIZE;
-  if (secp256k1_ec_pubkey_serialize(&context, temp, &pubkey_size, &pubkey,
+  if (secp256k1_ec_pubkey_serialize(&context, pubkey_bytes, &pubkey_size, &pubkey,
                                     SECP256K1_EC_COMPRESSED) != 1) {
     return ERROR_SECP_SERIALIZE_PUBKEY;
   }
 
+  blake2b_state blake2b_ctx;
   blake2b_init(&blake2b_ctx, BLAKE2B_BLOCK_SIZE);
-  blake2b_update(&blake2b_ctx, temp, pubkey_size);
+  blake2b_update(&blake2b_ctx, pubkey_bytes, pubkey_size);
   blake2b_final(&blake2b_ctx, temp, BLAKE2B_BLOCK_SIZE);
 
   if (memcmp(pubkey_hash, temp, BLAKE160_SIZE) != 0) {
@@ -151,4 +187,51 @@ int verify_secp256k1_blake160_sighash_all(unsigned char pubkey_hash[BLAKE160_SIZ
   return 0;
 }
 
+/*
+ * Same as verify_secp256k1_blake160_sighash_all, for a BIP340 Schnorr
+ * signature. The lock field holds the 32 byte x-only pubkey followed by the
+ * 64 byte signature, and the blake160 of the x-only pubkey must match
+ * pubkey_hash.
+ */
+int verify_schnorr_blake160_sighash_all(unsigned char pubkey_hash[BLAKE160_SIZE],
+                                        WitnessContext *first_witness) {
+  int ret;
+  unsigned char temp[BLAKE2B_BLOCK_SIZE];
+  unsigned char lock_bytes[SCHNORR_LOCK_SIZE];
+
+  mol_seg_t lock_bytes_seg = first_witness->lock;
+  if (lock_bytes_seg.size != SCHNORR_LOCK_SIZE) {
+    return ERROR_ARGUMENTS_LEN;
+  }
+  memcpy(lock_bytes, lock_bytes_seg.ptr, lock_bytes_seg.size);
+
+  /* Check pubkey hash before paying for the signature check */
+  blake2b_state blake2b_ctx;
+  blake2b_init(&blake2b_ctx, BLAKE2B_BLOCK_SIZE);
+  blake2b_update(&blake2b_ctx, lock_bytes, SCHNORR_PUBKEY_SIZE);
+  blake2b_final(&blake2b_ctx, temp, BLAKE2B_BLOCK_SIZE);
+  if (memcmp(pubkey_hash, temp, BLAKE160_SIZE) != 0) {
+    return ERROR_PUBKEY_BLAKE160_HASH;
+  }
+
+  unsigned char message[BLAKE2B_BLOCK_SIZE];
+  ret = calculate_sighash_all(first_witness, message);
+  if (ret != CKB_SUCCESS) {
+    return ret;
+  }
+
+  secp256k1_context context;
+  uint8_t secp_data[CKB_SECP256K1_DATA_SIZE];
+  ret = ckb_secp256k1_custom_verify_only_initialize(&context, secp_data);
+  if (ret != 0) {
+    return ret;
+  }
+
+  if (ckb_schnorr_verify(&context, &lock_bytes[SCHNORR_PUBKEY_SIZE], message,
+                         lock_bytes) != 1) {
+    return ERROR_SECP_VERIFICATION;
+  }
+  return 0;
+}
+
 #endif /* CKB_LOCK_UTILS_H_ */
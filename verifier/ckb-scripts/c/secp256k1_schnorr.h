@@ -0,0 +1,87 @@
+#ifndef CKB_SECP256K1_SCHNORR_H_
+#define CKB_SECP256K1_SCHNORR_H_
+
+/*
+ * BIP340 Schnorr signature verification, built on the secp256k1 internals
+ * included by secp256k1_helper.h.
+ *
+ * Public keys are the 32 byte x coordinate of a point with an even y.
+ * Signatures are the 32 byte x coordinate of R followed by the 32 byte
+ * scalar s.
+ */
+#define SCHNORR_PUBKEY_SIZE 32
+#define SCHNORR_SIGNATURE_SIZE 64
+
+static const unsigned char schnorr_challenge_tag[17] = {
+  'B', 'I', 'P', '0', '3', '4', '0', '/',
+  'c', 'h', 'a', 'l', 'l', 'e', 'n', 'g', 'e'};
+
+/* Starts sha256(sha256(tag) || sha256(tag) || ...) */
+void schnorr_tagged_hash_init(secp256k1_sha256 *sha, const unsigned char *tag,
+                              size_t tag_len) {
+  unsigned char tag_hash[32];
+  secp256k1_sha256_initialize(sha);
+  secp256k1_sha256_write(sha, tag, tag_len);
+  secp256k1_sha256_finalize(sha, tag_hash);
+
+  secp256k1_sha256_initialize(sha);
+  secp256k1_sha256_write(sha, tag_hash, 32);
+  secp256k1_sha256_write(sha, tag_hash, 32);
+}
+
+/*
+ * Returns 1 when sig64 is a valid signature of msg32 under pubkey32, 0
+ * otherwise. Checks s*G - e*P == R, where e is the challenge hash of
+ * R.x || P.x || msg32, with a single ecmult.
+ */
+int ckb_schnorr_verify(const secp256k1_context *ctx, const unsigned char *sig64,
+                       const unsigned char *msg32, const unsigned char *pubkey32) {
+  secp256k1_fe rx;
+  secp256k1_fe px;
+  secp256k1_ge pk;
+  secp256k1_scalar s;
+  secp256k1_scalar e;
+  int overflow;
+
+  if (!secp256k1_fe_set_b32(&rx, sig64)) {
+    return 0;
+  }
+  secp256k1_scalar_set_b32(&s, &sig64[32], &overflow);
+  if (overflow) {
+    return 0;
+  }
+  /* The point with an even y, which is the one the key commits to */
+  if (!secp256k1_fe_set_b32(&px, pubkey32) ||
+      !secp256k1_ge_set_xo_var(&pk, &px, 0)) {
+    return 0;
+  }
+
+  unsigned char challenge[32];
+  secp256k1_sha256 sha;
+  schnorr_tagged_hash_init(&sha, schnorr_challenge_tag,
+                           sizeof(schnorr_challenge_tag));
+  secp256k1_sha256_write(&sha, sig64, 32);
+  secp256k1_sha256_write(&sha, pubkey32, 32);
+  secp256k1_sha256_write(&sha, msg32, 32);
+  secp256k1_sha256_finalize(&sha, challenge);
+  /* e is the challenge reduced mod n, overflow is expected */
+  secp256k1_scalar_set_b32(&e, challenge, NULL);
+  secp256k1_scalar_negate(&e, &e);
+
+  secp256k1_gej pkj;
+  secp256k1_gej rj;
+  secp256k1_ge r;
+  secp256k1_gej_set_ge(&pkj, &pk);
+  secp256k1_ecmult(&ctx->ecmult_ctx, &rj, &pkj, &e, &s);
+  if (secp256k1_gej_is_infinity(&rj)) {
+    return 0;
+  }
+  secp256k1_ge_set_gej_var(&r, &rj);
+  secp256k1_fe_normalize_var(&r.y);
+  if (secp256k1_fe_is_odd(&r.y)) {
+    return 0;
+  }
+  return secp256k1_fe_equal_var(&rx, &r.x);
+}
+
+#endif /* CKB_SECP256K1_SCHNORR_H_ */
@@ -0,0 +1,35 @@
+// Owner signature verification of the cell wallet lock, built as a shared
+// library for ckb_dlopen.
+//
+// Statically linking secp256k1 puts the whole curve implementation into every
+// wallet binary. Wallets built with REUSE_COIN_DYNAMIC_SECP256K1 instead load
+// this library from a cell dep by its data hash, so the curve code is
+// deployed once and shared by every wallet.
+//
+// Both sides are built from the same common.h, so the caller passes the
+// WitnessContext it has already loaded and parsed instead of the library
+// loading the witness a second time.
+#include "blake2b.h"
+#include "ckb_syscalls.h"
+#include "common.h"
+
+#include "blockchain.h"
+#include "secp256k1_helper.h"
+#include "secp256k1_schnorr.h"
+#include "secp256k1_lock.h"
+
+#define EXPORT __attribute__((visibility("default")))
+
+// Verifies the recoverable ECDSA sighash all signature in the lock field of
+// first_witness, the first witness of the current script group already
+// loaded by the caller, against pubkey_hash
+EXPORT int verify_sighash_all(unsigned char pubkey_hash[BLAKE160_SIZE],
+                              WitnessContext *first_witness) {
+  return verify_secp256k1_blake160_sighash_all(pubkey_hash, first_witness);
+}
+
+// Same as verify_sighash_all, for a BIP340 Schnorr lock field
+EXPORT int verify_schnorr_sighash_all(unsigned char pubkey_hash[BLAKE160_SIZE],
+                                      WitnessContext *first_witness) {
+  return verify_schnorr_blake160_sighash_all(pubkey_hash, first_witness);
+}
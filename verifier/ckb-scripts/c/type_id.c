@@ -127,7 +127,7 @@ if (outpoint_tx_hash.size != TX_HASH_SIZE) {
   }
 
   int create_mode = 0;
-  if (memcmp(tx_hash.ptr, outpoint_tx_hash.ptr, TX_HASH_SIZE) == 0 &&
+  if (hash32_eq(tx_hash.ptr, outpoint_tx_hash.ptr) &&
         memcmp(tx_idx.ptr, outpoint_tx_idx.ptr, TX_IDX_SIZE) == 0) {
       create_mode = 1;
       ckb_debug("CREATE MODE");
@@ -0,0 +1,78 @@
+#ifndef UDT_AMOUNT_H_
+#define UDT_AMOUNT_H_
+
+// Amount accounting shared by the token scripts.
+//
+// Token cells keep their amount as a little endian integer at a fixed offset
+// of the cell data, with nothing after it. The scripts differ only in the
+// width of that integer and its offset, so the loops are generated for each
+// layout by UDT_AMOUNT_DEFINE(prefix, amount_t, data_offset, layout_error),
+// which defines:
+//
+//   int prefix_load(size_t index, size_t source, amount_t *amount)
+//     Loads the amount of one cell. Data of any other size returns
+//     layout_error, each script keeping the error code it already used.
+//   int prefix_add(size_t index, size_t source, amount_t *total)
+//     Adds the amount of one cell to total, rejecting overflow.
+//   int prefix_sum(size_t source, amount_t *total)
+//     One pass over every cell of source. Each cell's layout is checked and,
+//     when total is not NULL, its amount is added to total. Returns
+//     CKB_SUCCESS once source runs out of cells.
+//
+// Each cell costs a single data load syscall of sizeof(amount_t) bytes. The
+// sum is unrolled by four cells so that the loop bookkeeping is paid once
+// per four syscalls.
+#include "ckb_syscalls.h"
+
+#define ERROR_UDT_AMOUNT_OVERFLOW -51
+
+#define UDT_AMOUNT_DEFINE(prefix, amount_t, data_offset, layout_error)        \
+  int prefix##_load(size_t index, size_t source, amount_t *amount) {          \
+    uint64_t len = sizeof(amount_t);                                          \
+    int ret = ckb_load_cell_data((uint8_t *)amount, &len, data_offset, index, \
+                                 source);                                     \
+    if (ret != CKB_SUCCESS) {                                                 \
+      return ret;                                                             \
+    }                                                                         \
+    if (len != sizeof(amount_t)) {                                            \
+      return layout_error;                                                    \
+    }                                                                         \
+    return CKB_SUCCESS;                                                       \
+  }                                                                           \
+                                                                              \
+  int prefix##_add(size_t index, size_t source, amount_t *total) {            \
+    amount_t amount;                                                          \
+    int ret = prefix##_load(index, source, &amount);                          \
+    if (ret != CKB_SUCCESS) {                                                 \
+      return ret;                                                             \
+    }                                                                         \
+    if (*total + amount < *total) {                                           \
+      return ERROR_UDT_AMOUNT_OVERFLOW;                                       \
+    }                                                                         \
+    *total += amount;                                                         \
+    return CKB_SUCCESS;                                                       \
+  }                                                                           \
+                                                                              \
+  static inline int prefix##_step(size_t index, size_t source,                \
+                                  amount_t *total) {                          \
+    amount_t amount;                                                          \
+    return total != NULL ? prefix##_add(index, source, total)                 \
+                         : prefix##_load(index, source, &amount);             \
+  }                                                                           \
+                                                                              \
+  int prefix##_sum(size_t source, amount_t *total) {                          \
+    int ret;                                                                  \
+    size_t i = 0;                                                             \
+    while (1) {                                                               \
+      if ((ret = prefix##_step(i, source, total)) != CKB_SUCCESS ||           \
+          (ret = prefix##_step(i + 1, source, total)) != CKB_SUCCESS ||       \
+          (ret = prefix##_step(i + 2, source, total)) != CKB_SUCCESS ||       \
+          (ret = prefix##_step(i + 3, source, total)) != CKB_SUCCESS) {       \
+        break;                                                                \
+      }                                                                       \
+      i += 4;                                                                 \
+    }                                                                         \
+    return ret == CKB_INDEX_OUT_OF_BOUND ? CKB_SUCCESS : ret;                 \
+  }
+
+#endif /* UDT_AMOUNT_H_ */
@@ -1,13 +1,15 @@
+#include "blake2b.h"
 #include "blockchain.h"
 
 #include "ckb_syscalls.h"
+#include "script_hash.h"
+#include "udt_amount.h"
 
 
 #define INPUT_OUTPOINT_SIZE 36
 #define SCRIPT_SIZE 32768
 #define OUTPOINT_INDEX_SIZE 4
 #define OUTPOINT_TX_HASH_SIZE 32
-#define UDT_AMOUNT_SIZE 8
 
 #define ERROR_ARGUMENTS_LEN -1
 #define ERROR_ENCODING -2
@@ -20,47 +22,124 @@
 #define ERROR_OUTPOINT_HASH_SIZE -56
 #define SCRIPT_ARG_LENGTH (OUTPOINT_TX_HASH_SIZE + OUTPOINT_INDEX_SIZE)
 #define INFO_TYPE_ARG_LENGTH (SCRIPT_ARG_LENGTH + 1)
+// Args may also name the code of the info cell type script, followed by its
+// hash type
+#define EXTENDED_SCRIPT_ARG_LENGTH (SCRIPT_ARG_LENGTH + SCRIPT_CODE_HASH_SIZE + SCRIPT_HASH_TYPE_SIZE)
+// Info cells of such a UDT name the code of this script in the same way
+#define EXTENDED_INFO_TYPE_ARG_LENGTH (INFO_TYPE_ARG_LENGTH + SCRIPT_CODE_HASH_SIZE + SCRIPT_HASH_TYPE_SIZE)
+
+// Amounts are 8 byte integers making up the whole cell data
+UDT_AMOUNT_DEFINE(udt_amount, uint64_t, 0, ERROR_AMOUNT)
+
+// Checks the data layout of every cell in the group and, when sum is set,
+// that the group inputs and outputs hold the same amount
+int verify_udt_amounts(int sum) {
+  uint64_t total_input = 0;
+  uint64_t total_output = 0;
+  int ret = udt_amount_sum(CKB_SOURCE_GROUP_INPUT, sum ? &total_input : NULL);
+  if (ret != CKB_SUCCESS) {
+    ckb_debug("UDT DATA FIELD IS INVALID");
+    return ret;
+  }
+  ret = udt_amount_sum(CKB_SOURCE_GROUP_OUTPUT, sum ? &total_output : NULL);
+  if (ret != CKB_SUCCESS) {
+    ckb_debug("UDT DATA FIELD IS INVALID");
+    return ret;
+  }
 
-// This function will verify that the first 8 bytes of udt data are occupied by an unsigned integer
-int verify_udt_data(){
+  if (total_input != total_output) {
+    ckb_debug("SUM VERIFICATION FAILED");
+    return ERROR_AMOUNT;
+  }
+  return CKB_SUCCESS;
+}
+
+// Hash of the type script the info cell of this UDT must have:
+// code hash and hash type from our args, and args of the UDT id, the is info
+// cell flag and the code hash and hash type of this script
+void calculate_info_type_hash(mol_seg_t *script_seg, mol_seg_t *args_bytes_seg,
+                              unsigned char *info_type_hash) {
+  uint8_t info_args[EXTENDED_INFO_TYPE_ARG_LENGTH];
+  memcpy(info_args, args_bytes_seg->ptr, SCRIPT_ARG_LENGTH);
+  info_args[SCRIPT_ARG_LENGTH] = 1;
+  mol_seg_t code_hash_seg = MolReader_Script_get_code_hash(script_seg);
+  mol_seg_t hash_type_seg = MolReader_Script_get_hash_type(script_seg);
+  memcpy(&info_args[INFO_TYPE_ARG_LENGTH], code_hash_seg.ptr, SCRIPT_CODE_HASH_SIZE);
+  info_args[INFO_TYPE_ARG_LENGTH + SCRIPT_CODE_HASH_SIZE] = *hash_type_seg.ptr;
+
+  uint8_t *info_code_hash = &args_bytes_seg->ptr[SCRIPT_ARG_LENGTH];
+  calculate_script_hash(info_code_hash, info_code_hash[SCRIPT_CODE_HASH_SIZE],
+                        info_args, EXTENDED_INFO_TYPE_ARG_LENGTH, info_type_hash);
+}
 
-  uint8_t i = 0;
+// Looks for an output whose type hash is info_type_hash. Only the 32 byte
+// type hash of each output is loaded.
+int find_info_cell_by_hash(unsigned char *info_type_hash, int *found) {
+  *found = 0;
+  size_t i = 0;
   while (1) {
-    unsigned char data[UDT_AMOUNT_SIZE];
-    uint64_t data_size = UDT_AMOUNT_SIZE;
-    int load_data_ret = ckb_checked_load_cell_data(data, &data_size, 0, i, CKB_SOURCE_GROUP_INPUT);
-    if (load_data_ret == CKB_INDEX_OUT_OF_BOUND) {
+    unsigned char type_hash[SCRIPT_HASH_SIZE];
+    uint64_t len = SCRIPT_HASH_SIZE;
+    int ret = ckb_load_cell_by_field(type_hash, &len, 0, i, CKB_SOURCE_OUTPUT,
+      CKB_CELL_FIELD_TYPE_HASH);
+    if (ret == CKB_INDEX_OUT_OF_BOUND) {
       break;
     }
-    if (load_data_ret != CKB_SUCCESS) {
-      return load_data_ret;
+    if (ret == CKB_SUCCESS && hash32_eq(type_hash, info_type_hash)) {
+      ckb_debug("INFO CELL TYPE HASH MATCHES");
+      *found = 1;
+      break;
     }
-    mol_seg_t data_seg;
-    data_seg.ptr = (uint8_t *)data;
-    data_seg.size = data_size;
-
-    if (MolReader_UdtAmount_verify(&data_seg, data_size) != MOL_OK){
-      return ERROR_AMOUNT;
+    if (ret != CKB_SUCCESS && ret != CKB_ITEM_MISSING) {
+      ckb_debug("ERROR loading outputs during info cell check");
+      return ret;
     }
     i += 1;
   }
-  i = 0;
+  return CKB_SUCCESS;
+}
+
+// Looks for an output whose type script args are the UDT id followed by the
+// is info cell flag, for UDTs whose args do not name the info cell code
+int find_info_cell_by_args(mol_seg_t *args_bytes_seg, int *found) {
+  *found = 0;
+  size_t i = 0;
   while (1) {
-    unsigned char data[UDT_AMOUNT_SIZE];
-    uint64_t data_size = UDT_AMOUNT_SIZE;
-    int load_data_ret = ckb_checked_load_cell_data(data, &data_size, 0, i, CKB_SOURCE_GROUP_OUTPUT);
-    if (load_data_ret == CKB_INDEX_OUT_OF_BOUND) {
+    uint64_t output_type_size = SCRIPT_SIZE;
+    unsigned char output_type[SCRIPT_SIZE];
+    int load_out_res = ckb_checked_load_cell_by_field(output_type, &output_type_size, 0, i, CKB_SOURCE_OUTPUT, CKB_CELL_FIELD_TYPE);
+
+    if (load_out_res == CKB_INDEX_OUT_OF_BOUND) {
       break;
     }
-    if (load_data_ret != CKB_SUCCESS) {
-      return load_data_ret;
+    if (load_out_res == CKB_ITEM_MISSING) {
+      i += 1;
+      continue;
+    }
+    if (load_out_res != CKB_SUCCESS) {
+      ckb_debug("ERROR loading outputs during info cell check");
+      return load_out_res;
     }
-    mol_seg_t data_seg;
-    data_seg.ptr = (uint8_t *)data;
-    data_seg.size = data_size;
 
-    if (MolReader_UdtAmount_verify(&data_seg, data_size) != MOL_OK){
-      return ERROR_AMOUNT;
+    mol_seg_t info_type_seg;
+    info_type_seg.ptr = (uint8_t*)output_type;
+    info_type_seg.size = output_type_size;
+
+    if (MolReader_Script_verify(&info_type_seg, false) != MOL_OK) {
+      ckb_debug("ERROR ENCODING IN INFO CELL TYPE SCRIPT");
+      return ERROR_ENCODING;
+    }
+
+    mol_seg_t info_args_seg = MolReader_Script_get_args(&info_type_seg);
+    mol_seg_t info_args_bytes_seg = MolReader_Bytes_raw_bytes(&info_args_seg);
+    if (info_args_bytes_seg.size == INFO_TYPE_ARG_LENGTH &&
+        info_args_bytes_seg.ptr[SCRIPT_ARG_LENGTH] == 1 &&
+        hash32_eq(args_bytes_seg->ptr, info_args_bytes_seg.ptr) &&
+        memcmp(&args_bytes_seg->ptr[OUTPOINT_TX_HASH_SIZE],
+          &info_args_bytes_seg.ptr[OUTPOINT_TX_HASH_SIZE], OUTPOINT_INDEX_SIZE) == 0) {
+      ckb_debug("INFO CELL ID MATCHES UUID");
+      *found = 1;
+      break;
     }
     i += 1;
   }
@@ -70,15 +149,6 @@ int verify_udt_data(){
 int main() {
   ckb_debug("UDT DEF SCRIPT EXECUTING________");
   // Load in type script args
-  int udt_data_is_valid = verify_udt_data();
-  if (udt_data_is_valid != CKB_SUCCESS) {
-    ckb_debug("UDT DATA FIELD IS INVALID");
-    return udt_data_is_valid;
-  }
-
-  if (udt_data_is_valid != CKB_SUCCESS) {
-    return udt_data_is_valid;
-  }
   unsigned char script[SCRIPT_SIZE];
   uint64_t len = SCRIPT_SIZE;
 
@@ -105,7 +175,8 @@ int main() {
   mol_seg_t args_seg = MolReader_Script_get_args(&script_seg);
   mol_seg_t args_bytes_seg = MolReader_Bytes_raw_bytes(&args_seg);
 
-  if (args_bytes_seg.size != SCRIPT_ARG_LENGTH) {
+  if (args_bytes_seg.size != SCRIPT_ARG_LENGTH &&
+      args_bytes_seg.size != EXTENDED_SCRIPT_ARG_LENGTH) {
     ckb_debug("INCORRECT ARG LENGTH");
     return ERROR_ARGUMENTS_LEN;
   }
@@ -144,7 +215,7 @@ int main() {
 
   // Check if UDT creation
   int create_mode = 0;
-  if (memcmp(args_bytes_seg.ptr, outpoint_tx_hash.ptr, OUTPOINT_TX_HASH_SIZE) == 0 &&
+  if (hash32_eq(args_bytes_seg.ptr, outpoint_tx_hash.ptr) &&
         memcmp(&args_bytes_seg.ptr[OUTPOINT_TX_HASH_SIZE], outpoint_tx_idx.ptr, OUTPOINT_INDEX_SIZE) == 0) {
       create_mode += 1;
       ckb_debug("CREATE MODE");
@@ -163,106 +234,23 @@ int main() {
 
   if (create_mode == 0) {
     // Locate UDT Info cell
-    uint8_t i = 0;
-    while (1) {
-          ckb_debug("Info type check iteration");
-      uint64_t output_type_size = SCRIPT_SIZE;
-      unsigned char output_type[SCRIPT_SIZE];
-      int load_out_res = ckb_checked_load_cell_by_field(output_type, &output_type_size, 0, i, CKB_SOURCE_OUTPUT, CKB_CELL_FIELD_TYPE);
-
-      if (load_out_res == CKB_INDEX_OUT_OF_BOUND) {
-        break;
-      }
-      if (load_out_res != CKB_SUCCESS) {
-        ckb_debug("ERROR loading outputs during info cell check");
-        return load_out_res;
-      }
-
-      mol_seg_t info_type_seg;
-      info_type_seg.ptr = (uint8_t*)output_type;
-      info_type_seg.size = output_type_size;
-
-      if (MolReader_Script_verify(&info_type_seg, false) != MOL_OK) {
-        ckb_debug("ERROR ENCODING IN INFO CELL TYPE SCRIPT");
-        return ERROR_ENCODING;
-      }
-
-      mol_seg_t info_args_seg = MolReader_Script_get_args(&info_type_seg);
-      mol_seg_t info_args_bytes_seg = MolReader_Bytes_raw_bytes(&info_args_seg);
-      if (info_args_bytes_seg.size == INFO_TYPE_ARG_LENGTH) {
-        ckb_debug("FOUND CELL W/ ARGS AT INFO TYPE ARG LENGTH");
-        uint8_t is_info_cell = info_args_bytes_seg.ptr[OUTPOINT_TX_HASH_SIZE + OUTPOINT_INDEX_SIZE];
-        if (is_info_cell == 1) {
-          ckb_debug("INFO CELL's LAST ARG IS 1");
-          if (memcmp(args_bytes_seg.ptr, info_args_bytes_seg.ptr, OUTPOINT_TX_HASH_SIZE) == 0 &&
-                memcmp(&args_bytes_seg.ptr[OUTPOINT_TX_HASH_SIZE],
-                  &info_args_bytes_seg.ptr[OUTPOINT_TX_HASH_SIZE], OUTPOINT_INDEX_SIZE) == 0) {
-                    ckb_debug("INFO CELL ID MATCHES UUID");
-              info_cell_in_output += 1;
-              break;
-          }
-        }
-      }
-      i += 1;
+    int ret;
+    if (args_bytes_seg.size == EXTENDED_SCRIPT_ARG_LENGTH) {
+      unsigned char info_type_hash[SCRIPT_HASH_SIZE];
+      calculate_info_type_hash(&script_seg, &args_bytes_seg, info_type_hash);
+      ret = find_info_cell_by_hash(info_type_hash, &info_cell_in_output);
+    } else {
+      ret = find_info_cell_by_args(&args_bytes_seg, &info_cell_in_output);
+    }
+    if (ret != CKB_SUCCESS) {
+      return ret;
     }
 
     ckb_debug("FINISHED INFO CELL CHECK");
 
     // If info cell not located, perform sum verification
-    //
-    if (info_cell_in_output == 0) {
-      uint64_t total_input = 0;
-      uint64_t total_output = 0;
-      uint8_t i = 0;
-      while (1) {
-        uint64_t current = 0;
-        uint64_t input_data_len = UDT_AMOUNT_SIZE;
-        int input_ret = ckb_checked_load_cell_data((uint8_t*)&current,
-          &input_data_len, 0, i, CKB_SOURCE_GROUP_INPUT);
-        if (input_ret == CKB_INDEX_OUT_OF_BOUND) {
-          break;
-        }
-        if (input_ret != CKB_SUCCESS) {
-          ckb_debug("Error loading inputs during sum verification");
-          return input_ret;
-        }
-        total_input += current;
-        i += 1;
-      }
-
-      i = 0;
-      while (1) {
-        uint64_t current = 0;
-        uint64_t output_data_len = UDT_AMOUNT_SIZE;
-        int output_ret = ckb_checked_load_cell_data((uint8_t*)&current,
-          &output_data_len, 0, i, CKB_SOURCE_GROUP_OUTPUT);
-
-        if (output_ret == CKB_INDEX_OUT_OF_BOUND) {
-          break;
-        }
-
-        if (output_ret != CKB_SUCCESS) {
-          ckb_debug("Error loading outputs during sum verification");
-          return output_ret;
-        }
-        total_output += current;
-        i += 1;
-      }
-
-      if (total_input != total_output) {
-        ckb_debug("SUM VERIFICATION FAILED");
-        return ERROR_AMOUNT;
-      } else {
-        ckb_debug("SUM VERIFICATION SUCCESS");
-        return CKB_SUCCESS;
-      }
-    } else {
-      return CKB_SUCCESS;
-    }
-
-
+    return verify_udt_amounts(info_cell_in_output == 0);
   } else {
-    return CKB_SUCCESS;
+    return verify_udt_amounts(0);
   }
-
 }
@@ -1,12 +1,15 @@
 #include "ckb_syscalls.h"
+#include "blake2b.h"
 #include "blockchain.h"
+#include "common.h"
+#include "script_hash.h"
+#include "udt_amount.h"
 
 #define INPUT_OUTPOINT_SIZE 36
 #define SCRIPT_SIZE 32768
 #define OUTPOINT_INDEX_SIZE 4
 #define OUTPOINT_TX_HASH_SIZE 32
 #define UDT_AMOUNT_SIZE 8
-#define MAX_DATA_SIZE 32768
 
 
 
@@ -28,12 +31,20 @@
 
 #define SCRIPT_ARG_LENGTH (OUTPOINT_TX_HASH_SIZE + OUTPOINT_INDEX_SIZE + 1)
 #define UDT_INSTANCE_SCRIPT_ARG_LENGTH (OUTPOINT_TX_HASH_SIZE + OUTPOINT_INDEX_SIZE)
+// Args may also name the code of the UDT instance type script, followed by
+// its hash type, see udt_def.c
+#define EXTENDED_SCRIPT_ARG_LENGTH (SCRIPT_ARG_LENGTH + SCRIPT_CODE_HASH_SIZE + SCRIPT_HASH_TYPE_SIZE)
+// Instances of such a UDT name the code of this script in the same way
+#define EXTENDED_UDT_INSTANCE_SCRIPT_ARG_LENGTH (UDT_INSTANCE_SCRIPT_ARG_LENGTH + SCRIPT_CODE_HASH_SIZE + SCRIPT_HASH_TYPE_SIZE)
 
 // Args:
 // Compound UUID
 //  1. Tx hash of first input's outpoint during UDT info cell creation
 //  2. Tx idx of first input's outpoint during UDT info cell creation
 //  3. is_info_cell flag
+// Optionally, for UDTs whose args name the code of this script:
+//  4. Code hash of the UDT instance type script
+//  5. Hash type of the UDT instance type script
 
 // verify_type_id_update Logic
 // -----------------------
@@ -63,7 +74,8 @@ int verify_type_id_update() {
 
     i = 0;
     while(1) {
-      int ret = ckb_load_cell_by_field(NULL, &len, 0, i, CKB_SOURCE_GROUP_OUTPUT, CKB_CELL_FIELD_CAPACITY);
+      CellView view;
+      int ret = open_cell_view(&view, i, CKB_SOURCE_GROUP_OUTPUT, CELL_VIEW_CAPACITY);
       if (ret == CKB_INDEX_OUT_OF_BOUND) {
         break;
       } else {
@@ -91,116 +103,98 @@ int verify_type_id_update() {
   }
 
 
-int get_udt_instance_amount(int source, uint8_t* target_id, uint64_t*amt) {
+// Hash of the type script every instance of this UDT has: code hash and hash
+// type from our args, and args of the UDT id followed by the code hash and
+// hash type of this script
+void calculate_instance_type_hash(mol_seg_t *script_seg, mol_seg_t *args_bytes_seg,
+                                  uint8_t *instance_type_hash) {
+  uint8_t instance_args[EXTENDED_UDT_INSTANCE_SCRIPT_ARG_LENGTH];
+  memcpy(instance_args, args_bytes_seg->ptr, UDT_INSTANCE_SCRIPT_ARG_LENGTH);
+  mol_seg_t code_hash_seg = MolReader_Script_get_code_hash(script_seg);
+  mol_seg_t hash_type_seg = MolReader_Script_get_hash_type(script_seg);
+  memcpy(&instance_args[UDT_INSTANCE_SCRIPT_ARG_LENGTH], code_hash_seg.ptr,
+         SCRIPT_CODE_HASH_SIZE);
+  instance_args[UDT_INSTANCE_SCRIPT_ARG_LENGTH + SCRIPT_CODE_HASH_SIZE] = *hash_type_seg.ptr;
+
+  uint8_t *udt_code_hash = &args_bytes_seg->ptr[SCRIPT_ARG_LENGTH];
+  calculate_script_hash(udt_code_hash, udt_code_hash[SCRIPT_CODE_HASH_SIZE],
+                        instance_args, EXTENDED_UDT_INSTANCE_SCRIPT_ARG_LENGTH,
+                        instance_type_hash);
+}
+
+// Instance amounts are 8 byte integers making up the whole cell data
+UDT_AMOUNT_DEFINE(udt_amount, uint64_t, 0, ERROR_AMOUNT)
+
+// Sums the amounts of the cells in source whose type hash is
+// instance_type_hash. Cells are matched on their 32 byte type hash alone.
+int get_udt_instance_amount(int source, uint8_t *instance_type_hash, uint64_t *amt) {
   uint64_t total_amt = 0;
-  int i = 0;
-  int total_instances_checked = 0;
+  size_t i = 0;
+  while (1) {
+    uint8_t type_hash[SCRIPT_HASH_SIZE];
+    uint64_t len = SCRIPT_HASH_SIZE;
+    int ret = ckb_load_cell_by_field(type_hash, &len, 0, i, source,
+      CKB_CELL_FIELD_TYPE_HASH);
+    if (ret == CKB_INDEX_OUT_OF_BOUND) {
+      break;
+    }
+    if (ret == CKB_SUCCESS && hash32_eq(type_hash, instance_type_hash)) {
+      ret = udt_amount_add(i, source, &total_amt);
+    }
+    if (ret != CKB_SUCCESS && ret != CKB_ITEM_MISSING) {
+      return ret;
+    }
+    i += 1;
+  }
+  *amt = total_amt;
+  return CKB_SUCCESS;
+}
 
+// Sums the amounts of the cells in source whose type script args are
+// target_id, for UDTs whose args do not name the instance code
+int get_udt_instance_amount_by_args(int source, uint8_t *target_id, uint64_t *amt) {
+  uint64_t total_amt = 0;
+  size_t i = 0;
   while (1) {
     unsigned char udt_script[SCRIPT_SIZE];
     uint64_t script_size = SCRIPT_SIZE;
     int load_udt_ret = ckb_checked_load_cell_by_field(udt_script, &script_size, 0,
       i, source, CKB_CELL_FIELD_TYPE);
     if (load_udt_ret == CKB_INDEX_OUT_OF_BOUND) {
-      ckb_debug("INDEX OUT OF BOUND");
       break;
     }
-    total_instances_checked += 1;
-    if (load_udt_ret != CKB_SUCCESS && load_udt_ret != CKB_ITEM_MISSING) {
+    if (load_udt_ret == CKB_ITEM_MISSING) {
+      i += 1;
+      continue;
+    }
+    if (load_udt_ret != CKB_SUCCESS) {
       ckb_debug("Error loading udt_instance_amount");
       return load_udt_ret;
     }
     mol_seg_t script_seg;
     script_seg.ptr = (uint8_t*)udt_script;
     script_seg.size = script_size;
+    if (MolReader_Script_verify(&script_seg, false) != MOL_OK) {
+      return ERROR_ENCODING;
+    }
 
     mol_seg_t args_seg = MolReader_Script_get_args(&script_seg);
     mol_seg_t args_bytes_seg = MolReader_Bytes_raw_bytes(&args_seg);
 
-    if (args_bytes_seg.size == UDT_INSTANCE_SCRIPT_ARG_LENGTH) {
-      ckb_debug("INSIDE GET INSTANCE, FOUND ONE W? CORRECT ARG LENGTH");
-      if (memcmp(args_bytes_seg.ptr, target_id, OUTPOINT_TX_HASH_SIZE) == 0 &&
-          memcmp(&args_bytes_seg.ptr[OUTPOINT_TX_HASH_SIZE], &target_id[OUTPOINT_TX_HASH_SIZE], OUTPOINT_INDEX_SIZE) == 0) {
-            ckb_debug("FOUND AN INSTANCE");
-            uint64_t udt_amount;
-            uint64_t amount_size = UDT_AMOUNT_SIZE;
-            int load_amount_ret = ckb_checked_load_cell_data((uint8_t*)&udt_amount, &amount_size, 0, i, source);
-
-            if (load_amount_ret != CKB_SUCCESS) {
-              ckb_debug("ERROR LOADING INSTANCE AMOUNT IN DATA LOAD CALL");
-              return load_amount_ret;
-            }
-            if (udt_amount == 200) {
-              ckb_debug("UDT AMOUNT IS 200 INSIDE LOAD INSTANCE CALL");
-            }
-            if (udt_amount == 100) {
-              ckb_debug("UDT AMOUNT IS 100 INSIDE LOAD INSTANCE CALL");
-            }
-            total_amt += udt_amount;
-          }
+    if (args_bytes_seg.size == UDT_INSTANCE_SCRIPT_ARG_LENGTH &&
+        hash32_eq(args_bytes_seg.ptr, target_id) &&
+        memcmp(&args_bytes_seg.ptr[OUTPOINT_TX_HASH_SIZE], &target_id[OUTPOINT_TX_HASH_SIZE], OUTPOINT_INDEX_SIZE) == 0) {
+      int ret = udt_amount_add(i, source, &total_amt);
+      if (ret != CKB_SUCCESS) {
+        return ret;
+      }
     }
-
     i += 1;
   }
   *amt = total_amt;
   return CKB_SUCCESS;
 }
 
-// verify_data Logic (upcoming in next demo)
-// -----------------
-// Checks type ID's data field to enforce data change rules and enforce a schema. Ensures:
-// 1. Data field is a dynamic vector
-// 2. First field in vector is 8 byte unsigned integer (uint64_t) total_supply
-// 3. Second field in vector is 8 byte unsigned integer (uint64_t) mint_amount_threshold
-// 4. Third field in vector is a relative time_stamp mint_interval
-// 5. If not creation tx and info cell is in output of current tx, checks the block number from the
-//   info cell in input and ensures that it is >= mint_interval blocks in the past
-// 6. Enforce immutability of certain fields if necessary
-int verify_data() {
-  uint8_t i = 0;
-  while (1) {
-    unsigned char data[MAX_DATA_SIZE];
-    uint64_t data_size = MAX_DATA_SIZE;
-    int load_data_ret = ckb_checked_load_cell_data(data, &data_size, 0, i, CKB_SOURCE_GROUP_INPUT);
-    if (load_data_ret == CKB_INDEX_OUT_OF_BOUND) {
-      break;
-    }
-    if (load_data_ret != CKB_SUCCESS) {
-      return load_data_ret;
-    }
-    mol_seg_t data_seg;
-    data_seg.ptr = (uint8_t *)data;
-    data_seg.size = data_size;
-
-    if (MolReader_UdtInfo_verify(&data_seg, false) != MOL_OK){
-      return ERROR_DATA_FIELD;
-    }
-    i += 1;
-  }
-  i = 0;
-  while (1) {
-    unsigned char data[MAX_DATA_SIZE];
-    uint64_t data_size = MAX_DATA_SIZE;
-    int load_data_ret = ckb_checked_load_cell_data(data, &data_size, 0, i, CKB_SOURCE_GROUP_OUTPUT);
-    if (load_data_ret == CKB_INDEX_OUT_OF_BOUND) {
-      break;
-    }
-    if (load_data_ret != CKB_SUCCESS) {
-      return load_data_ret;
-    }
-    mol_seg_t data_seg;
-    data_seg.ptr = (uint8_t *)data;
-    data_seg.size = data_size;
-
-    if (MolReader_UdtInfo_verify(&data_seg, false) != MOL_OK){
-      return ERROR_DATA_FIELD;
-    }
-    i += 1;
-  }
-  return CKB_SUCCESS;
-}
-
-
 // Main verification logic
 // This function will:
 // 1. check if the current tx is *creating* the info cell
@@ -237,10 +231,11 @@ int main() {
 
   if (args_bytes_seg.size < SCRIPT_ARG_LENGTH) {
     ckb_debug("INFO TYPE SCRIPT arg length smaller than expected");
-  } else if (args_bytes_seg.size > SCRIPT_ARG_LENGTH) {
+  } else if (args_bytes_seg.size > EXTENDED_SCRIPT_ARG_LENGTH) {
     ckb_debug("INFO TYPE SCRIPT arg length bigger than expected");
   }
-  if (args_bytes_seg.size != SCRIPT_ARG_LENGTH) {
+  if (args_bytes_seg.size != SCRIPT_ARG_LENGTH &&
+      args_bytes_seg.size != EXTENDED_SCRIPT_ARG_LENGTH) {
     ckb_debug("INCORRECT INFO TYPE sARG LENGTH");
     return ERROR_ARGUMENTS_LEN;
   }
@@ -280,7 +275,7 @@ int main() {
 
   // Check if UDT creation
   int create_mode = 0;
-  if (memcmp(args_bytes_seg.ptr, outpoint_tx_hash.ptr, OUTPOINT_TX_HASH_SIZE) == 0 &&
+  if (hash32_eq(args_bytes_seg.ptr, outpoint_tx_hash.ptr) &&
         memcmp(&args_bytes_seg.ptr[OUTPOINT_TX_HASH_SIZE], outpoint_tx_idx.ptr, OUTPOINT_INDEX_SIZE) == 0) {
       create_mode += 1;
       ckb_debug("CREATE MODE IN INFO CELL");
@@ -312,15 +307,23 @@ int main() {
 
       uint64_t total_input_instance_amt;
       uint64_t total_output_instance_amt;
-      int load_amt_of_inputs_ret = get_udt_instance_amount(CKB_SOURCE_INPUT, args_bytes_seg.ptr, &total_input_instance_amt);
+      int load_amt_of_inputs_ret;
+      int load_amt_of_outputs_ret;
+      if (args_bytes_seg.size == EXTENDED_SCRIPT_ARG_LENGTH) {
+        uint8_t instance_type_hash[SCRIPT_HASH_SIZE];
+        calculate_instance_type_hash(&script_seg, &args_bytes_seg, instance_type_hash);
+        load_amt_of_inputs_ret = get_udt_instance_amount(CKB_SOURCE_INPUT, instance_type_hash, &total_input_instance_amt);
+        load_amt_of_outputs_ret = get_udt_instance_amount(CKB_SOURCE_OUTPUT, instance_type_hash, &total_output_instance_amt);
+      } else {
+        load_amt_of_inputs_ret = get_udt_instance_amount_by_args(CKB_SOURCE_INPUT, args_bytes_seg.ptr, &total_input_instance_amt);
+        load_amt_of_outputs_ret = get_udt_instance_amount_by_args(CKB_SOURCE_OUTPUT, args_bytes_seg.ptr, &total_output_instance_amt);
+      }
 
       if (load_amt_of_inputs_ret != CKB_SUCCESS) {
-        ckb_debug("ERROR IN LOAD AMT OF OUTPUTS_RET");
+        ckb_debug("ERROR IN LOAD AMT OF INPUTS_RET");
         return load_amt_of_inputs_ret;
       }
 
-      int load_amt_of_outputs_ret = get_udt_instance_amount(CKB_SOURCE_OUTPUT,args_bytes_seg.ptr, &total_output_instance_amt);
-
       if (load_amt_of_outputs_ret != CKB_SUCCESS) {
         ckb_debug("ERROR IN LOAD AMT OF OUTPUTS_RET");
         return load_amt_of_outputs_ret;
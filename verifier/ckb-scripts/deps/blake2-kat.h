@@ -0,0 +1,4124 @@
+#ifndef BLAKE2_KAT_H
+#define BLAKE2_KAT_H
+
+/*
+ * Known answers for the BLAKE2B_SELFTEST build of blake2b.h, generated with
+ * Python's hashlib over the message 0x00 0x01 ... of every length below
+ * BLAKE2_KAT_LENGTH.
+ *
+ * blake2b_keyed_kat: 64 byte digests keyed with 0x00 0x01 ... 0x3f, the
+ * reference BLAKE2 vectors.
+ * blake2b_ckb_kat: 32 byte unkeyed digests personalized with
+ * "ckb-default-hash", as produced by blake2b_init.
+ */
+
+#include <stdint.h>
+
+#define BLAKE2_KAT_LENGTH 256
+#define BLAKE2B_CKB_HASH_BYTES 32
+
+static const uint8_t blake2b_keyed_kat[BLAKE2_KAT_LENGTH][BLAKE2B_OUTBYTES] =
+{
+  {
+    0x10, 0xEB, 0xB6, 0x77, 0x00, 0xB1, 0x86, 0x8E,
+    0xFB, 0x44, 0x17, 0x98, 0x7A, 0xCF, 0x46, 0x90,
+    0xAE, 0x9D, 0x97, 0x2F, 0xB7, 0xA5, 0x90, 0xC2,
+    0xF0, 0x28, 0x71, 0x79, 0x9A, 0xAA, 0x47, 0x86,
+    0xB5, 0xE9, 0x96, 0xE8, 0xF0, 0xF4, 0xEB, 0x98,
+    0x1F, 0xC2, 0x14, 0xB0, 0x05, 0xF4, 0x2D, 0x2F,
+    0xF4, 0x23, 0x34, 0x99, 0x39, 0x16, 0x53, 0xDF,
+    0x7A, 0xEF, 0xCB, 0xC1, 0x3F, 0xC5, 0x15, 0x68
+  },
+  {
+    0x96, 0x1F, 0x6D, 0xD1, 0xE4, 0xDD, 0x30, 0xF6,
+    0x39, 0x01, 0x69, 0x0C, 0x51, 0x2E, 0x78, 0xE4,
+    0xB4, 0x5E, 0x47, 0x42, 0xED, 0x19, 0x7C, 0x3C,
+    0x5E, 0x45, 0xC5, 0x49, 0xFD, 0x25, 0xF2, 0xE4,
+    0x18, 0x7B, 0x0B, 0xC9, 0xFE, 0x30, 0x49, 0x2B,
+    0x16, 0xB0, 0xD0, 0xBC, 0x4E, 0xF9, 0xB0, 0xF3,
+    0x4C, 0x70, 0x03, 0xFA, 0xC0, 0x9A, 0x5E, 0xF1,
+    0x53, 0x2E, 0x69, 0x43, 0x02, 0x34, 0xCE, 0xBD
+  },
+  {
+    0xDA, 0x2C, 0xFB, 0xE2, 0xD8, 0x40, 0x9A, 0x0F,
+    0x38, 0x02, 0x61, 0x13, 0x88, 0x4F, 0x84, 0xB5,
+    0x01, 0x56, 0x37, 0x1A, 0xE3, 0x04, 0xC4, 0x43,
+    0x01, 0x73, 0xD0, 0x8A, 0x99, 0xD9, 0xFB, 0x1B,
+    0x98, 0x31, 0x64, 0xA3, 0x77, 0x07, 0x06, 0xD5,
+    0x37, 0xF4, 0x9E, 0x0C, 0x91, 0x6D, 0x9F, 0x32,
+    0xB9, 0x5C, 0xC3, 0x7A, 0x95, 0xB9, 0x9D, 0x85,
+    0x74, 0x36, 0xF0, 0x23, 0x2C, 0x88, 0xA9, 0x65
+  },
+  {
+    0x33, 0xD0, 0x82, 0x5D, 0xDD, 0xF7, 0xAD, 0xA9,
+    0x9B, 0x0E, 0x7E, 0x30, 0x71, 0x04, 0xAD, 0x07,
+    0xCA, 0x9C, 0xFD, 0x96, 0x92, 0x21, 0x4F, 0x15,
+    0x61, 0x35, 0x63, 0x15, 0xE7, 0x84, 0xF3, 0xE5,
+    0xA1, 0x7E, 0x36, 0x4A, 0xE9, 0xDB, 0xB1, 0x4C,
+    0xB2, 0x03, 0x6D, 0xF9, 0x32, 0xB7, 0x7F, 0x4B,
+    0x29, 0x27, 0x61, 0x36, 0x5F, 0xB3, 0x28, 0xDE,
+    0x7A, 0xFD, 0xC6, 0xD8, 0x99, 0x8F, 0x5F, 0xC1
+  },
+  {
+    0xBE, 0xAA, 0x5A, 0x3D, 0x08, 0xF3, 0x80, 0x71,
+    0x43, 0xCF, 0x62, 0x1D, 0x95, 0xCD, 0x69, 0x05,
+    0x14, 0xD0, 0xB4, 0x9E, 0xFF, 0xF9, 0xC9, 0x1D,
+    0x24, 0xB5, 0x92, 0x41, 0xEC, 0x0E, 0xEF, 0xA5,
+    0xF6, 0x01, 0x96, 0xD4, 0x07, 0x04, 0x8B, 0xBA,
+    0x8D, 0x21, 0x46, 0x82, 0x8E, 0xBC, 0xB0, 0x48,
+    0x8D, 0x88, 0x42, 0xFD, 0x56, 0xBB, 0x4F, 0x6D,
+    0xF8, 0xE1, 0x9C, 0x4B, 0x4D, 0xAA, 0xB8, 0xAC
+  },
+  {
+    0x09, 0x80, 0x84, 0xB5, 0x1F, 0xD1, 0x3D, 0xEA,
+    0xE5, 0xF4, 0x32, 0x0D, 0xE9, 0x4A, 0x68, 0x8E,
+    0xE0, 0x7B, 0xAE, 0xA2, 0x80, 0x04, 0x86, 0x68,
+    0x9A, 0x86, 0x36, 0x11, 0x7B, 0x46, 0xC1, 0xF4,
+    0xC1, 0xF6, 0xAF, 0x7F, 0x74, 0xAE, 0x7C, 0x85,
+    0x76, 0x00, 0x45, 0x6A, 0x58, 0xA3, 0xAF, 0x25,
+    0x1D, 0xC4, 0x72, 0x3A, 0x64, 0xCC, 0x7C, 0x0A,
+    0x5A, 0xB6, 0xD9, 0xCA, 0xC9, 0x1C, 0x20, 0xBB
+  },
+  {
+    0x60, 0x44, 0x54, 0x0D, 0x56, 0x08, 0x53, 0xEB,
+    0x1C, 0x57, 0xDF, 0x00, 0x77, 0xDD, 0x38, 0x10,
+    0x94, 0x78, 0x1C, 0xDB, 0x90, 0x73, 0xE5, 0xB1,
+    0xB3, 0xD3, 0xF6, 0xC7, 0x82, 0x9E, 0x12, 0x06,
+    0x6B, 0xBA, 0xCA, 0x96, 0xD9, 0x89, 0xA6, 0x90,
+    0xDE, 0x72, 0xCA, 0x31, 0x33, 0xA8, 0x36, 0x52,
+    0xBA, 0x28, 0x4A, 0x6D, 0x62, 0x94, 0x2B, 0x27,
+    0x1F, 0xFA, 0x26, 0x20, 0xC9, 0xE7, 0x5B, 0x1F
+  },
+  {
+    0x7A, 0x8C, 0xFE, 0x9B, 0x90, 0xF7, 0x5F, 0x7E,
+    0xCB, 0x3A, 0xCC, 0x05, 0x3A, 0xAE, 0xD6, 0x19,
+    0x31, 0x12, 0xB6, 0xF6, 0xA4, 0xAE, 0xEB, 0x3F,
+    0x65, 0xD3, 0xDE, 0x54, 0x19, 0x42, 0xDE, 0xB9,
+    0xE2, 0x22, 0x81, 0x52, 0xA3, 0xC4, 0xBB, 0xBE,
+    0x72, 0xFC, 0x3B, 0x12, 0x62, 0x95, 0x28, 0xCF,
+    0xBB, 0x09, 0xFE, 0x63, 0x0F, 0x04, 0x74, 0x33,
+    0x9F, 0x54, 0xAB, 0xF4, 0x53, 0xE2, 0xED, 0x52
+  },
+  {
+    0x38, 0x0B, 0xEA, 0xF6, 0xEA, 0x7C, 0xC9, 0x36,
+    0x5E, 0x27, 0x0E, 0xF0, 0xE6, 0xF3, 0xA6, 0x4F,
+    0xB9, 0x02, 0xAC, 0xAE, 0x51, 0xDD, 0x55, 0x12,
+    0xF8, 0x42, 0x59, 0xAD, 0x2C, 0x91, 0xF4, 0xBC,
+    0x41, 0x08, 0xDB, 0x73, 0x19, 0x2A, 0x5B, 0xBF,
+    0xB0, 0xCB, 0xCF, 0x71, 0xE4, 0x6C, 0x3E, 0x21,
+    0xAE, 0xE1, 0xC5, 0xE8, 0x60, 0xDC, 0x96, 0xE8,
+    0xEB, 0x0B, 0x7B, 0x84, 0x26, 0xE6, 0xAB, 0xE9
+  },
+  {
+    0x60, 0xFE, 0x3C, 0x45, 0x35, 0xE1, 0xB5, 0x9D,
+    0x9A, 0x61, 0xEA, 0x85, 0x00, 0xBF, 0xAC, 0x41,
+    0xA6, 0x9D, 0xFF, 0xB1, 0xCE, 0xAD, 0xD9, 0xAC,
+    0xA3, 0x23, 0xE9, 0xA6, 0x25, 0xB6, 0x4D, 0xA5,
+    0x76, 0x3B, 0xAD, 0x72, 0x26, 0xDA, 0x02, 0xB9,
+    0xC8, 0xC4, 0xF1, 0xA5, 0xDE, 0x14, 0x0A, 0xC5,
+    0xA6, 0xC1, 0x12, 0x4E, 0x4F, 0x71, 0x8C, 0xE0,
+    0xB2, 0x8E, 0xA4, 0x73, 0x93, 0xAA, 0x66, 0x37
+  },
+  {
+    0x4F, 0xE1, 0x81, 0xF5, 0x4A, 0xD6, 0x3A, 0x29,
+    0x83, 0xFE, 0xAA, 0xF7, 0x7D, 0x1E, 0x72, 0x35,
+    0xC2, 0xBE, 0xB1, 0x7F, 0xA3, 0x28, 0xB6, 0xD9,
+    0x50, 0x5B, 0xDA, 0x32, 0x7D, 0xF1, 0x9F, 0xC3,
+    0x7F, 0x02, 0xC4, 0xB6, 0xF0, 0x36, 0x8C, 0xE2,
+    0x31, 0x47, 0x31, 0x3A, 0x8E, 0x57, 0x38, 0xB5,
+    0xFA, 0x2A, 0x95, 0xB2, 0x9D, 0xE1, 0xC7, 0xF8,
+    0x26, 0x4E, 0xB7, 0x7B, 0x69, 0xF5, 0x85, 0xCD
+  },
+  {
+    0xF2, 0x28, 0x77, 0x3C, 0xE3, 0xF3, 0xA4, 0x2B,
+    0x5F, 0x14, 0x4D, 0x63, 0x23, 0x7A, 0x72, 0xD9,
+    0x96, 0x93, 0xAD, 0xB8, 0x83, 0x7D, 0x0E, 0x11,
+    0x2A, 0x8A, 0x0F, 0x8F, 0xFF, 0xF2, 0xC3, 0x62,
+    0x85, 0x7A, 0xC4, 0x9C, 0x11, 0xEC, 0x74, 0x0D,
+    0x15, 0x00, 0x74, 0x9D, 0xAC, 0x9B, 0x1F, 0x45,
+    0x48, 0x10, 0x8B, 0xF3, 0x15, 0x57, 0x94, 0xDC,
+    0xC9, 0xE4, 0x08, 0x28, 0x49, 0xE2, 0xB8, 0x5B
+  },
+  {
+    0x96, 0x24, 0x52, 0xA8, 0x45, 0x5C, 0xC5, 0x6C,
+    0x85, 0x11, 0x31, 0x7E, 0x3B, 0x1F, 0x3B, 0x2C,
+    0x37, 0xDF, 0x75, 0xF5, 0x88, 0xE9, 0x43, 0x25,
+    0xFD, 0xD7, 0x70, 0x70, 0x35, 0x9C, 0xF6, 0x3A,
+    0x9A, 0xE6, 0xE9, 0x30, 0x93, 0x6F, 0xDF, 0x8E,
+    0x1E, 0x08, 0xFF, 0xCA, 0x44, 0x0C, 0xFB, 0x72,
+    0xC2, 0x8F, 0x06, 0xD8, 0x9A, 0x21, 0x51, 0xD1,
+    0xC4, 0x6C, 0xD5, 0xB2, 0x68, 0xEF, 0x85, 0x63
+  },
+  {
+    0x43, 0xD4, 0x4B, 0xFA, 0x18, 0x76, 0x8C, 0x59,
+    0x89, 0x6B, 0xF7, 0xED, 0x17, 0x65, 0xCB, 0x2D,
+    0x14, 0xAF, 0x8C, 0x26, 0x02, 0x66, 0x03, 0x90,
+    0x99, 0xB2, 0x5A, 0x60, 0x3E, 0x4D, 0xDC, 0x50,
+    0x39, 0xD6, 0xEF, 0x3A, 0x91, 0x84, 0x7D, 0x10,
+    0x88, 0xD4, 0x01, 0xC0, 0xC7, 0xE8, 0x47, 0x78,
+    0x1A, 0x8A, 0x59, 0x0D, 0x33, 0xA3, 0xC6, 0xCB,
+    0x4D, 0xF0, 0xFA, 0xB1, 0xC2, 0xF2, 0x23, 0x55
+  },
+  {
+    0xDC, 0xFF, 0xA9, 0xD5, 0x8C, 0x2A, 0x4C, 0xA2,
+    0xCD, 0xBB, 0x0C, 0x7A, 0xA4, 0xC4, 0xC1, 0xD4,
+    0x51, 0x65, 0x19, 0x00, 0x89, 0xF4, 0xE9, 0x83,
+    0xBB, 0x1C, 0x2C, 0xAB, 0x4A, 0xAE, 0xFF, 0x1F,
+    0xA2, 0xB5, 0xEE, 0x51, 0x6F, 0xEC, 0xD7, 0x80,
+    0x54, 0x02, 0x40, 0xBF, 0x37, 0xE5, 0x6C, 0x8B,
+    0xCC, 0xA7, 0xFA, 0xB9, 0x80, 0xE1, 0xE6, 0x1C,
+    0x94, 0x00, 0xD8, 0xA9, 0xA5, 0xB1, 0x4A, 0xC6
+  },
+  {
+    0x6F, 0xBF, 0x31, 0xB4, 0x5A, 0xB0, 0xC0, 0xB8,
+    0xDA, 0xD1, 0xC0, 0xF5, 0xF4, 0x06, 0x13, 0x79,
+    0x91, 0x2D, 0xDE, 0x5A, 0xA9, 0x22, 0x09, 0x9A,
+    0x03, 0x0B, 0x72, 0x5C, 0x73, 0x34, 0x6C, 0x52,
+    0x42, 0x91, 0xAD, 0xEF, 0x89, 0xD2, 0xF6, 0xFD,
+    0x8D, 0xFC, 0xDA, 0x6D, 0x07, 0xDA, 0xD8, 0x11,
+    0xA9, 0x31, 0x45, 0x36, 0xC2, 0x91, 0x5E, 0xD4,
+    0x5D, 0xA3, 0x49, 0x47, 0xE8, 0x3D, 0xE3, 0x4E
+  },
+  {
+    0xA0, 0xC6, 0x5B, 0xDD, 0xDE, 0x8A, 0xDE, 0xF5,
+    0x72, 0x82, 0xB0, 0x4B, 0x11, 0xE7, 0xBC, 0x8A,
+    0xAB, 0x10, 0x5B, 0x99, 0x23, 0x1B, 0x75, 0x0C,
+    0x02, 0x1F, 0x4A, 0x73, 0x5C, 0xB1, 0xBC, 0xFA,
+    0xB8, 0x75, 0x53, 0xBB, 0xA3, 0xAB, 0xB0, 0xC3,
+    0xE6, 0x4A, 0x0B, 0x69, 0x55, 0x28, 0x51, 0x85,
+    0xA0, 0xBD, 0x35, 0xFB, 0x8C, 0xFD, 0xE5, 0x57,
+    0x32, 0x9B, 0xEB, 0xB1, 0xF6, 0x29, 0xEE, 0x93
+  },
+  {
+    0xF9, 0x9D, 0x81, 0x55, 0x50, 0x55, 0x8E, 0x81,
+    0xEC, 0xA2, 0xF9, 0x67, 0x18, 0xAE, 0xD1, 0x0D,
+    0x86, 0xF3, 0xF1, 0xCF, 0xB6, 0x75, 0xCC, 0xE0,
+    0x6B, 0x0E, 0xFF, 0x02, 0xF6, 0x17, 0xC5, 0xA4,
+    0x2C, 0x5A, 0xA7, 0x60, 0x27, 0x0F, 0x26, 0x79,
+    0xDA, 0x26, 0x77, 0xC5, 0xAE, 0xB9, 0x4F, 0x11,
+    0x42, 0x27, 0x7F, 0x21, 0xC7, 0xF7, 0x9F, 0x3C,
+    0x4F, 0x0C, 0xCE, 0x4E, 0xD8, 0xEE, 0x62, 0xB1
+  },
+  {
+    0x95, 0x39, 0x1D, 0xA8, 0xFC, 0x7B, 0x91, 0x7A,
+    0x20, 0x44, 0xB3, 0xD6, 0xF5, 0x37, 0x4E, 0x1C,
+    0xA0, 0x72, 0xB4, 0x14, 0x54, 0xD5, 0x72, 0xC7,
+    0x35, 0x6C, 0x05, 0xFD, 0x4B, 0xC1, 0xE0, 0xF4,
+    0x0B, 0x8B, 0xB8, 0xB4, 0xA9, 0xF6, 0xBC, 0xE9,
+    0xBE, 0x2C, 0x46, 0x23, 0xC3, 0x99, 0xB0, 0xDC,
+    0xA0, 0xDA, 0xB0, 0x5C, 0xB7, 0x28, 0x1B, 0x71,
+    0xA2, 0x1B, 0x0E, 0xBC, 0xD9, 0xE5, 0x56, 0x70
+  },
+  {
+    0x04, 0xB9, 0xCD, 0x3D, 0x20, 0xD2, 0x21, 0xC0,
+    0x9A, 0xC8, 0x69, 0x13, 0xD3, 0xDC, 0x63, 0x04,
+    0x19, 0x89, 0xA9, 0xA1, 0xE6, 0x94, 0xF1, 0xE6,
+    0x39, 0xA3, 0xBA, 0x7E, 0x45, 0x18, 0x40, 0xF7,
+    0x50, 0xC2, 0xFC, 0x19, 0x1D, 0x56, 0xAD, 0x61,
+    0xF2, 0xE7, 0x93, 0x6B, 0xC0, 0xAC, 0x8E, 0x09,
+    0x4B, 0x60, 0xCA, 0xEE, 0xD8, 0x78, 0xC1, 0x87,
+    0x99, 0x04, 0x54, 0x02, 0xD6, 0x1C, 0xEA, 0xF9
+  },
+  {
+    0xEC, 0x0E, 0x0E, 0xF7, 0x07, 0xE4, 0xED, 0x6C,
+    0x0C, 0x66, 0xF9, 0xE0, 0x89, 0xE4, 0x95, 0x4B,
+    0x05, 0x80, 0x30, 0xD2, 0xDD, 0x86, 0x39, 0x8F,
+    0xE8, 0x40, 0x59, 0x63, 0x1F, 0x9E, 0xE5, 0x91,
+    0xD9, 0xD7, 0x73, 0x75, 0x35, 0x51, 0x49, 0x17,
+    0x8C, 0x0C, 0xF8, 0xF8, 0xE7, 0xC4, 0x9E, 0xD2,
+    0xA5, 0xE4, 0xF9, 0x54, 0x88, 0xA2, 0x24, 0x70,
+    0x67, 0xC2, 0x08, 0x51, 0x0F, 0xAD, 0xC4, 0x4C
+  },
+  {
+    0x9A, 0x37, 0xCC, 0xE2, 0x73, 0xB7, 0x9C, 0x09,
+    0x91, 0x36, 0x77, 0x51, 0x0E, 0xAF, 0x76, 0x88,
+    0xE8, 0x9B, 0x33, 0x14, 0xD3, 0x53, 0x2F, 0xD2,
+    0x76, 0x4C, 0x39, 0xDE, 0x02, 0x2A, 0x29, 0x45,
+    0xB5, 0x71, 0x0D, 0x13, 0x51, 0x7A, 0xF8, 0xDD,
+    0xC0, 0x31, 0x66, 0x24, 0xE7, 0x3B, 0xEC, 0x1C,
+    0xE6, 0x7D, 0xF1, 0x52, 0x28, 0x30, 0x20, 0x36,
+    0xF3, 0x30, 0xAB, 0x0C, 0xB4, 0xD2, 0x18, 0xDD
+  },
+  {
+    0x4C, 0xF9, 0xBB, 0x8F, 0xB3, 0xD4, 0xDE, 0x8B,
+    0x38, 0xB2, 0xF2, 0x62, 0xD3, 0xC4, 0x0F, 0x46,
+    0xDF, 0xE7, 0x47, 0xE8, 0xFC, 0x0A, 0x41, 0x4C,
+    0x19, 0x3D, 0x9F, 0xCF, 0x75, 0x31, 0x06, 0xCE,
+    0x47, 0xA1, 0x8F, 0x17, 0x2F, 0x12, 0xE8, 0xA2,
+    0xF1, 0xC2, 0x67, 0x26, 0x54, 0x53, 0x58, 0xE5,
+    0xEE, 0x28, 0xC9, 0xE2, 0x21, 0x3A, 0x87, 0x87,
+    0xAA, 0xFB, 0xC5, 0x16, 0xD2, 0x34, 0x31, 0x52
+  },
+  {
+    0x64, 0xE0, 0xC6, 0x3A, 0xF9, 0xC8, 0x08, 0xFD,
+    0x89, 0x31, 0x37, 0x12, 0x98, 0x67, 0xFD, 0x91,
+    0x93, 0x9D, 0x53, 0xF2, 0xAF, 0x04, 0xBE, 0x4F,
+    0xA2, 0x68, 0x00, 0x61, 0x00, 0x06, 0x9B, 0x2D,
+    0x69, 0xDA, 0xA5, 0xC5, 0xD8, 0xED, 0x7F, 0xDD,
+    0xCB, 0x2A, 0x70, 0xEE, 0xEC, 0xDF, 0x2B, 0x10,
+    0x5D, 0xD4, 0x6A, 0x1E, 0x3B, 0x73, 0x11, 0x72,
+    0x8F, 0x63, 0x9A, 0xB4, 0x89, 0x32, 0x6B, 0xC9
+  },
+  {
+    0x5E, 0x9C, 0x93, 0x15, 0x8D, 0x65, 0x9B, 0x2D,
+    0xEF, 0x06, 0xB0, 0xC3, 0xC7, 0x56, 0x50, 0x45,
+    0x54, 0x26, 0x62, 0xD6, 0xEE, 0xE8, 0xA9, 0x6A,
+    0x89, 0xB7, 0x8A, 0xDE, 0x09, 0xFE, 0x8B, 0x3D,
+    0xCC, 0x09, 0x6D, 0x4F, 0xE4, 0x88, 0x15, 0xD8,
+    0x8D, 0x8F, 0x82, 0x62, 0x01, 0x56, 0x60, 0x2A,
+    0xF5, 0x41, 0x95, 0x5E, 0x1F, 0x6C, 0xA3, 0x0D,
+    0xCE, 0x14, 0xE2, 0x54, 0xC3, 0x26, 0xB8, 0x8F
+  },
+  {
+    0x77, 0x75, 0xDF, 0xF8, 0x89, 0x45, 0x8D, 0xD1,
+    0x1A, 0xEF, 0x41, 0x72, 0x76, 0x85, 0x3E, 0x21,
+    0x33, 0x5E, 0xB8, 0x8E, 0x4D, 0xEC, 0x9C, 0xFB,
+    0x4E, 0x9E, 0xDB, 0x49, 0x82, 0x00, 0x88, 0x55,
+    0x1A, 0x2C, 0xA6, 0x03, 0x39, 0xF1, 0x20, 0x66,
+    0x10, 0x11, 0x69, 0xF0, 0xDF, 0xE8, 0x4B, 0x09,
+    0x8F, 0xDD, 0xB1, 0x48, 0xD9, 0xDA, 0x6B, 0x3D,
+    0x61, 0x3D, 0xF2, 0x63, 0x88, 0x9A, 0xD6, 0x4B
+  },
+  {
+    0xF0, 0xD2, 0x80, 0x5A, 0xFB, 0xB9, 0x1F, 0x74,
+    0x39, 0x51, 0x35, 0x1A, 0x6D, 0x02, 0x4F, 0x93,
+    0x53, 0xA2, 0x3C, 0x7C, 0xE1, 0xFC, 0x2B, 0x05,
+    0x1B, 0x3A, 0x8B, 0x96, 0x8C, 0x23, 0x3F, 0x46,
+    0xF5, 0x0F, 0x80, 0x6E, 0xCB, 0x15, 0x68, 0xFF,
+    0xAA, 0x0B, 0x60, 0x66, 0x1E, 0x33, 0x4B, 0x21,
+    0xDD, 0xE0, 0x4F, 0x8F, 0xA1, 0x55, 0xAC, 0x74,
+    0x0E, 0xEB, 0x42, 0xE2, 0x0B, 0x60, 0xD7, 0x64
+  },
+  {
+    0x86, 0xA2, 0xAF, 0x31, 0x6E, 0x7D, 0x77, 0x54,
+    0x20, 0x1B, 0x94, 0x2E, 0x27, 0x53, 0x64, 0xAC,
+    0x12, 0xEA, 0x89, 0x62, 0xAB, 0x5B, 0xD8, 0xD7,
+    0xFB, 0x27, 0x6D, 0xC5, 0xFB, 0xFF, 0xC8, 0xF9,
+    0xA2, 0x8C, 0xAE, 0x4E, 0x48, 0x67, 0xDF, 0x67,
+    0x80, 0xD9, 0xB7, 0x25, 0x24, 0x16, 0x09, 0x27,
+    0xC8, 0x55, 0xDA, 0x5B, 0x60, 0x78, 0xE0, 0xB5,
+    0x54, 0xAA, 0x91, 0xE3, 0x1C, 0xB9, 0xCA, 0x1D
+  },
+  {
+    0x10, 0xBD, 0xF0, 0xCA, 0xA0, 0x80, 0x27, 0x05,
+    0xE7, 0x06, 0x36, 0x9B, 0xAF, 0x8A, 0x3F, 0x79,
+    0xD7, 0x2C, 0x0A, 0x03, 0xA8, 0x06, 0x75, 0xA7,
+    0xBB, 0xB0, 0x0B, 0xE3, 0xA4, 0x5E, 0x51, 0x64,
+    0x24, 0xD1, 0xEE, 0x88, 0xEF, 0xB5, 0x6F, 0x6D,
+    0x57, 0x77, 0x54, 0x5A, 0xE6, 0xE2, 0x77, 0x65,
+    0xC3, 0xA8, 0xF5, 0xE4, 0x93, 0xFC, 0x30, 0x89,
+    0x15, 0x63, 0x89, 0x33, 0xA1, 0xDF, 0xEE, 0x55
+  },
+  {
+    0xB0, 0x17, 0x81, 0x09, 0x2B, 0x17, 0x48, 0x45,
+    0x9E, 0x2E, 0x4E, 0xC1, 0x78, 0x69, 0x66, 0x27,
+    0xBF, 0x4E, 0xBA, 0xFE, 0xBB, 0xA7, 0x74, 0xEC,
+    0xF0, 0x18, 0xB7, 0x9A, 0x68, 0xAE, 0xB8, 0x49,
+    0x17, 0xBF, 0x0B, 0x84, 0xBB, 0x79, 0xD1, 0x7B,
+    0x74, 0x31, 0x51, 0x14, 0x4C, 0xD6, 0x6B, 0x7B,
+    0x33, 0xA4, 0xB9, 0xE5, 0x2C, 0x76, 0xC4, 0xE1,
+    0x12, 0x05, 0x0F, 0xF5, 0x38, 0x5B, 0x7F, 0x0B
+  },
+  {
+    0xC6, 0xDB, 0xC6, 0x1D, 0xEC, 0x6E, 0xAE, 0xAC,
+    0x81, 0xE3, 0xD5, 0xF7, 0x55, 0x20, 0x3C, 0x8E,
+    0x22, 0x05, 0x51, 0x53, 0x4A, 0x0B, 0x2F, 0xD1,
+    0x05, 0xA9, 0x18, 0x89, 0x94, 0x5A, 0x63, 0x85,
+    0x50, 0x20, 0x4F, 0x44, 0x09, 0x3D, 0xD9, 0x98,
+    0xC0, 0x76, 0x20, 0x5D, 0xFF, 0xAD, 0x70, 0x3A,
+    0x0E, 0x5C, 0xD3, 0xC7, 0xF4, 0x38, 0xA7, 0xE6,
+    0x34, 0xCD, 0x59, 0xFE, 0xDE, 0xDB, 0x53, 0x9E
+  },
+  {
+    0xEB, 0xA5, 0x1A, 0xCF, 0xFB, 0x4C, 0xEA, 0x31,
+    0xDB, 0x4B, 0x8D, 0x87, 0xE9, 0xBF, 0x7D, 0xD4,
+    0x8F, 0xE9, 0x7B, 0x02, 0x53, 0xAE, 0x67, 0xAA,
+    0x58, 0x0F, 0x9A, 0xC4, 0xA9, 0xD9, 0x41, 0xF2,
+    0xBE, 0xA5, 0x18, 0xEE, 0x28, 0x68, 0x18, 0xCC,
+    0x9F, 0x63, 0x3F, 0x2A, 0x3B, 0x9F, 0xB6, 0x8E,
+    0x59, 0x4B, 0x48, 0xCD, 0xD6, 0xD5, 0x15, 0xBF,
+    0x1D, 0x52, 0xBA, 0x6C, 0x85, 0xA2, 0x03, 0xA7
+  },
+  {
+    0x86, 0x22, 0x1F, 0x3A, 0xDA, 0x52, 0x03, 0x7B,
+    0x72, 0x22, 0x4F, 0x10, 0x5D, 0x79, 0x99, 0x23,
+    0x1C, 0x5E, 0x55, 0x34, 0xD0, 0x3D, 0xA9, 0xD9,
+    0xC0, 0xA1, 0x2A, 0xCB, 0x68, 0x46, 0x0C, 0xD3,
+    0x75, 0xDA, 0xF8, 0xE2, 0x43, 0x86, 0x28, 0x6F,
+    0x96, 0x68, 0xF7, 0x23, 0x26, 0xDB, 0xF9, 0x9B,
+    0xA0, 0x94, 0x39, 0x24, 0x37, 0xD3, 0x98, 0xE9,
+    0x5B, 0xB8, 0x16, 0x1D, 0x71, 0x7F, 0x89, 0x91
+  },
+  {
+    0x55, 0x95, 0xE0, 0x5C, 0x13, 0xA7, 0xEC, 0x4D,
+    0xC8, 0xF4, 0x1F, 0xB7, 0x0C, 0xB5, 0x0A, 0x71,
+    0xBC, 0xE1, 0x7C, 0x02, 0x4F, 0xF6, 0xDE, 0x7A,
+    0xF6, 0x18, 0xD0, 0xCC, 0x4E, 0x9C, 0x32, 0xD9,
+    0x57, 0x0D, 0x6D, 0x3E, 0xA4, 0x5B, 0x86, 0x52,
+    0x54, 0x91, 0x03, 0x0C, 0x0D, 0x8F, 0x2B, 0x18,
+    0x36, 0xD5, 0x77, 0x8C, 0x1C, 0xE7, 0x35, 0xC1,
+    0x77, 0x07, 0xDF, 0x36, 0x4D, 0x05, 0x43, 0x47
+  },
+  {
+    0xCE, 0x0F, 0x4F, 0x6A, 0xCA, 0x89, 0x59, 0x0A,
+    0x37, 0xFE, 0x03, 0x4D, 0xD7, 0x4D, 0xD5, 0xFA,
+    0x65, 0xEB, 0x1C, 0xBD, 0x0A, 0x41, 0x50, 0x8A,
+    0xAD, 0xDC, 0x09, 0x35, 0x1A, 0x3C, 0xEA, 0x6D,
+    0x18, 0xCB, 0x21, 0x89, 0xC5, 0x4B, 0x70, 0x0C,
+    0x00, 0x9F, 0x4C, 0xBF, 0x05, 0x21, 0xC7, 0xEA,
+    0x01, 0xBE, 0x61, 0xC5, 0xAE, 0x09, 0xCB, 0x54,
+    0xF2, 0x7B, 0xC1, 0xB4, 0x4D, 0x65, 0x8C, 0x82
+  },
+  {
+    0x7E, 0xE8, 0x0B, 0x06, 0xA2, 0x15, 0xA3, 0xBC,
+    0xA9, 0x70, 0xC7, 0x7C, 0xDA, 0x87, 0x61, 0x82,
+    0x2B, 0xC1, 0x03, 0xD4, 0x4F, 0xA4, 0xB3, 0x3F,
+    0x4D, 0x07, 0xDC, 0xB9, 0x97, 0xE3, 0x6D, 0x55,
+    0x29, 0x8B, 0xCE, 0xAE, 0x12, 0x24, 0x1B, 0x3F,
+    0xA0, 0x7F, 0xA6, 0x3B, 0xE5, 0x57, 0x60, 0x68,
+    0xDA, 0x38, 0x7B, 0x8D, 0x58, 0x59, 0xAE, 0xAB,
+    0x70, 0x13, 0x69, 0x84, 0x8B, 0x17, 0x6D, 0x42
+  },
+  {
+    0x94, 0x0A, 0x84, 0xB6, 0xA8, 0x4D, 0x10, 0x9A,
+    0xAB, 0x20, 0x8C, 0x02, 0x4C, 0x6C, 0xE9, 0x64,
+    0x76, 0x76, 0xBA, 0x0A, 0xAA, 0x11, 0xF8, 0x6D,
+    0xBB, 0x70, 0x18, 0xF9, 0xFD, 0x22, 0x20, 0xA6,
+    0xD9, 0x01, 0xA9, 0x02, 0x7F, 0x9A, 0xBC, 0xF9,
+    0x35, 0x37, 0x27, 0x27, 0xCB, 0xF0, 0x9E, 0xBD,
+    0x61, 0xA2, 0xA2, 0xEE, 0xB8, 0x76, 0x53, 0xE8,
+    0xEC, 0xAD, 0x1B, 0xAB, 0x85, 0xDC, 0x83, 0x27
+  },
+  {
+    0x20, 0x20, 0xB7, 0x82, 0x64, 0xA8, 0x2D, 0x9F,
+    0x41, 0x51, 0x14, 0x1A, 0xDB, 0xA8, 0xD4, 0x4B,
+    0xF2, 0x0C, 0x5E, 0xC0, 0x62, 0xEE, 0xE9, 0xB5,
+    0x95, 0xA1, 0x1F, 0x9E, 0x84, 0x90, 0x1B, 0xF1,
+    0x48, 0xF2, 0x98, 0xE0, 0xC9, 0xF8, 0x77, 0x7D,
+    0xCD, 0xBC, 0x7C, 0xC4, 0x67, 0x0A, 0xAC, 0x35,
+    0x6C, 0xC2, 0xAD, 0x8C, 0xCB, 0x16, 0x29, 0xF1,
+    0x6F, 0x6A, 0x76, 0xBC, 0xEF, 0xBE, 0xE7, 0x60
+  },
+  {
+    0xD1, 0xB8, 0x97, 0xB0, 0xE0, 0x75, 0xBA, 0x68,
+    0xAB, 0x57, 0x2A, 0xDF, 0x9D, 0x9C, 0x43, 0x66,
+    0x63, 0xE4, 0x3E, 0xB3, 0xD8, 0xE6, 0x2D, 0x92,
+    0xFC, 0x49, 0xC9, 0xBE, 0x21, 0x4E, 0x6F, 0x27,
+    0x87, 0x3F, 0xE2, 0x15, 0xA6, 0x51, 0x70, 0xE6,
+    0xBE, 0xA9, 0x02, 0x40, 0x8A, 0x25, 0xB4, 0x95,
+    0x06, 0xF4, 0x7B, 0xAB, 0xD0, 0x7C, 0xEC, 0xF7,
+    0x11, 0x3E, 0xC1, 0x0C, 0x5D, 0xD3, 0x12, 0x52
+  },
+  {
+    0xB1, 0x4D, 0x0C, 0x62, 0xAB, 0xFA, 0x46, 0x9A,
+    0x35, 0x71, 0x77, 0xE5, 0x94, 0xC1, 0x0C, 0x19,
+    0x42, 0x43, 0xED, 0x20, 0x25, 0xAB, 0x8A, 0xA5,
+    0xAD, 0x2F, 0xA4, 0x1A, 0xD3, 0x18, 0xE0, 0xFF,
+    0x48, 0xCD, 0x5E, 0x60, 0xBE, 0xC0, 0x7B, 0x13,
+    0x63, 0x4A, 0x71, 0x1D, 0x23, 0x26, 0xE4, 0x88,
+    0xA9, 0x85, 0xF3, 0x1E, 0x31, 0x15, 0x33, 0x99,
+    0xE7, 0x30, 0x88, 0xEF, 0xC8, 0x6A, 0x5C, 0x55
+  },
+  {
+    0x41, 0x69, 0xC5, 0xCC, 0x80, 0x8D, 0x26, 0x97,
+    0xDC, 0x2A, 0x82, 0x43, 0x0D, 0xC2, 0x3E, 0x3C,
+    0xD3, 0x56, 0xDC, 0x70, 0xA9, 0x45, 0x66, 0x81,
+    0x05, 0x02, 0xB8, 0xD6, 0x55, 0xB3, 0x9A, 0xBF,
+    0x9E, 0x7F, 0x90, 0x2F, 0xE7, 0x17, 0xE0, 0x38,
+    0x92, 0x19, 0x85, 0x9E, 0x19, 0x45, 0xDF, 0x1A,
+    0xF6, 0xAD, 0xA4, 0x2E, 0x4C, 0xCD, 0xA5, 0x5A,
+    0x19, 0x7B, 0x71, 0x00, 0xA3, 0x0C, 0x30, 0xA1
+  },
+  {
+    0x25, 0x8A, 0x4E, 0xDB, 0x11, 0x3D, 0x66, 0xC8,
+    0x39, 0xC8, 0xB1, 0xC9, 0x1F, 0x15, 0xF3, 0x5A,
+    0xDE, 0x60, 0x9F, 0x11, 0xCD, 0x7F, 0x86, 0x81,
+    0xA4, 0x04, 0x5B, 0x9F, 0xEF, 0x7B, 0x0B, 0x24,
+    0xC8, 0x2C, 0xDA, 0x06, 0xA5, 0xF2, 0x06, 0x7B,
+    0x36, 0x88, 0x25, 0xE3, 0x91, 0x4E, 0x53, 0xD6,
+    0x94, 0x8E, 0xDE, 0x92, 0xEF, 0xD6, 0xE8, 0x38,
+    0x7F, 0xA2, 0xE5, 0x37, 0x23, 0x9B, 0x5B, 0xEE
+  },
+  {
+    0x79, 0xD2, 0xD8, 0x69, 0x6D, 0x30, 0xF3, 0x0F,
+    0xB3, 0x46, 0x57, 0x76, 0x11, 0x71, 0xA1, 0x1E,
+    0x6C, 0x3F, 0x1E, 0x64, 0xCB, 0xE7, 0xBE, 0xBE,
+    0xE1, 0x59, 0xCB, 0x95, 0xBF, 0xAF, 0x81, 0x2B,
+    0x4F, 0x41, 0x1E, 0x2F, 0x26, 0xD9, 0xC4, 0x21,
+    0xDC, 0x2C, 0x28, 0x4A, 0x33, 0x42, 0xD8, 0x23,
+    0xEC, 0x29, 0x38, 0x49, 0xE4, 0x2D, 0x1E, 0x46,
+    0xB0, 0xA4, 0xAC, 0x1E, 0x3C, 0x86, 0xAB, 0xAA
+  },
+  {
+    0x8B, 0x94, 0x36, 0x01, 0x0D, 0xC5, 0xDE, 0xE9,
+    0x92, 0xAE, 0x38, 0xAE, 0xA9, 0x7F, 0x2C, 0xD6,
+    0x3B, 0x94, 0x6D, 0x94, 0xFE, 0xDD, 0x2E, 0xC9,
+    0x67, 0x1D, 0xCD, 0xE3, 0xBD, 0x4C, 0xE9, 0x56,
+    0x4D, 0x55, 0x5C, 0x66, 0xC1, 0x5B, 0xB2, 0xB9,
+    0x00, 0xDF, 0x72, 0xED, 0xB6, 0xB8, 0x91, 0xEB,
+    0xCA, 0xDF, 0xEF, 0xF6, 0x3C, 0x9E, 0xA4, 0x03,
+    0x6A, 0x99, 0x8B, 0xE7, 0x97, 0x39, 0x81, 0xE7
+  },
+  {
+    0xC8, 0xF6, 0x8E, 0x69, 0x6E, 0xD2, 0x82, 0x42,
+    0xBF, 0x99, 0x7F, 0x5B, 0x3B, 0x34, 0x95, 0x95,
+    0x08, 0xE4, 0x2D, 0x61, 0x38, 0x10, 0xF1, 0xE2,
+    0xA4, 0x35, 0xC9, 0x6E, 0xD2, 0xFF, 0x56, 0x0C,
+    0x70, 0x22, 0xF3, 0x61, 0xA9, 0x23, 0x4B, 0x98,
+    0x37, 0xFE, 0xEE, 0x90, 0xBF, 0x47, 0x92, 0x2E,
+    0xE0, 0xFD, 0x5F, 0x8D, 0xDF, 0x82, 0x37, 0x18,
+    0xD8, 0x6D, 0x1E, 0x16, 0xC6, 0x09, 0x00, 0x71
+  },
+  {
+    0xB0, 0x2D, 0x3E, 0xEE, 0x48, 0x60, 0xD5, 0x86,
+    0x8B, 0x2C, 0x39, 0xCE, 0x39, 0xBF, 0xE8, 0x10,
+    0x11, 0x29, 0x05, 0x64, 0xDD, 0x67, 0x8C, 0x85,
+    0xE8, 0x78, 0x3F, 0x29, 0x30, 0x2D, 0xFC, 0x13,
+    0x99, 0xBA, 0x95, 0xB6, 0xB5, 0x3C, 0xD9, 0xEB,
+    0xBF, 0x40, 0x0C, 0xCA, 0x1D, 0xB0, 0xAB, 0x67,
+    0xE1, 0x9A, 0x32, 0x5F, 0x2D, 0x11, 0x58, 0x12,
+    0xD2, 0x5D, 0x00, 0x97, 0x8A, 0xD1, 0xBC, 0xA4
+  },
+  {
+    0x76, 0x93, 0xEA, 0x73, 0xAF, 0x3A, 0xC4, 0xDA,
+    0xD2, 0x1C, 0xA0, 0xD8, 0xDA, 0x85, 0xB3, 0x11,
+    0x8A, 0x7D, 0x1C, 0x60, 0x24, 0xCF, 0xAF, 0x55,
+    0x76, 0x99, 0x86, 0x82, 0x17, 0xBC, 0x0C, 0x2F,
+    0x44, 0xA1, 0x99, 0xBC, 0x6C, 0x0E, 0xDD, 0x51,
+    0x97, 0x98, 0xBA, 0x05, 0xBD, 0x5B, 0x1B, 0x44,
+    0x84, 0x34, 0x6A, 0x47, 0xC2, 0xCA, 0xDF, 0x6B,
+    0xF3, 0x0B, 0x78, 0x5C, 0xC8, 0x8B, 0x2B, 0xAF
+  },
+  {
+    0xA0, 0xE5, 0xC1, 0xC0, 0x03, 0x1C, 0x02, 0xE4,
+    0x8B, 0x7F, 0x09, 0xA5, 0xE8, 0x96, 0xEE, 0x9A,
+    0xEF, 0x2F, 0x17, 0xFC, 0x9E, 0x18, 0xE9, 0x97,
+    0xD7, 0xF6, 0xCA, 0xC7, 0xAE, 0x31, 0x64, 0x22,
+    0xC2, 0xB1, 0xE7, 0x79, 0x84, 0xE5, 0xF3, 0xA7,
+    0x3C, 0xB4, 0x5D, 0xEE, 0xD5, 0xD3, 0xF8, 0x46,
+    0x00, 0x10, 0x5E, 0x6E, 0xE3, 0x8F, 0x2D, 0x09,
+    0x0C, 0x7D, 0x04, 0x42, 0xEA, 0x34, 0xC4, 0x6D
+  },
+  {
+    0x41, 0xDA, 0xA6, 0xAD, 0xCF, 0xDB, 0x69, 0xF1,
+    0x44, 0x0C, 0x37, 0xB5, 0x96, 0x44, 0x01, 0x65,
+    0xC1, 0x5A, 0xDA, 0x59, 0x68, 0x13, 0xE2, 0xE2,
+    0x2F, 0x06, 0x0F, 0xCD, 0x55, 0x1F, 0x24, 0xDE,
+    0xE8, 0xE0, 0x4B, 0xA6, 0x89, 0x03, 0x87, 0x88,
+    0x6C, 0xEE, 0xC4, 0xA7, 0xA0, 0xD7, 0xFC, 0x6B,
+    0x44, 0x50, 0x63, 0x92, 0xEC, 0x38, 0x22, 0xC0,
+    0xD8, 0xC1, 0xAC, 0xFC, 0x7D, 0x5A, 0xEB, 0xE8
+  },
+  {
+    0x14, 0xD4, 0xD4, 0x0D, 0x59, 0x84, 0xD8, 0x4C,
+    0x5C, 0xF7, 0x52, 0x3B, 0x77, 0x98, 0xB2, 0x54,
+    0xE2, 0x75, 0xA3, 0xA8, 0xCC, 0x0A, 0x1B, 0xD0,
+    0x6E, 0xBC, 0x0B, 0xEE, 0x72, 0x68, 0x56, 0xAC,
+    0xC3, 0xCB, 0xF5, 0x16, 0xFF, 0x66, 0x7C, 0xDA,
+    0x20, 0x58, 0xAD, 0x5C, 0x34, 0x12, 0x25, 0x44,
+    0x60, 0xA8, 0x2C, 0x92, 0x18, 0x70, 0x41, 0x36,
+    0x3C, 0xC7, 0x7A, 0x4D, 0xC2, 0x15, 0xE4, 0x87
+  },
+  {
+    0xD0, 0xE7, 0xA1, 0xE2, 0xB9, 0xA4, 0x47, 0xFE,
+    0xE8, 0x3E, 0x22, 0x77, 0xE9, 0xFF, 0x80, 0x10,
+    0xC2, 0xF3, 0x75, 0xAE, 0x12, 0xFA, 0x7A, 0xAA,
+    0x8C, 0xA5, 0xA6, 0x31, 0x78, 0x68, 0xA2, 0x6A,
+    0x36, 0x7A, 0x0B, 0x69, 0xFB, 0xC1, 0xCF, 0x32,
+    0xA5, 0x5D, 0x34, 0xEB, 0x37, 0x06, 0x63, 0x01,
+    0x6F, 0x3D, 0x21, 0x10, 0x23, 0x0E, 0xBA, 0x75,
+    0x40, 0x28, 0xA5, 0x6F, 0x54, 0xAC, 0xF5, 0x7C
+  },
+  {
+    0xE7, 0x71, 0xAA, 0x8D, 0xB5, 0xA3, 0xE0, 0x43,
+    0xE8, 0x17, 0x8F, 0x39, 0xA0, 0x85, 0x7B, 0xA0,
+    0x4A, 0x3F, 0x18, 0xE4, 0xAA, 0x05, 0x74, 0x3C,
+    0xF8, 0xD2, 0x22, 0xB0, 0xB0, 0x95, 0x82, 0x53,
+    0x50, 0xBA, 0x42, 0x2F, 0x63, 0x38, 0x2A, 0x23,
+    0xD9, 0x2E, 0x41, 0x49, 0x07, 0x4E, 0x81, 0x6A,
+    0x36, 0xC1, 0xCD, 0x28, 0x28, 0x4D, 0x14, 0x62,
+    0x67, 0x94, 0x0B, 0x31, 0xF8, 0x81, 0x8E, 0xA2
+  },
+  {
+    0xFE, 0xB4, 0xFD, 0x6F, 0x9E, 0x87, 0xA5, 0x6B,
+    0xEF, 0x39, 0x8B, 0x32, 0x84, 0xD2, 0xBD, 0xA5,
+    0xB5, 0xB0, 0xE1, 0x66, 0x58, 0x3A, 0x66, 0xB6,
+    0x1E, 0x53, 0x84, 0x57, 0xFF, 0x05, 0x84, 0x87,
+    0x2C, 0x21, 0xA3, 0x29, 0x62, 0xB9, 0x92, 0x8F,
+    0xFA, 0xB5, 0x8D, 0xE4, 0xAF, 0x2E, 0xDD, 0x4E,
+    0x15, 0xD8, 0xB3, 0x55, 0x70, 0x52, 0x32, 0x07,
+    0xFF, 0x4E, 0x2A, 0x5A, 0xA7, 0x75, 0x4C, 0xAA
+  },
+  {
+    0x46, 0x2F, 0x17, 0xBF, 0x00, 0x5F, 0xB1, 0xC1,
+    0xB9, 0xE6, 0x71, 0x77, 0x9F, 0x66, 0x52, 0x09,
+    0xEC, 0x28, 0x73, 0xE3, 0xE4, 0x11, 0xF9, 0x8D,
+    0xAB, 0xF2, 0x40, 0xA1, 0xD5, 0xEC, 0x3F, 0x95,
+    0xCE, 0x67, 0x96, 0xB6, 0xFC, 0x23, 0xFE, 0x17,
+    0x19, 0x03, 0xB5, 0x02, 0x02, 0x34, 0x67, 0xDE,
+    0xC7, 0x27, 0x3F, 0xF7, 0x48, 0x79, 0xB9, 0x29,
+    0x67, 0xA2, 0xA4, 0x3A, 0x5A, 0x18, 0x3D, 0x33
+  },
+  {
+    0xD3, 0x33, 0x81, 0x93, 0xB6, 0x45, 0x53, 0xDB,
+    0xD3, 0x8D, 0x14, 0x4B, 0xEA, 0x71, 0xC5, 0x91,
+    0x5B, 0xB1, 0x10, 0xE2, 0xD8, 0x81, 0x80, 0xDB,
+    0xC5, 0xDB, 0x36, 0x4F, 0xD6, 0x17, 0x1D, 0xF3,
+    0x17, 0xFC, 0x72, 0x68, 0x83, 0x1B, 0x5A, 0xEF,
+    0x75, 0xE4, 0x34, 0x2B, 0x2F, 0xAD, 0x87, 0x97,
+    0xBA, 0x39, 0xED, 0xDC, 0xEF, 0x80, 0xE6, 0xEC,
+    0x08, 0x15, 0x93, 0x50, 0xB1, 0xAD, 0x69, 0x6D
+  },
+  {
+    0xE1, 0x59, 0x0D, 0x58, 0x5A, 0x3D, 0x39, 0xF7,
+    0xCB, 0x59, 0x9A, 0xBD, 0x47, 0x90, 0x70, 0x96,
+    0x64, 0x09, 0xA6, 0x84, 0x6D, 0x43, 0x77, 0xAC,
+    0xF4, 0x47, 0x1D, 0x06, 0x5D, 0x5D, 0xB9, 0x41,
+    0x29, 0xCC, 0x9B, 0xE9, 0x25, 0x73, 0xB0, 0x5E,
+    0xD2, 0x26, 0xBE, 0x1E, 0x9B, 0x7C, 0xB0, 0xCA,
+    0xBE, 0x87, 0x91, 0x85, 0x89, 0xF8, 0x0D, 0xAD,
+    0xD4, 0xEF, 0x5E, 0xF2, 0x5A, 0x93, 0xD2, 0x8E
+  },
+  {
+    0xF8, 0xF3, 0x72, 0x6A, 0xC5, 0xA2, 0x6C, 0xC8,
+    0x01, 0x32, 0x49, 0x3A, 0x6F, 0xED, 0xCB, 0x0E,
+    0x60, 0x76, 0x0C, 0x09, 0xCF, 0xC8, 0x4C, 0xAD,
+    0x17, 0x81, 0x75, 0x98, 0x68, 0x19, 0x66, 0x5E,
+    0x76, 0x84, 0x2D, 0x7B, 0x9F, 0xED, 0xF7, 0x6D,
+    0xDD, 0xEB, 0xF5, 0xD3, 0xF5, 0x6F, 0xAA, 0xAD,
+    0x44, 0x77, 0x58, 0x7A, 0xF2, 0x16, 0x06, 0xD3,
+    0x96, 0xAE, 0x57, 0x0D, 0x8E, 0x71, 0x9A, 0xF2
+  },
+  {
+    0x30, 0x18, 0x60, 0x55, 0xC0, 0x79, 0x49, 0x94,
+    0x81, 0x83, 0xC8, 0x50, 0xE9, 0xA7, 0x56, 0xCC,
+    0x09, 0x93, 0x7E, 0x24, 0x7D, 0x9D, 0x92, 0x8E,
+    0x86, 0x9E, 0x20, 0xBA, 0xFC, 0x3C, 0xD9, 0x72,
+    0x17, 0x19, 0xD3, 0x4E, 0x04, 0xA0, 0x89, 0x9B,
+    0x92, 0xC7, 0x36, 0x08, 0x45, 0x50, 0x18, 0x68,
+    0x86, 0xEF, 0xBA, 0x2E, 0x79, 0x0D, 0x8B, 0xE6,
+    0xEB, 0xF0, 0x40, 0xB2, 0x09, 0xC4, 0x39, 0xA4
+  },
+  {
+    0xF3, 0xC4, 0x27, 0x6C, 0xB8, 0x63, 0x63, 0x77,
+    0x12, 0xC2, 0x41, 0xC4, 0x44, 0xC5, 0xCC, 0x1E,
+    0x35, 0x54, 0xE0, 0xFD, 0xDB, 0x17, 0x4D, 0x03,
+    0x58, 0x19, 0xDD, 0x83, 0xEB, 0x70, 0x0B, 0x4C,
+    0xE8, 0x8D, 0xF3, 0xAB, 0x38, 0x41, 0xBA, 0x02,
+    0x08, 0x5E, 0x1A, 0x99, 0xB4, 0xE1, 0x73, 0x10,
+    0xC5, 0x34, 0x10, 0x75, 0xC0, 0x45, 0x8B, 0xA3,
+    0x76, 0xC9, 0x5A, 0x68, 0x18, 0xFB, 0xB3, 0xE2
+  },
+  {
+    0x0A, 0xA0, 0x07, 0xC4, 0xDD, 0x9D, 0x58, 0x32,
+    0x39, 0x30, 0x40, 0xA1, 0x58, 0x3C, 0x93, 0x0B,
+    0xCA, 0x7D, 0xC5, 0xE7, 0x7E, 0xA5, 0x3A, 0xDD,
+    0x7E, 0x2B, 0x3F, 0x7C, 0x8E, 0x23, 0x13, 0x68,
+    0x04, 0x35, 0x20, 0xD4, 0xA3, 0xEF, 0x53, 0xC9,
+    0x69, 0xB6, 0xBB, 0xFD, 0x02, 0x59, 0x46, 0xF6,
+    0x32, 0xBD, 0x7F, 0x76, 0x5D, 0x53, 0xC2, 0x10,
+    0x03, 0xB8, 0xF9, 0x83, 0xF7, 0x5E, 0x2A, 0x6A
+  },
+  {
+    0x08, 0xE9, 0x46, 0x47, 0x20, 0x53, 0x3B, 0x23,
+    0xA0, 0x4E, 0xC2, 0x4F, 0x7A, 0xE8, 0xC1, 0x03,
+    0x14, 0x5F, 0x76, 0x53, 0x87, 0xD7, 0x38, 0x77,
+    0x7D, 0x3D, 0x34, 0x34, 0x77, 0xFD, 0x1C, 0x58,
+    0xDB, 0x05, 0x21, 0x42, 0xCA, 0xB7, 0x54, 0xEA,
+    0x67, 0x43, 0x78, 0xE1, 0x87, 0x66, 0xC5, 0x35,
+    0x42, 0xF7, 0x19, 0x70, 0x17, 0x1C, 0xC4, 0xF8,
+    0x16, 0x94, 0x24, 0x6B, 0x71, 0x7D, 0x75, 0x64
+  },
+  {
+    0xD3, 0x7F, 0xF7, 0xAD, 0x29, 0x79, 0x93, 0xE7,
+    0xEC, 0x21, 0xE0, 0xF1, 0xB4, 0xB5, 0xAE, 0x71,
+    0x9C, 0xDC, 0x83, 0xC5, 0xDB, 0x68, 0x75, 0x27,
+    0xF2, 0x75, 0x16, 0xCB, 0xFF, 0xA8, 0x22, 0x88,
+    0x8A, 0x68, 0x10, 0xEE, 0x5C, 0x1C, 0xA7, 0xBF,
+    0xE3, 0x32, 0x11, 0x19, 0xBE, 0x1A, 0xB7, 0xBF,
+    0xA0, 0xA5, 0x02, 0x67, 0x1C, 0x83, 0x29, 0x49,
+    0x4D, 0xF7, 0xAD, 0x6F, 0x52, 0x2D, 0x44, 0x0F
+  },
+  {
+    0xDD, 0x90, 0x42, 0xF6, 0xE4, 0x64, 0xDC, 0xF8,
+    0x6B, 0x12, 0x62, 0xF6, 0xAC, 0xCF, 0xAF, 0xBD,
+    0x8C, 0xFD, 0x90, 0x2E, 0xD3, 0xED, 0x89, 0xAB,
+    0xF7, 0x8F, 0xFA, 0x48, 0x2D, 0xBD, 0xEE, 0xB6,
+    0x96, 0x98, 0x42, 0x39, 0x4C, 0x9A, 0x11, 0x68,
+    0xAE, 0x3D, 0x48, 0x1A, 0x01, 0x78, 0x42, 0xF6,
+    0x60, 0x00, 0x2D, 0x42, 0x44, 0x7C, 0x6B, 0x22,
+    0xF7, 0xB7, 0x2F, 0x21, 0xAA, 0xE0, 0x21, 0xC9
+  },
+  {
+    0xBD, 0x96, 0x5B, 0xF3, 0x1E, 0x87, 0xD7, 0x03,
+    0x27, 0x53, 0x6F, 0x2A, 0x34, 0x1C, 0xEB, 0xC4,
+    0x76, 0x8E, 0xCA, 0x27, 0x5F, 0xA0, 0x5E, 0xF9,
+    0x8F, 0x7F, 0x1B, 0x71, 0xA0, 0x35, 0x12, 0x98,
+    0xDE, 0x00, 0x6F, 0xBA, 0x73, 0xFE, 0x67, 0x33,
+    0xED, 0x01, 0xD7, 0x58, 0x01, 0xB4, 0xA9, 0x28,
+    0xE5, 0x42, 0x31, 0xB3, 0x8E, 0x38, 0xC5, 0x62,
+    0xB2, 0xE3, 0x3E, 0xA1, 0x28, 0x49, 0x92, 0xFA
+  },
+  {
+    0x65, 0x67, 0x6D, 0x80, 0x06, 0x17, 0x97, 0x2F,
+    0xBD, 0x87, 0xE4, 0xB9, 0x51, 0x4E, 0x1C, 0x67,
+    0x40, 0x2B, 0x7A, 0x33, 0x10, 0x96, 0xD3, 0xBF,
+    0xAC, 0x22, 0xF1, 0xAB, 0xB9, 0x53, 0x74, 0xAB,
+    0xC9, 0x42, 0xF1, 0x6E, 0x9A, 0xB0, 0xEA, 0xD3,
+    0x3B, 0x87, 0xC9, 0x19, 0x68, 0xA6, 0xE5, 0x09,
+    0xE1, 0x19, 0xFF, 0x07, 0x78, 0x7B, 0x3E, 0xF4,
+    0x83, 0xE1, 0xDC, 0xDC, 0xCF, 0x6E, 0x30, 0x22
+  },
+  {
+    0x93, 0x9F, 0xA1, 0x89, 0x69, 0x9C, 0x5D, 0x2C,
+    0x81, 0xDD, 0xD1, 0xFF, 0xC1, 0xFA, 0x20, 0x7C,
+    0x97, 0x0B, 0x6A, 0x36, 0x85, 0xBB, 0x29, 0xCE,
+    0x1D, 0x3E, 0x99, 0xD4, 0x2F, 0x2F, 0x74, 0x42,
+    0xDA, 0x53, 0xE9, 0x5A, 0x72, 0x90, 0x73, 0x14,
+    0xF4, 0x58, 0x83, 0x99, 0xA3, 0xFF, 0x5B, 0x0A,
+    0x92, 0xBE, 0xB3, 0xF6, 0xBE, 0x26, 0x94, 0xF9,
+    0xF8, 0x6E, 0xCF, 0x29, 0x52, 0xD5, 0xB4, 0x1C
+  },
+  {
+    0xC5, 0x16, 0x54, 0x17, 0x01, 0x86, 0x3F, 0x91,
+    0x00, 0x5F, 0x31, 0x41, 0x08, 0xCE, 0xEC, 0xE3,
+    0xC6, 0x43, 0xE0, 0x4F, 0xC8, 0xC4, 0x2F, 0xD2,
+    0xFF, 0x55, 0x62, 0x20, 0xE6, 0x16, 0xAA, 0xA6,
+    0xA4, 0x8A, 0xEB, 0x97, 0xA8, 0x4B, 0xAD, 0x74,
+    0x78, 0x2E, 0x8D, 0xFF, 0x96, 0xA1, 0xA2, 0xFA,
+    0x94, 0x93, 0x39, 0xD7, 0x22, 0xED, 0xCA, 0xA3,
+    0x2B, 0x57, 0x06, 0x70, 0x41, 0xDF, 0x88, 0xCC
+  },
+  {
+    0x98, 0x7F, 0xD6, 0xE0, 0xD6, 0x85, 0x7C, 0x55,
+    0x3E, 0xAE, 0xBB, 0x3D, 0x34, 0x97, 0x0A, 0x2C,
+    0x2F, 0x6E, 0x89, 0xA3, 0x54, 0x8F, 0x49, 0x25,
+    0x21, 0x72, 0x2B, 0x80, 0xA1, 0xC2, 0x1A, 0x15,
+    0x38, 0x92, 0x34, 0x6D, 0x2C, 0xBA, 0x64, 0x44,
+    0x21, 0x2D, 0x56, 0xDA, 0x9A, 0x26, 0xE3, 0x24,
+    0xDC, 0xCB, 0xC0, 0xDC, 0xDE, 0x85, 0xD4, 0xD2,
+    0xEE, 0x43, 0x99, 0xEE, 0xC5, 0xA6, 0x4E, 0x8F
+  },
+  {
+    0xAE, 0x56, 0xDE, 0xB1, 0xC2, 0x32, 0x8D, 0x9C,
+    0x40, 0x17, 0x70, 0x6B, 0xCE, 0x6E, 0x99, 0xD4,
+    0x13, 0x49, 0x05, 0x3B, 0xA9, 0xD3, 0x36, 0xD6,
+    0x77, 0xC4, 0xC2, 0x7D, 0x9F, 0xD5, 0x0A, 0xE6,
+    0xAE, 0xE1, 0x7E, 0x85, 0x31, 0x54, 0xE1, 0xF4,
+    0xFE, 0x76, 0x72, 0x34, 0x6D, 0xA2, 0xEA, 0xA3,
+    0x1E, 0xEA, 0x53, 0xFC, 0xF2, 0x4A, 0x22, 0x80,
+    0x4F, 0x11, 0xD0, 0x3D, 0xA6, 0xAB, 0xFC, 0x2B
+  },
+  {
+    0x49, 0xD6, 0xA6, 0x08, 0xC9, 0xBD, 0xE4, 0x49,
+    0x18, 0x70, 0x49, 0x85, 0x72, 0xAC, 0x31, 0xAA,
+    0xC3, 0xFA, 0x40, 0x93, 0x8B, 0x38, 0xA7, 0x81,
+    0x8F, 0x72, 0x38, 0x3E, 0xB0, 0x40, 0xAD, 0x39,
+    0x53, 0x2B, 0xC0, 0x65, 0x71, 0xE1, 0x3D, 0x76,
+    0x7E, 0x69, 0x45, 0xAB, 0x77, 0xC0, 0xBD, 0xC3,
+    0xB0, 0x28, 0x42, 0x53, 0x34, 0x3F, 0x9F, 0x6C,
+    0x12, 0x44, 0xEB, 0xF2, 0xFF, 0x0D, 0xF8, 0x66
+  },
+  {
+    0xDA, 0x58, 0x2A, 0xD8, 0xC5, 0x37, 0x0B, 0x44,
+    0x69, 0xAF, 0x86, 0x2A, 0xA6, 0x46, 0x7A, 0x22,
+    0x93, 0xB2, 0xB2, 0x8B, 0xD8, 0x0A, 0xE0, 0xE9,
+    0x1F, 0x42, 0x5A, 0xD3, 0xD4, 0x72, 0x49, 0xFD,
+    0xF9, 0x88, 0x25, 0xCC, 0x86, 0xF1, 0x40, 0x28,
+    0xC3, 0x30, 0x8C, 0x98, 0x04, 0xC7, 0x8B, 0xFE,
+    0xEE, 0xEE, 0x46, 0x14, 0x44, 0xCE, 0x24, 0x36,
+    0x87, 0xE1, 0xA5, 0x05, 0x22, 0x45, 0x6A, 0x1D
+  },
+  {
+    0xD5, 0x26, 0x6A, 0xA3, 0x33, 0x11, 0x94, 0xAE,
+    0xF8, 0x52, 0xEE, 0xD8, 0x6D, 0x7B, 0x5B, 0x26,
+    0x33, 0xA0, 0xAF, 0x1C, 0x73, 0x59, 0x06, 0xF2,
+    0xE1, 0x32, 0x79, 0xF1, 0x49, 0x31, 0xA9, 0xFC,
+    0x3B, 0x0E, 0xAC, 0x5C, 0xE9, 0x24, 0x52, 0x73,
+    0xBD, 0x1A, 0xA9, 0x29, 0x05, 0xAB, 0xE1, 0x62,
+    0x78, 0xEF, 0x7E, 0xFD, 0x47, 0x69, 0x47, 0x89,
+    0xA7, 0x28, 0x3B, 0x77, 0xDA, 0x3C, 0x70, 0xF8
+  },
+  {
+    0x29, 0x62, 0x73, 0x4C, 0x28, 0x25, 0x21, 0x86,
+    0xA9, 0xA1, 0x11, 0x1C, 0x73, 0x2A, 0xD4, 0xDE,
+    0x45, 0x06, 0xD4, 0xB4, 0x48, 0x09, 0x16, 0x30,
+    0x3E, 0xB7, 0x99, 0x1D, 0x65, 0x9C, 0xCD, 0xA0,
+    0x7A, 0x99, 0x11, 0x91, 0x4B, 0xC7, 0x5C, 0x41,
+    0x8A, 0xB7, 0xA4, 0x54, 0x17, 0x57, 0xAD, 0x05,
+    0x47, 0x96, 0xE2, 0x67, 0x97, 0xFE, 0xAF, 0x36,
+    0xE9, 0xF6, 0xAD, 0x43, 0xF1, 0x4B, 0x35, 0xA4
+  },
+  {
+    0xE8, 0xB7, 0x9E, 0xC5, 0xD0, 0x6E, 0x11, 0x1B,
+    0xDF, 0xAF, 0xD7, 0x1E, 0x9F, 0x57, 0x60, 0xF0,
+    0x0A, 0xC8, 0xAC, 0x5D, 0x8B, 0xF7, 0x68, 0xF9,
+    0xFF, 0x6F, 0x08, 0xB8, 0xF0, 0x26, 0x09, 0x6B,
+    0x1C, 0xC3, 0xA4, 0xC9, 0x73, 0x33, 0x30, 0x19,
+    0xF1, 0xE3, 0x55, 0x3E, 0x77, 0xDA, 0x3F, 0x98,
+    0xCB, 0x9F, 0x54, 0x2E, 0x0A, 0x90, 0xE5, 0xF8,
+    0xA9, 0x40, 0xCC, 0x58, 0xE5, 0x98, 0x44, 0xB3
+  },
+  {
+    0xDF, 0xB3, 0x20, 0xC4, 0x4F, 0x9D, 0x41, 0xD1,
+    0xEF, 0xDC, 0xC0, 0x15, 0xF0, 0x8D, 0xD5, 0x53,
+    0x9E, 0x52, 0x6E, 0x39, 0xC8, 0x7D, 0x50, 0x9A,
+    0xE6, 0x81, 0x2A, 0x96, 0x9E, 0x54, 0x31, 0xBF,
+    0x4F, 0xA7, 0xD9, 0x1F, 0xFD, 0x03, 0xB9, 0x81,
+    0xE0, 0xD5, 0x44, 0xCF, 0x72, 0xD7, 0xB1, 0xC0,
+    0x37, 0x4F, 0x88, 0x01, 0x48, 0x2E, 0x6D, 0xEA,
+    0x2E, 0xF9, 0x03, 0x87, 0x7E, 0xBA, 0x67, 0x5E
+  },
+  {
+    0xD8, 0x86, 0x75, 0x11, 0x8F, 0xDB, 0x55, 0xA5,
+    0xFB, 0x36, 0x5A, 0xC2, 0xAF, 0x1D, 0x21, 0x7B,
+    0xF5, 0x26, 0xCE, 0x1E, 0xE9, 0xC9, 0x4B, 0x2F,
+    0x00, 0x90, 0xB2, 0xC5, 0x8A, 0x06, 0xCA, 0x58,
+    0x18, 0x7D, 0x7F, 0xE5, 0x7C, 0x7B, 0xED, 0x9D,
+    0x26, 0xFC, 0xA0, 0x67, 0xB4, 0x11, 0x0E, 0xEF,
+    0xCD, 0x9A, 0x0A, 0x34, 0x5D, 0xE8, 0x72, 0xAB,
+    0xE2, 0x0D, 0xE3, 0x68, 0x00, 0x1B, 0x07, 0x45
+  },
+  {
+    0xB8, 0x93, 0xF2, 0xFC, 0x41, 0xF7, 0xB0, 0xDD,
+    0x6E, 0x2F, 0x6A, 0xA2, 0xE0, 0x37, 0x0C, 0x0C,
+    0xFF, 0x7D, 0xF0, 0x9E, 0x3A, 0xCF, 0xCC, 0x0E,
+    0x92, 0x0B, 0x6E, 0x6F, 0xAD, 0x0E, 0xF7, 0x47,
+    0xC4, 0x06, 0x68, 0x41, 0x7D, 0x34, 0x2B, 0x80,
+    0xD2, 0x35, 0x1E, 0x8C, 0x17, 0x5F, 0x20, 0x89,
+    0x7A, 0x06, 0x2E, 0x97, 0x65, 0xE6, 0xC6, 0x7B,
+    0x53, 0x9B, 0x6B, 0xA8, 0xB9, 0x17, 0x05, 0x45
+  },
+  {
+    0x6C, 0x67, 0xEC, 0x56, 0x97, 0xAC, 0xCD, 0x23,
+    0x5C, 0x59, 0xB4, 0x86, 0xD7, 0xB7, 0x0B, 0xAE,
+    0xED, 0xCB, 0xD4, 0xAA, 0x64, 0xEB, 0xD4, 0xEE,
+    0xF3, 0xC7, 0xEA, 0xC1, 0x89, 0x56, 0x1A, 0x72,
+    0x62, 0x50, 0xAE, 0xC4, 0xD4, 0x8C, 0xAD, 0xCA,
+    0xFB, 0xBE, 0x2C, 0xE3, 0xC1, 0x6C, 0xE2, 0xD6,
+    0x91, 0xA8, 0xCC, 0xE0, 0x6E, 0x88, 0x79, 0x55,
+    0x6D, 0x44, 0x83, 0xED, 0x71, 0x65, 0xC0, 0x63
+  },
+  {
+    0xF1, 0xAA, 0x2B, 0x04, 0x4F, 0x8F, 0x0C, 0x63,
+    0x8A, 0x3F, 0x36, 0x2E, 0x67, 0x7B, 0x5D, 0x89,
+    0x1D, 0x6F, 0xD2, 0xAB, 0x07, 0x65, 0xF6, 0xEE,
+    0x1E, 0x49, 0x87, 0xDE, 0x05, 0x7E, 0xAD, 0x35,
+    0x78, 0x83, 0xD9, 0xB4, 0x05, 0xB9, 0xD6, 0x09,
+    0xEE, 0xA1, 0xB8, 0x69, 0xD9, 0x7F, 0xB1, 0x6D,
+    0x9B, 0x51, 0x01, 0x7C, 0x55, 0x3F, 0x3B, 0x93,
+    0xC0, 0xA1, 0xE0, 0xF1, 0x29, 0x6F, 0xED, 0xCD
+  },
+  {
+    0xCB, 0xAA, 0x25, 0x95, 0x72, 0xD4, 0xAE, 0xBF,
+    0xC1, 0x91, 0x7A, 0xCD, 0xDC, 0x58, 0x2B, 0x9F,
+    0x8D, 0xFA, 0xA9, 0x28, 0xA1, 0x98, 0xCA, 0x7A,
+    0xCD, 0x0F, 0x2A, 0xA7, 0x6A, 0x13, 0x4A, 0x90,
+    0x25, 0x2E, 0x62, 0x98, 0xA6, 0x5B, 0x08, 0x18,
+    0x6A, 0x35, 0x0D, 0x5B, 0x76, 0x26, 0x69, 0x9F,
+    0x8C, 0xB7, 0x21, 0xA3, 0xEA, 0x59, 0x21, 0xB7,
+    0x53, 0xAE, 0x3A, 0x2D, 0xCE, 0x24, 0xBA, 0x3A
+  },
+  {
+    0xFA, 0x15, 0x49, 0xC9, 0x79, 0x6C, 0xD4, 0xD3,
+    0x03, 0xDC, 0xF4, 0x52, 0xC1, 0xFB, 0xD5, 0x74,
+    0x4F, 0xD9, 0xB9, 0xB4, 0x70, 0x03, 0xD9, 0x20,
+    0xB9, 0x2D, 0xE3, 0x48, 0x39, 0xD0, 0x7E, 0xF2,
+    0xA2, 0x9D, 0xED, 0x68, 0xF6, 0xFC, 0x9E, 0x6C,
+    0x45, 0xE0, 0x71, 0xA2, 0xE4, 0x8B, 0xD5, 0x0C,
+    0x50, 0x84, 0xE9, 0x6B, 0x65, 0x7D, 0xD0, 0x40,
+    0x40, 0x45, 0xA1, 0xDD, 0xEF, 0xE2, 0x82, 0xED
+  },
+  {
+    0x5C, 0xF2, 0xAC, 0x89, 0x7A, 0xB4, 0x44, 0xDC,
+    0xB5, 0xC8, 0xD8, 0x7C, 0x49, 0x5D, 0xBD, 0xB3,
+    0x4E, 0x18, 0x38, 0xB6, 0xB6, 0x29, 0x42, 0x7C,
+    0xAA, 0x51, 0x70, 0x2A, 0xD0, 0xF9, 0x68, 0x85,
+    0x25, 0xF1, 0x3B, 0xEC, 0x50, 0x3A, 0x3C, 0x3A,
+    0x2C, 0x80, 0xA6, 0x5E, 0x0B, 0x57, 0x15, 0xE8,
+    0xAF, 0xAB, 0x00, 0xFF, 0xA5, 0x6E, 0xC4, 0x55,
+    0xA4, 0x9A, 0x1A, 0xD3, 0x0A, 0xA2, 0x4F, 0xCD
+  },
+  {
+    0x9A, 0xAF, 0x80, 0x20, 0x7B, 0xAC, 0xE1, 0x7B,
+    0xB7, 0xAB, 0x14, 0x57, 0x57, 0xD5, 0x69, 0x6B,
+    0xDE, 0x32, 0x40, 0x6E, 0xF2, 0x2B, 0x44, 0x29,
+    0x2E, 0xF6, 0x5D, 0x45, 0x19, 0xC3, 0xBB, 0x2A,
+    0xD4, 0x1A, 0x59, 0xB6, 0x2C, 0xC3, 0xE9, 0x4B,
+    0x6F, 0xA9, 0x6D, 0x32, 0xA7, 0xFA, 0xAD, 0xAE,
+    0x28, 0xAF, 0x7D, 0x35, 0x09, 0x72, 0x19, 0xAA,
+    0x3F, 0xD8, 0xCD, 0xA3, 0x1E, 0x40, 0xC2, 0x75
+  },
+  {
+    0xAF, 0x88, 0xB1, 0x63, 0x40, 0x2C, 0x86, 0x74,
+    0x5C, 0xB6, 0x50, 0xC2, 0x98, 0x8F, 0xB9, 0x52,
+    0x11, 0xB9, 0x4B, 0x03, 0xEF, 0x29, 0x0E, 0xED,
+    0x96, 0x62, 0x03, 0x42, 0x41, 0xFD, 0x51, 0xCF,
+    0x39, 0x8F, 0x80, 0x73, 0xE3, 0x69, 0x35, 0x4C,
+    0x43, 0xEA, 0xE1, 0x05, 0x2F, 0x9B, 0x63, 0xB0,
+    0x81, 0x91, 0xCA, 0xA1, 0x38, 0xAA, 0x54, 0xFE,
+    0xA8, 0x89, 0xCC, 0x70, 0x24, 0x23, 0x68, 0x97
+  },
+  {
+    0x48, 0xFA, 0x7D, 0x64, 0xE1, 0xCE, 0xEE, 0x27,
+    0xB9, 0x86, 0x4D, 0xB5, 0xAD, 0xA4, 0xB5, 0x3D,
+    0x00, 0xC9, 0xBC, 0x76, 0x26, 0x55, 0x58, 0x13,
+    0xD3, 0xCD, 0x67, 0x30, 0xAB, 0x3C, 0xC0, 0x6F,
+    0xF3, 0x42, 0xD7, 0x27, 0x90, 0x5E, 0x33, 0x17,
+    0x1B, 0xDE, 0x6E, 0x84, 0x76, 0xE7, 0x7F, 0xB1,
+    0x72, 0x08, 0x61, 0xE9, 0x4B, 0x73, 0xA2, 0xC5,
+    0x38, 0xD2, 0x54, 0x74, 0x62, 0x85, 0xF4, 0x30
+  },
+  {
+    0x0E, 0x6F, 0xD9, 0x7A, 0x85, 0xE9, 0x04, 0xF8,
+    0x7B, 0xFE, 0x85, 0xBB, 0xEB, 0x34, 0xF6, 0x9E,
+    0x1F, 0x18, 0x10, 0x5C, 0xF4, 0xED, 0x4F, 0x87,
+    0xAE, 0xC3, 0x6C, 0x6E, 0x8B, 0x5F, 0x68, 0xBD,
+    0x2A, 0x6F, 0x3D, 0xC8, 0xA9, 0xEC, 0xB2, 0xB6,
+    0x1D, 0xB4, 0xEE, 0xDB, 0x6B, 0x2E, 0xA1, 0x0B,
+    0xF9, 0xCB, 0x02, 0x51, 0xFB, 0x0F, 0x8B, 0x34,
+    0x4A, 0xBF, 0x7F, 0x36, 0x6B, 0x6D, 0xE5, 0xAB
+  },
+  {
+    0x06, 0x62, 0x2D, 0xA5, 0x78, 0x71, 0x76, 0x28,
+    0x7F, 0xDC, 0x8F, 0xED, 0x44, 0x0B, 0xAD, 0x18,
+    0x7D, 0x83, 0x00, 0x99, 0xC9, 0x4E, 0x6D, 0x04,
+    0xC8, 0xE9, 0xC9, 0x54, 0xCD, 0xA7, 0x0C, 0x8B,
+    0xB9, 0xE1, 0xFC, 0x4A, 0x6D, 0x0B, 0xAA, 0x83,
+    0x1B, 0x9B, 0x78, 0xEF, 0x66, 0x48, 0x68, 0x1A,
+    0x48, 0x67, 0xA1, 0x1D, 0xA9, 0x3E, 0xE3, 0x6E,
+    0x5E, 0x6A, 0x37, 0xD8, 0x7F, 0xC6, 0x3F, 0x6F
+  },
+  {
+    0x1D, 0xA6, 0x77, 0x2B, 0x58, 0xFA, 0xBF, 0x9C,
+    0x61, 0xF6, 0x8D, 0x41, 0x2C, 0x82, 0xF1, 0x82,
+    0xC0, 0x23, 0x6D, 0x7D, 0x57, 0x5E, 0xF0, 0xB5,
+    0x8D, 0xD2, 0x24, 0x58, 0xD6, 0x43, 0xCD, 0x1D,
+    0xFC, 0x93, 0xB0, 0x38, 0x71, 0xC3, 0x16, 0xD8,
+    0x43, 0x0D, 0x31, 0x29, 0x95, 0xD4, 0x19, 0x7F,
+    0x08, 0x74, 0xC9, 0x91, 0x72, 0xBA, 0x00, 0x4A,
+    0x01, 0xEE, 0x29, 0x5A, 0xBA, 0xC2, 0x4E, 0x46
+  },
+  {
+    0x3C, 0xD2, 0xD9, 0x32, 0x0B, 0x7B, 0x1D, 0x5F,
+    0xB9, 0xAA, 0xB9, 0x51, 0xA7, 0x60, 0x23, 0xFA,
+    0x66, 0x7B, 0xE1, 0x4A, 0x91, 0x24, 0xE3, 0x94,
+    0x51, 0x39, 0x18, 0xA3, 0xF4, 0x40, 0x96, 0xAE,
+    0x49, 0x04, 0xBA, 0x0F, 0xFC, 0x15, 0x0B, 0x63,
+    0xBC, 0x7A, 0xB1, 0xEE, 0xB9, 0xA6, 0xE2, 0x57,
+    0xE5, 0xC8, 0xF0, 0x00, 0xA7, 0x03, 0x94, 0xA5,
+    0xAF, 0xD8, 0x42, 0x71, 0x5D, 0xE1, 0x5F, 0x29
+  },
+  {
+    0x04, 0xCD, 0xC1, 0x4F, 0x74, 0x34, 0xE0, 0xB4,
+    0xBE, 0x70, 0xCB, 0x41, 0xDB, 0x4C, 0x77, 0x9A,
+    0x88, 0xEA, 0xEF, 0x6A, 0xCC, 0xEB, 0xCB, 0x41,
+    0xF2, 0xD4, 0x2F, 0xFF, 0xE7, 0xF3, 0x2A, 0x8E,
+    0x28, 0x1B, 0x5C, 0x10, 0x3A, 0x27, 0x02, 0x1D,
+    0x0D, 0x08, 0x36, 0x22, 0x50, 0x75, 0x3C, 0xDF,
+    0x70, 0x29, 0x21, 0x95, 0xA5, 0x3A, 0x48, 0x72,
+    0x8C, 0xEB, 0x58, 0x44, 0xC2, 0xD9, 0x8B, 0xAB
+  },
+  {
+    0x90, 0x71, 0xB7, 0xA8, 0xA0, 0x75, 0xD0, 0x09,
+    0x5B, 0x8F, 0xB3, 0xAE, 0x51, 0x13, 0x78, 0x57,
+    0x35, 0xAB, 0x98, 0xE2, 0xB5, 0x2F, 0xAF, 0x91,
+    0xD5, 0xB8, 0x9E, 0x44, 0xAA, 0xC5, 0xB5, 0xD4,
+    0xEB, 0xBF, 0x91, 0x22, 0x3B, 0x0F, 0xF4, 0xC7,
+    0x19, 0x05, 0xDA, 0x55, 0x34, 0x2E, 0x64, 0x65,
+    0x5D, 0x6E, 0xF8, 0xC8, 0x9A, 0x47, 0x68, 0xC3,
+    0xF9, 0x3A, 0x6D, 0xC0, 0x36, 0x6B, 0x5B, 0xC8
+  },
+  {
+    0xEB, 0xB3, 0x02, 0x40, 0xDD, 0x96, 0xC7, 0xBC,
+    0x8D, 0x0A, 0xBE, 0x49, 0xAA, 0x4E, 0xDC, 0xBB,
+    0x4A, 0xFD, 0xC5, 0x1F, 0xF9, 0xAA, 0xF7, 0x20,
+    0xD3, 0xF9, 0xE7, 0xFB, 0xB0, 0xF9, 0xC6, 0xD6,
+    0x57, 0x13, 0x50, 0x50, 0x17, 0x69, 0xFC, 0x4E,
+    0xBD, 0x0B, 0x21, 0x41, 0x24, 0x7F, 0xF4, 0x00,
+    0xD4, 0xFD, 0x4B, 0xE4, 0x14, 0xED, 0xF3, 0x77,
+    0x57, 0xBB, 0x90, 0xA3, 0x2A, 0xC5, 0xC6, 0x5A
+  },
+  {
+    0x85, 0x32, 0xC5, 0x8B, 0xF3, 0xC8, 0x01, 0x5D,
+    0x9D, 0x1C, 0xBE, 0x00, 0xEE, 0xF1, 0xF5, 0x08,
+    0x2F, 0x8F, 0x36, 0x32, 0xFB, 0xE9, 0xF1, 0xED,
+    0x4F, 0x9D, 0xFB, 0x1F, 0xA7, 0x9E, 0x82, 0x83,
+    0x06, 0x6D, 0x77, 0xC4, 0x4C, 0x4A, 0xF9, 0x43,
+    0xD7, 0x6B, 0x30, 0x03, 0x64, 0xAE, 0xCB, 0xD0,
+    0x64, 0x8C, 0x8A, 0x89, 0x39, 0xBD, 0x20, 0x41,
+    0x23, 0xF4, 0xB5, 0x62, 0x60, 0x42, 0x2D, 0xEC
+  },
+  {
+    0xFE, 0x98, 0x46, 0xD6, 0x4F, 0x7C, 0x77, 0x08,
+    0x69, 0x6F, 0x84, 0x0E, 0x2D, 0x76, 0xCB, 0x44,
+    0x08, 0xB6, 0x59, 0x5C, 0x2F, 0x81, 0xEC, 0x6A,
+    0x28, 0xA7, 0xF2, 0xF2, 0x0C, 0xB8, 0x8C, 0xFE,
+    0x6A, 0xC0, 0xB9, 0xE9, 0xB8, 0x24, 0x4F, 0x08,
+    0xBD, 0x70, 0x95, 0xC3, 0x50, 0xC1, 0xD0, 0x84,
+    0x2F, 0x64, 0xFB, 0x01, 0xBB, 0x7F, 0x53, 0x2D,
+    0xFC, 0xD4, 0x73, 0x71, 0xB0, 0xAE, 0xEB, 0x79
+  },
+  {
+    0x28, 0xF1, 0x7E, 0xA6, 0xFB, 0x6C, 0x42, 0x09,
+    0x2D, 0xC2, 0x64, 0x25, 0x7E, 0x29, 0x74, 0x63,
+    0x21, 0xFB, 0x5B, 0xDA, 0xEA, 0x98, 0x73, 0xC2,
+    0xA7, 0xFA, 0x9D, 0x8F, 0x53, 0x81, 0x8E, 0x89,
+    0x9E, 0x16, 0x1B, 0xC7, 0x7D, 0xFE, 0x80, 0x90,
+    0xAF, 0xD8, 0x2B, 0xF2, 0x26, 0x6C, 0x5C, 0x1B,
+    0xC9, 0x30, 0xA8, 0xD1, 0x54, 0x76, 0x24, 0x43,
+    0x9E, 0x66, 0x2E, 0xF6, 0x95, 0xF2, 0x6F, 0x24
+  },
+  {
+    0xEC, 0x6B, 0x7D, 0x7F, 0x03, 0x0D, 0x48, 0x50,
+    0xAC, 0xAE, 0x3C, 0xB6, 0x15, 0xC2, 0x1D, 0xD2,
+    0x52, 0x06, 0xD6, 0x3E, 0x84, 0xD1, 0xDB, 0x8D,
+    0x95, 0x73, 0x70, 0x73, 0x7B, 0xA0, 0xE9, 0x84,
+    0x67, 0xEA, 0x0C, 0xE2, 0x74, 0xC6, 0x61, 0x99,
+    0x90, 0x1E, 0xAE, 0xC1, 0x8A, 0x08, 0x52, 0x57,
+    0x15, 0xF5, 0x3B, 0xFD, 0xB0, 0xAA, 0xCB, 0x61,
+    0x3D, 0x34, 0x2E, 0xBD, 0xCE, 0xED, 0xDC, 0x3B
+  },
+  {
+    0xB4, 0x03, 0xD3, 0x69, 0x1C, 0x03, 0xB0, 0xD3,
+    0x41, 0x8D, 0xF3, 0x27, 0xD5, 0x86, 0x0D, 0x34,
+    0xBB, 0xFC, 0xC4, 0x51, 0x9B, 0xFB, 0xCE, 0x36,
+    0xBF, 0x33, 0xB2, 0x08, 0x38, 0x5F, 0xAD, 0xB9,
+    0x18, 0x6B, 0xC7, 0x8A, 0x76, 0xC4, 0x89, 0xD8,
+    0x9F, 0xD5, 0x7E, 0x7D, 0xC7, 0x54, 0x12, 0xD2,
+    0x3B, 0xCD, 0x1D, 0xAE, 0x84, 0x70, 0xCE, 0x92,
+    0x74, 0x75, 0x4B, 0xB8, 0x58, 0x5B, 0x13, 0xC5
+  },
+  {
+    0x31, 0xFC, 0x79, 0x73, 0x8B, 0x87, 0x72, 0xB3,
+    0xF5, 0x5C, 0xD8, 0x17, 0x88, 0x13, 0xB3, 0xB5,
+    0x2D, 0x0D, 0xB5, 0xA4, 0x19, 0xD3, 0x0B, 0xA9,
+    0x49, 0x5C, 0x4B, 0x9D, 0xA0, 0x21, 0x9F, 0xAC,
+    0x6D, 0xF8, 0xE7, 0xC2, 0x3A, 0x81, 0x15, 0x51,
+    0xA6, 0x2B, 0x82, 0x7F, 0x25, 0x6E, 0xCD, 0xB8,
+    0x12, 0x4A, 0xC8, 0xA6, 0x79, 0x2C, 0xCF, 0xEC,
+    0xC3, 0xB3, 0x01, 0x27, 0x22, 0xE9, 0x44, 0x63
+  },
+  {
+    0xBB, 0x20, 0x39, 0xEC, 0x28, 0x70, 0x91, 0xBC,
+    0xC9, 0x64, 0x2F, 0xC9, 0x00, 0x49, 0xE7, 0x37,
+    0x32, 0xE0, 0x2E, 0x57, 0x7E, 0x28, 0x62, 0xB3,
+    0x22, 0x16, 0xAE, 0x9B, 0xED, 0xCD, 0x73, 0x0C,
+    0x4C, 0x28, 0x4E, 0xF3, 0x96, 0x8C, 0x36, 0x8B,
+    0x7D, 0x37, 0x58, 0x4F, 0x97, 0xBD, 0x4B, 0x4D,
+    0xC6, 0xEF, 0x61, 0x27, 0xAC, 0xFE, 0x2E, 0x6A,
+    0xE2, 0x50, 0x91, 0x24, 0xE6, 0x6C, 0x8A, 0xF4
+  },
+  {
+    0xF5, 0x3D, 0x68, 0xD1, 0x3F, 0x45, 0xED, 0xFC,
+    0xB9, 0xBD, 0x41, 0x5E, 0x28, 0x31, 0xE9, 0x38,
+    0x35, 0x0D, 0x53, 0x80, 0xD3, 0x43, 0x22, 0x78,
+    0xFC, 0x1C, 0x0C, 0x38, 0x1F, 0xCB, 0x7C, 0x65,
+    0xC8, 0x2D, 0xAF, 0xE0, 0x51, 0xD8, 0xC8, 0xB0,
+    0xD4, 0x4E, 0x09, 0x74, 0xA0, 0xE5, 0x9E, 0xC7,
+    0xBF, 0x7E, 0xD0, 0x45, 0x9F, 0x86, 0xE9, 0x6F,
+    0x32, 0x9F, 0xC7, 0x97, 0x52, 0x51, 0x0F, 0xD3
+  },
+  {
+    0x8D, 0x56, 0x8C, 0x79, 0x84, 0xF0, 0xEC, 0xDF,
+    0x76, 0x40, 0xFB, 0xC4, 0x83, 0xB5, 0xD8, 0xC9,
+    0xF8, 0x66, 0x34, 0xF6, 0xF4, 0x32, 0x91, 0x84,
+    0x1B, 0x30, 0x9A, 0x35, 0x0A, 0xB9, 0xC1, 0x13,
+    0x7D, 0x24, 0x06, 0x6B, 0x09, 0xDA, 0x99, 0x44,
+    0xBA, 0xC5, 0x4D, 0x5B, 0xB6, 0x58, 0x0D, 0x83,
+    0x60, 0x47, 0xAA, 0xC7, 0x4A, 0xB7, 0x24, 0xB8,
+    0x87, 0xEB, 0xF9, 0x3D, 0x4B, 0x32, 0xEC, 0xA9
+  },
+  {
+    0xC0, 0xB6, 0x5C, 0xE5, 0xA9, 0x6F, 0xF7, 0x74,
+    0xC4, 0x56, 0xCA, 0xC3, 0xB5, 0xF2, 0xC4, 0xCD,
+    0x35, 0x9B, 0x4F, 0xF5, 0x3E, 0xF9, 0x3A, 0x3D,
+    0xA0, 0x77, 0x8B, 0xE4, 0x90, 0x0D, 0x1E, 0x8D,
+    0xA1, 0x60, 0x1E, 0x76, 0x9E, 0x8F, 0x1B, 0x02,
+    0xD2, 0xA2, 0xF8, 0xC5, 0xB9, 0xFA, 0x10, 0xB4,
+    0x4F, 0x1C, 0x18, 0x69, 0x85, 0x46, 0x8F, 0xEE,
+    0xB0, 0x08, 0x73, 0x02, 0x83, 0xA6, 0x65, 0x7D
+  },
+  {
+    0x49, 0x00, 0xBB, 0xA6, 0xF5, 0xFB, 0x10, 0x3E,
+    0xCE, 0x8E, 0xC9, 0x6A, 0xDA, 0x13, 0xA5, 0xC3,
+    0xC8, 0x54, 0x88, 0xE0, 0x55, 0x51, 0xDA, 0x6B,
+    0x6B, 0x33, 0xD9, 0x88, 0xE6, 0x11, 0xEC, 0x0F,
+    0xE2, 0xE3, 0xC2, 0xAA, 0x48, 0xEA, 0x6A, 0xE8,
+    0x98, 0x6A, 0x3A, 0x23, 0x1B, 0x22, 0x3C, 0x5D,
+    0x27, 0xCE, 0xC2, 0xEA, 0xDD, 0xE9, 0x1C, 0xE0,
+    0x79, 0x81, 0xEE, 0x65, 0x28, 0x62, 0xD1, 0xE4
+  },
+  {
+    0xC7, 0xF5, 0xC3, 0x7C, 0x72, 0x85, 0xF9, 0x27,
+    0xF7, 0x64, 0x43, 0x41, 0x4D, 0x43, 0x57, 0xFF,
+    0x78, 0x96, 0x47, 0xD7, 0xA0, 0x05, 0xA5, 0xA7,
+    0x87, 0xE0, 0x3C, 0x34, 0x6B, 0x57, 0xF4, 0x9F,
+    0x21, 0xB6, 0x4F, 0xA9, 0xCF, 0x4B, 0x7E, 0x45,
+    0x57, 0x3E, 0x23, 0x04, 0x90, 0x17, 0x56, 0x71,
+    0x21, 0xA9, 0xC3, 0xD4, 0xB2, 0xB7, 0x3E, 0xC5,
+    0xE9, 0x41, 0x35, 0x77, 0x52, 0x5D, 0xB4, 0x5A
+  },
+  {
+    0xEC, 0x70, 0x96, 0x33, 0x07, 0x36, 0xFD, 0xB2,
+    0xD6, 0x4B, 0x56, 0x53, 0xE7, 0x47, 0x5D, 0xA7,
+    0x46, 0xC2, 0x3A, 0x46, 0x13, 0xA8, 0x26, 0x87,
+    0xA2, 0x80, 0x62, 0xD3, 0x23, 0x63, 0x64, 0x28,
+    0x4A, 0xC0, 0x17, 0x20, 0xFF, 0xB4, 0x06, 0xCF,
+    0xE2, 0x65, 0xC0, 0xDF, 0x62, 0x6A, 0x18, 0x8C,
+    0x9E, 0x59, 0x63, 0xAC, 0xE5, 0xD3, 0xD5, 0xBB,
+    0x36, 0x3E, 0x32, 0xC3, 0x8C, 0x21, 0x90, 0xA6
+  },
+  {
+    0x82, 0xE7, 0x44, 0xC7, 0x5F, 0x46, 0x49, 0xEC,
+    0x52, 0xB8, 0x07, 0x71, 0xA7, 0x7D, 0x47, 0x5A,
+    0x3B, 0xC0, 0x91, 0x98, 0x95, 0x56, 0x96, 0x0E,
+    0x27, 0x6A, 0x5F, 0x9E, 0xAD, 0x92, 0xA0, 0x3F,
+    0x71, 0x87, 0x42, 0xCD, 0xCF, 0xEA, 0xEE, 0x5C,
+    0xB8, 0x5C, 0x44, 0xAF, 0x19, 0x8A, 0xDC, 0x43,
+    0xA4, 0xA4, 0x28, 0xF5, 0xF0, 0xC2, 0xDD, 0xB0,
+    0xBE, 0x36, 0x05, 0x9F, 0x06, 0xD7, 0xDF, 0x73
+  },
+  {
+    0x28, 0x34, 0xB7, 0xA7, 0x17, 0x0F, 0x1F, 0x5B,
+    0x68, 0x55, 0x9A, 0xB7, 0x8C, 0x10, 0x50, 0xEC,
+    0x21, 0xC9, 0x19, 0x74, 0x0B, 0x78, 0x4A, 0x90,
+    0x72, 0xF6, 0xE5, 0xD6, 0x9F, 0x82, 0x8D, 0x70,
+    0xC9, 0x19, 0xC5, 0x03, 0x9F, 0xB1, 0x48, 0xE3,
+    0x9E, 0x2C, 0x8A, 0x52, 0x11, 0x83, 0x78, 0xB0,
+    0x64, 0xCA, 0x8D, 0x50, 0x01, 0xCD, 0x10, 0xA5,
+    0x47, 0x83, 0x87, 0xB9, 0x66, 0x71, 0x5E, 0xD6
+  },
+  {
+    0x16, 0xB4, 0xAD, 0xA8, 0x83, 0xF7, 0x2F, 0x85,
+    0x3B, 0xB7, 0xEF, 0x25, 0x3E, 0xFC, 0xAB, 0x0C,
+    0x3E, 0x21, 0x61, 0x68, 0x7A, 0xD6, 0x15, 0x43,
+    0xA0, 0xD2, 0x82, 0x4F, 0x91, 0xC1, 0xF8, 0x13,
+    0x47, 0xD8, 0x6B, 0xE7, 0x09, 0xB1, 0x69, 0x96,
+    0xE1, 0x7F, 0x2D, 0xD4, 0x86, 0x92, 0x7B, 0x02,
+    0x88, 0xAD, 0x38, 0xD1, 0x30, 0x63, 0xC4, 0xA9,
+    0x67, 0x2C, 0x39, 0x39, 0x7D, 0x37, 0x89, 0xB6
+  },
+  {
+    0x78, 0xD0, 0x48, 0xF3, 0xA6, 0x9D, 0x8B, 0x54,
+    0xAE, 0x0E, 0xD6, 0x3A, 0x57, 0x3A, 0xE3, 0x50,
+    0xD8, 0x9F, 0x7C, 0x6C, 0xF1, 0xF3, 0x68, 0x89,
+    0x30, 0xDE, 0x89, 0x9A, 0xFA, 0x03, 0x76, 0x97,
+    0x62, 0x9B, 0x31, 0x4E, 0x5C, 0xD3, 0x03, 0xAA,
+    0x62, 0xFE, 0xEA, 0x72, 0xA2, 0x5B, 0xF4, 0x2B,
+    0x30, 0x4B, 0x6C, 0x6B, 0xCB, 0x27, 0xFA, 0xE2,
+    0x1C, 0x16, 0xD9, 0x25, 0xE1, 0xFB, 0xDA, 0xC3
+  },
+  {
+    0x0F, 0x74, 0x6A, 0x48, 0x74, 0x92, 0x87, 0xAD,
+    0xA7, 0x7A, 0x82, 0x96, 0x1F, 0x05, 0xA4, 0xDA,
+    0x4A, 0xBD, 0xB7, 0xD7, 0x7B, 0x12, 0x20, 0xF8,
+    0x36, 0xD0, 0x9E, 0xC8, 0x14, 0x35, 0x9C, 0x0E,
+    0xC0, 0x23, 0x9B, 0x8C, 0x7B, 0x9F, 0xF9, 0xE0,
+    0x2F, 0x56, 0x9D, 0x1B, 0x30, 0x1E, 0xF6, 0x7C,
+    0x46, 0x12, 0xD1, 0xDE, 0x4F, 0x73, 0x0F, 0x81,
+    0xC1, 0x2C, 0x40, 0xCC, 0x06, 0x3C, 0x5C, 0xAA
+  },
+  {
+    0xF0, 0xFC, 0x85, 0x9D, 0x3B, 0xD1, 0x95, 0xFB,
+    0xDC, 0x2D, 0x59, 0x1E, 0x4C, 0xDA, 0xC1, 0x51,
+    0x79, 0xEC, 0x0F, 0x1D, 0xC8, 0x21, 0xC1, 0x1D,
+    0xF1, 0xF0, 0xC1, 0xD2, 0x6E, 0x62, 0x60, 0xAA,
+    0xA6, 0x5B, 0x79, 0xFA, 0xFA, 0xCA, 0xFD, 0x7D,
+    0x3A, 0xD6, 0x1E, 0x60, 0x0F, 0x25, 0x09, 0x05,
+    0xF5, 0x87, 0x8C, 0x87, 0x45, 0x28, 0x97, 0x64,
+    0x7A, 0x35, 0xB9, 0x95, 0xBC, 0xAD, 0xC3, 0xA3
+  },
+  {
+    0x26, 0x20, 0xF6, 0x87, 0xE8, 0x62, 0x5F, 0x6A,
+    0x41, 0x24, 0x60, 0xB4, 0x2E, 0x2C, 0xEF, 0x67,
+    0x63, 0x42, 0x08, 0xCE, 0x10, 0xA0, 0xCB, 0xD4,
+    0xDF, 0xF7, 0x04, 0x4A, 0x41, 0xB7, 0x88, 0x00,
+    0x77, 0xE9, 0xF8, 0xDC, 0x3B, 0x8D, 0x12, 0x16,
+    0xD3, 0x37, 0x6A, 0x21, 0xE0, 0x15, 0xB5, 0x8F,
+    0xB2, 0x79, 0xB5, 0x21, 0xD8, 0x3F, 0x93, 0x88,
+    0xC7, 0x38, 0x2C, 0x85, 0x05, 0x59, 0x0B, 0x9B
+  },
+  {
+    0x22, 0x7E, 0x3A, 0xED, 0x8D, 0x2C, 0xB1, 0x0B,
+    0x91, 0x8F, 0xCB, 0x04, 0xF9, 0xDE, 0x3E, 0x6D,
+    0x0A, 0x57, 0xE0, 0x84, 0x76, 0xD9, 0x37, 0x59,
+    0xCD, 0x7B, 0x2E, 0xD5, 0x4A, 0x1C, 0xBF, 0x02,
+    0x39, 0xC5, 0x28, 0xFB, 0x04, 0xBB, 0xF2, 0x88,
+    0x25, 0x3E, 0x60, 0x1D, 0x3B, 0xC3, 0x8B, 0x21,
+    0x79, 0x4A, 0xFE, 0xF9, 0x0B, 0x17, 0x09, 0x4A,
+    0x18, 0x2C, 0xAC, 0x55, 0x77, 0x45, 0xE7, 0x5F
+  },
+  {
+    0x1A, 0x92, 0x99, 0x01, 0xB0, 0x9C, 0x25, 0xF2,
+    0x7D, 0x6B, 0x35, 0xBE, 0x7B, 0x2F, 0x1C, 0x47,
+    0x45, 0x13, 0x1F, 0xDE, 0xBC, 0xA7, 0xF3, 0xE2,
+    0x45, 0x19, 0x26, 0x72, 0x04, 0x34, 0xE0, 0xDB,
+    0x6E, 0x74, 0xFD, 0x69, 0x3A, 0xD2, 0x9B, 0x77,
+    0x7D, 0xC3, 0x35, 0x5C, 0x59, 0x2A, 0x36, 0x1C,
+    0x48, 0x73, 0xB0, 0x11, 0x33, 0xA5, 0x7C, 0x2E,
+    0x3B, 0x70, 0x75, 0xCB, 0xDB, 0x86, 0xF4, 0xFC
+  },
+  {
+    0x5F, 0xD7, 0x96, 0x8B, 0xC2, 0xFE, 0x34, 0xF2,
+    0x20, 0xB5, 0xE3, 0xDC, 0x5A, 0xF9, 0x57, 0x17,
+    0x42, 0xD7, 0x3B, 0x7D, 0x60, 0x81, 0x9F, 0x28,
+    0x88, 0xB6, 0x29, 0x07, 0x2B, 0x96, 0xA9, 0xD8,
+    0xAB, 0x2D, 0x91, 0xB8, 0x2D, 0x0A, 0x9A, 0xAB,
+    0xA6, 0x1B, 0xBD, 0x39, 0x95, 0x81, 0x32, 0xFC,
+    0xC4, 0x25, 0x70, 0x23, 0xD1, 0xEC, 0xA5, 0x91,
+    0xB3, 0x05, 0x4E, 0x2D, 0xC8, 0x1C, 0x82, 0x00
+  },
+  {
+    0xDF, 0xCC, 0xE8, 0xCF, 0x32, 0x87, 0x0C, 0xC6,
+    0xA5, 0x03, 0xEA, 0xDA, 0xFC, 0x87, 0xFD, 0x6F,
+    0x78, 0x91, 0x8B, 0x9B, 0x4D, 0x07, 0x37, 0xDB,
+    0x68, 0x10, 0xBE, 0x99, 0x6B, 0x54, 0x97, 0xE7,
+    0xE5, 0xCC, 0x80, 0xE3, 0x12, 0xF6, 0x1E, 0x71,
+    0xFF, 0x3E, 0x96, 0x24, 0x43, 0x60, 0x73, 0x15,
+    0x64, 0x03, 0xF7, 0x35, 0xF5, 0x6B, 0x0B, 0x01,
+    0x84, 0x5C, 0x18, 0xF6, 0xCA, 0xF7, 0x72, 0xE6
+  },
+  {
+    0x02, 0xF7, 0xEF, 0x3A, 0x9C, 0xE0, 0xFF, 0xF9,
+    0x60, 0xF6, 0x70, 0x32, 0xB2, 0x96, 0xEF, 0xCA,
+    0x30, 0x61, 0xF4, 0x93, 0x4D, 0x69, 0x07, 0x49,
+    0xF2, 0xD0, 0x1C, 0x35, 0xC8, 0x1C, 0x14, 0xF3,
+    0x9A, 0x67, 0xFA, 0x35, 0x0B, 0xC8, 0xA0, 0x35,
+    0x9B, 0xF1, 0x72, 0x4B, 0xFF, 0xC3, 0xBC, 0xA6,
+    0xD7, 0xC7, 0xBB, 0xA4, 0x79, 0x1F, 0xD5, 0x22,
+    0xA3, 0xAD, 0x35, 0x3C, 0x02, 0xEC, 0x5A, 0xA8
+  },
+  {
+    0x64, 0xBE, 0x5C, 0x6A, 0xBA, 0x65, 0xD5, 0x94,
+    0x84, 0x4A, 0xE7, 0x8B, 0xB0, 0x22, 0xE5, 0xBE,
+    0xBE, 0x12, 0x7F, 0xD6, 0xB6, 0xFF, 0xA5, 0xA1,
+    0x37, 0x03, 0x85, 0x5A, 0xB6, 0x3B, 0x62, 0x4D,
+    0xCD, 0x1A, 0x36, 0x3F, 0x99, 0x20, 0x3F, 0x63,
+    0x2E, 0xC3, 0x86, 0xF3, 0xEA, 0x76, 0x7F, 0xC9,
+    0x92, 0xE8, 0xED, 0x96, 0x86, 0x58, 0x6A, 0xA2,
+    0x75, 0x55, 0xA8, 0x59, 0x9D, 0x5B, 0x80, 0x8F
+  },
+  {
+    0xF7, 0x85, 0x85, 0x50, 0x5C, 0x4E, 0xAA, 0x54,
+    0xA8, 0xB5, 0xBE, 0x70, 0xA6, 0x1E, 0x73, 0x5E,
+    0x0F, 0xF9, 0x7A, 0xF9, 0x44, 0xDD, 0xB3, 0x00,
+    0x1E, 0x35, 0xD8, 0x6C, 0x4E, 0x21, 0x99, 0xD9,
+    0x76, 0x10, 0x4B, 0x6A, 0xE3, 0x17, 0x50, 0xA3,
+    0x6A, 0x72, 0x6E, 0xD2, 0x85, 0x06, 0x4F, 0x59,
+    0x81, 0xB5, 0x03, 0x88, 0x9F, 0xEF, 0x82, 0x2F,
+    0xCD, 0xC2, 0x89, 0x8D, 0xDD, 0xB7, 0x88, 0x9A
+  },
+  {
+    0xE4, 0xB5, 0x56, 0x60, 0x33, 0x86, 0x95, 0x72,
+    0xED, 0xFD, 0x87, 0x47, 0x9A, 0x5B, 0xB7, 0x3C,
+    0x80, 0xE8, 0x75, 0x9B, 0x91, 0x23, 0x28, 0x79,
+    0xD9, 0x6B, 0x1D, 0xDA, 0x36, 0xC0, 0x12, 0x07,
+    0x6E, 0xE5, 0xA2, 0xED, 0x7A, 0xE2, 0xDE, 0x63,
+    0xEF, 0x84, 0x06, 0xA0, 0x6A, 0xEA, 0x82, 0xC1,
+    0x88, 0x03, 0x1B, 0x56, 0x0B, 0xEA, 0xFB, 0x58,
+    0x3F, 0xB3, 0xDE, 0x9E, 0x57, 0x95, 0x2A, 0x7E
+  },
+  {
+    0xE1, 0xB3, 0xE7, 0xED, 0x86, 0x7F, 0x6C, 0x94,
+    0x84, 0xA2, 0xA9, 0x7F, 0x77, 0x15, 0xF2, 0x5E,
+    0x25, 0x29, 0x4E, 0x99, 0x2E, 0x41, 0xF6, 0xA7,
+    0xC1, 0x61, 0xFF, 0xC2, 0xAD, 0xC6, 0xDA, 0xAE,
+    0xB7, 0x11, 0x31, 0x02, 0xD5, 0xE6, 0x09, 0x02,
+    0x87, 0xFE, 0x6A, 0xD9, 0x4C, 0xE5, 0xD6, 0xB7,
+    0x39, 0xC6, 0xCA, 0x24, 0x0B, 0x05, 0xC7, 0x6F,
+    0xB7, 0x3F, 0x25, 0xDD, 0x02, 0x4B, 0xF9, 0x35
+  },
+  {
+    0x85, 0xFD, 0x08, 0x5F, 0xDC, 0x12, 0xA0, 0x80,
+    0x98, 0x3D, 0xF0, 0x7B, 0xD7, 0x01, 0x2B, 0x0D,
+    0x40, 0x2A, 0x0F, 0x40, 0x43, 0xFC, 0xB2, 0x77,
+    0x5A, 0xDF, 0x0B, 0xAD, 0x17, 0x4F, 0x9B, 0x08,
+    0xD1, 0x67, 0x6E, 0x47, 0x69, 0x85, 0x78, 0x5C,
+    0x0A, 0x5D, 0xCC, 0x41, 0xDB, 0xFF, 0x6D, 0x95,
+    0xEF, 0x4D, 0x66, 0xA3, 0xFB, 0xDC, 0x4A, 0x74,
+    0xB8, 0x2B, 0xA5, 0x2D, 0xA0, 0x51, 0x2B, 0x74
+  },
+  {
+    0xAE, 0xD8, 0xFA, 0x76, 0x4B, 0x0F, 0xBF, 0xF8,
+    0x21, 0xE0, 0x52, 0x33, 0xD2, 0xF7, 0xB0, 0x90,
+    0x0E, 0xC4, 0x4D, 0x82, 0x6F, 0x95, 0xE9, 0x3C,
+    0x34, 0x3C, 0x1B, 0xC3, 0xBA, 0x5A, 0x24, 0x37,
+    0x4B, 0x1D, 0x61, 0x6E, 0x7E, 0x7A, 0xBA, 0x45,
+    0x3A, 0x0A, 0xDA, 0x5E, 0x4F, 0xAB, 0x53, 0x82,
+    0x40, 0x9E, 0x0D, 0x42, 0xCE, 0x9C, 0x2B, 0xC7,
+    0xFB, 0x39, 0xA9, 0x9C, 0x34, 0x0C, 0x20, 0xF0
+  },
+  {
+    0x7B, 0xA3, 0xB2, 0xE2, 0x97, 0x23, 0x35, 0x22,
+    0xEE, 0xB3, 0x43, 0xBD, 0x3E, 0xBC, 0xFD, 0x83,
+    0x5A, 0x04, 0x00, 0x77, 0x35, 0xE8, 0x7F, 0x0C,
+    0xA3, 0x00, 0xCB, 0xEE, 0x6D, 0x41, 0x65, 0x65,
+    0x16, 0x21, 0x71, 0x58, 0x1E, 0x40, 0x20, 0xFF,
+    0x4C, 0xF1, 0x76, 0x45, 0x0F, 0x12, 0x91, 0xEA,
+    0x22, 0x85, 0xCB, 0x9E, 0xBF, 0xFE, 0x4C, 0x56,
+    0x66, 0x06, 0x27, 0x68, 0x51, 0x45, 0x05, 0x1C
+  },
+  {
+    0xDE, 0x74, 0x8B, 0xCF, 0x89, 0xEC, 0x88, 0x08,
+    0x47, 0x21, 0xE1, 0x6B, 0x85, 0xF3, 0x0A, 0xDB,
+    0x1A, 0x61, 0x34, 0xD6, 0x64, 0xB5, 0x84, 0x35,
+    0x69, 0xBA, 0xBC, 0x5B, 0xBD, 0x1A, 0x15, 0xCA,
+    0x9B, 0x61, 0x80, 0x3C, 0x90, 0x1A, 0x4F, 0xEF,
+    0x32, 0x96, 0x5A, 0x17, 0x49, 0xC9, 0xF3, 0xA4,
+    0xE2, 0x43, 0xE1, 0x73, 0x93, 0x9D, 0xC5, 0xA8,
+    0xDC, 0x49, 0x5C, 0x67, 0x1A, 0xB5, 0x21, 0x45
+  },
+  {
+    0xAA, 0xF4, 0xD2, 0xBD, 0xF2, 0x00, 0xA9, 0x19,
+    0x70, 0x6D, 0x98, 0x42, 0xDC, 0xE1, 0x6C, 0x98,
+    0x14, 0x0D, 0x34, 0xBC, 0x43, 0x3D, 0xF3, 0x20,
+    0xAB, 0xA9, 0xBD, 0x42, 0x9E, 0x54, 0x9A, 0xA7,
+    0xA3, 0x39, 0x76, 0x52, 0xA4, 0xD7, 0x68, 0x27,
+    0x77, 0x86, 0xCF, 0x99, 0x3C, 0xDE, 0x23, 0x38,
+    0x67, 0x3E, 0xD2, 0xE6, 0xB6, 0x6C, 0x96, 0x1F,
+    0xEF, 0xB8, 0x2C, 0xD2, 0x0C, 0x93, 0x33, 0x8F
+  },
+  {
+    0xC4, 0x08, 0x21, 0x89, 0x68, 0xB7, 0x88, 0xBF,
+    0x86, 0x4F, 0x09, 0x97, 0xE6, 0xBC, 0x4C, 0x3D,
+    0xBA, 0x68, 0xB2, 0x76, 0xE2, 0x12, 0x5A, 0x48,
+    0x43, 0x29, 0x60, 0x52, 0xFF, 0x93, 0xBF, 0x57,
+    0x67, 0xB8, 0xCD, 0xCE, 0x71, 0x31, 0xF0, 0x87,
+    0x64, 0x30, 0xC1, 0x16, 0x5F, 0xEC, 0x6C, 0x4F,
+    0x47, 0xAD, 0xAA, 0x4F, 0xD8, 0xBC, 0xFA, 0xCE,
+    0xF4, 0x63, 0xB5, 0xD3, 0xD0, 0xFA, 0x61, 0xA0
+  },
+  {
+    0x76, 0xD2, 0xD8, 0x19, 0xC9, 0x2B, 0xCE, 0x55,
+    0xFA, 0x8E, 0x09, 0x2A, 0xB1, 0xBF, 0x9B, 0x9E,
+    0xAB, 0x23, 0x7A, 0x25, 0x26, 0x79, 0x86, 0xCA,
+    0xCF, 0x2B, 0x8E, 0xE1, 0x4D, 0x21, 0x4D, 0x73,
+    0x0D, 0xC9, 0xA5, 0xAA, 0x2D, 0x7B, 0x59, 0x6E,
+    0x86, 0xA1, 0xFD, 0x8F, 0xA0, 0x80, 0x4C, 0x77,
+    0x40, 0x2D, 0x2F, 0xCD, 0x45, 0x08, 0x36, 0x88,
+    0xB2, 0x18, 0xB1, 0xCD, 0xFA, 0x0D, 0xCB, 0xCB
+  },
+  {
+    0x72, 0x06, 0x5E, 0xE4, 0xDD, 0x91, 0xC2, 0xD8,
+    0x50, 0x9F, 0xA1, 0xFC, 0x28, 0xA3, 0x7C, 0x7F,
+    0xC9, 0xFA, 0x7D, 0x5B, 0x3F, 0x8A, 0xD3, 0xD0,
+    0xD7, 0xA2, 0x56, 0x26, 0xB5, 0x7B, 0x1B, 0x44,
+    0x78, 0x8D, 0x4C, 0xAF, 0x80, 0x62, 0x90, 0x42,
+    0x5F, 0x98, 0x90, 0xA3, 0xA2, 0xA3, 0x5A, 0x90,
+    0x5A, 0xB4, 0xB3, 0x7A, 0xCF, 0xD0, 0xDA, 0x6E,
+    0x45, 0x17, 0xB2, 0x52, 0x5C, 0x96, 0x51, 0xE4
+  },
+  {
+    0x64, 0x47, 0x5D, 0xFE, 0x76, 0x00, 0xD7, 0x17,
+    0x1B, 0xEA, 0x0B, 0x39, 0x4E, 0x27, 0xC9, 0xB0,
+    0x0D, 0x8E, 0x74, 0xDD, 0x1E, 0x41, 0x6A, 0x79,
+    0x47, 0x36, 0x82, 0xAD, 0x3D, 0xFD, 0xBB, 0x70,
+    0x66, 0x31, 0x55, 0x80, 0x55, 0xCF, 0xC8, 0xA4,
+    0x0E, 0x07, 0xBD, 0x01, 0x5A, 0x45, 0x40, 0xDC,
+    0xDE, 0xA1, 0x58, 0x83, 0xCB, 0xBF, 0x31, 0x41,
+    0x2D, 0xF1, 0xDE, 0x1C, 0xD4, 0x15, 0x2B, 0x91
+  },
+  {
+    0x12, 0xCD, 0x16, 0x74, 0xA4, 0x48, 0x8A, 0x5D,
+    0x7C, 0x2B, 0x31, 0x60, 0xD2, 0xE2, 0xC4, 0xB5,
+    0x83, 0x71, 0xBE, 0xDA, 0xD7, 0x93, 0x41, 0x8D,
+    0x6F, 0x19, 0xC6, 0xEE, 0x38, 0x5D, 0x70, 0xB3,
+    0xE0, 0x67, 0x39, 0x36, 0x9D, 0x4D, 0xF9, 0x10,
+    0xED, 0xB0, 0xB0, 0xA5, 0x4C, 0xBF, 0xF4, 0x3D,
+    0x54, 0x54, 0x4C, 0xD3, 0x7A, 0xB3, 0xA0, 0x6C,
+    0xFA, 0x0A, 0x3D, 0xDA, 0xC8, 0xB6, 0x6C, 0x89
+  },
+  {
+    0x60, 0x75, 0x69, 0x66, 0x47, 0x9D, 0xED, 0xC6,
+    0xDD, 0x4B, 0xCF, 0xF8, 0xEA, 0x7D, 0x1D, 0x4C,
+    0xE4, 0xD4, 0xAF, 0x2E, 0x7B, 0x09, 0x7E, 0x32,
+    0xE3, 0x76, 0x35, 0x18, 0x44, 0x11, 0x47, 0xCC,
+    0x12, 0xB3, 0xC0, 0xEE, 0x6D, 0x2E, 0xCA, 0xBF,
+    0x11, 0x98, 0xCE, 0xC9, 0x2E, 0x86, 0xA3, 0x61,
+    0x6F, 0xBA, 0x4F, 0x4E, 0x87, 0x2F, 0x58, 0x25,
+    0x33, 0x0A, 0xDB, 0xB4, 0xC1, 0xDE, 0xE4, 0x44
+  },
+  {
+    0xA7, 0x80, 0x3B, 0xCB, 0x71, 0xBC, 0x1D, 0x0F,
+    0x43, 0x83, 0xDD, 0xE1, 0xE0, 0x61, 0x2E, 0x04,
+    0xF8, 0x72, 0xB7, 0x15, 0xAD, 0x30, 0x81, 0x5C,
+    0x22, 0x49, 0xCF, 0x34, 0xAB, 0xB8, 0xB0, 0x24,
+    0x91, 0x5C, 0xB2, 0xFC, 0x9F, 0x4E, 0x7C, 0xC4,
+    0xC8, 0xCF, 0xD4, 0x5B, 0xE2, 0xD5, 0xA9, 0x1E,
+    0xAB, 0x09, 0x41, 0xC7, 0xD2, 0x70, 0xE2, 0xDA,
+    0x4C, 0xA4, 0xA9, 0xF7, 0xAC, 0x68, 0x66, 0x3A
+  },
+  {
+    0xB8, 0x4E, 0xF6, 0xA7, 0x22, 0x9A, 0x34, 0xA7,
+    0x50, 0xD9, 0xA9, 0x8E, 0xE2, 0x52, 0x98, 0x71,
+    0x81, 0x6B, 0x87, 0xFB, 0xE3, 0xBC, 0x45, 0xB4,
+    0x5F, 0xA5, 0xAE, 0x82, 0xD5, 0x14, 0x15, 0x40,
+    0x21, 0x11, 0x65, 0xC3, 0xC5, 0xD7, 0xA7, 0x47,
+    0x6B, 0xA5, 0xA4, 0xAA, 0x06, 0xD6, 0x64, 0x76,
+    0xF0, 0xD9, 0xDC, 0x49, 0xA3, 0xF1, 0xEE, 0x72,
+    0xC3, 0xAC, 0xAB, 0xD4, 0x98, 0x96, 0x74, 0x14
+  },
+  {
+    0xFA, 0xE4, 0xB6, 0xD8, 0xEF, 0xC3, 0xF8, 0xC8,
+    0xE6, 0x4D, 0x00, 0x1D, 0xAB, 0xEC, 0x3A, 0x21,
+    0xF5, 0x44, 0xE8, 0x27, 0x14, 0x74, 0x52, 0x51,
+    0xB2, 0xB4, 0xB3, 0x93, 0xF2, 0xF4, 0x3E, 0x0D,
+    0xA3, 0xD4, 0x03, 0xC6, 0x4D, 0xB9, 0x5A, 0x2C,
+    0xB6, 0xE2, 0x3E, 0xBB, 0x7B, 0x9E, 0x94, 0xCD,
+    0xD5, 0xDD, 0xAC, 0x54, 0xF0, 0x7C, 0x4A, 0x61,
+    0xBD, 0x3C, 0xB1, 0x0A, 0xA6, 0xF9, 0x3B, 0x49
+  },
+  {
+    0x34, 0xF7, 0x28, 0x66, 0x05, 0xA1, 0x22, 0x36,
+    0x95, 0x40, 0x14, 0x1D, 0xED, 0x79, 0xB8, 0x95,
+    0x72, 0x55, 0xDA, 0x2D, 0x41, 0x55, 0xAB, 0xBF,
+    0x5A, 0x8D, 0xBB, 0x89, 0xC8, 0xEB, 0x7E, 0xDE,
+    0x8E, 0xEE, 0xF1, 0xDA, 0xA4, 0x6D, 0xC2, 0x9D,
+    0x75, 0x1D, 0x04, 0x5D, 0xC3, 0xB1, 0xD6, 0x58,
+    0xBB, 0x64, 0xB8, 0x0F, 0xF8, 0x58, 0x9E, 0xDD,
+    0xB3, 0x82, 0x4B, 0x13, 0xDA, 0x23, 0x5A, 0x6B
+  },
+  {
+    0x3B, 0x3B, 0x48, 0x43, 0x4B, 0xE2, 0x7B, 0x9E,
+    0xAB, 0xAB, 0xBA, 0x43, 0xBF, 0x6B, 0x35, 0xF1,
+    0x4B, 0x30, 0xF6, 0xA8, 0x8D, 0xC2, 0xE7, 0x50,
+    0xC3, 0x58, 0x47, 0x0D, 0x6B, 0x3A, 0xA3, 0xC1,
+    0x8E, 0x47, 0xDB, 0x40, 0x17, 0xFA, 0x55, 0x10,
+    0x6D, 0x82, 0x52, 0xF0, 0x16, 0x37, 0x1A, 0x00,
+    0xF5, 0xF8, 0xB0, 0x70, 0xB7, 0x4B, 0xA5, 0xF2,
+    0x3C, 0xFF, 0xC5, 0x51, 0x1C, 0x9F, 0x09, 0xF0
+  },
+  {
+    0xBA, 0x28, 0x9E, 0xBD, 0x65, 0x62, 0xC4, 0x8C,
+    0x3E, 0x10, 0xA8, 0xAD, 0x6C, 0xE0, 0x2E, 0x73,
+    0x43, 0x3D, 0x1E, 0x93, 0xD7, 0xC9, 0x27, 0x9D,
+    0x4D, 0x60, 0xA7, 0xE8, 0x79, 0xEE, 0x11, 0xF4,
+    0x41, 0xA0, 0x00, 0xF4, 0x8E, 0xD9, 0xF7, 0xC4,
+    0xED, 0x87, 0xA4, 0x51, 0x36, 0xD7, 0xDC, 0xCD,
+    0xCA, 0x48, 0x21, 0x09, 0xC7, 0x8A, 0x51, 0x06,
+    0x2B, 0x3B, 0xA4, 0x04, 0x4A, 0xDA, 0x24, 0x69
+  },
+  {
+    0x02, 0x29, 0x39, 0xE2, 0x38, 0x6C, 0x5A, 0x37,
+    0x04, 0x98, 0x56, 0xC8, 0x50, 0xA2, 0xBB, 0x10,
+    0xA1, 0x3D, 0xFE, 0xA4, 0x21, 0x2B, 0x4C, 0x73,
+    0x2A, 0x88, 0x40, 0xA9, 0xFF, 0xA5, 0xFA, 0xF5,
+    0x48, 0x75, 0xC5, 0x44, 0x88, 0x16, 0xB2, 0x78,
+    0x5A, 0x00, 0x7D, 0xA8, 0xA8, 0xD2, 0xBC, 0x7D,
+    0x71, 0xA5, 0x4E, 0x4E, 0x65, 0x71, 0xF1, 0x0B,
+    0x60, 0x0C, 0xBD, 0xB2, 0x5D, 0x13, 0xED, 0xE3
+  },
+  {
+    0xE6, 0xFE, 0xC1, 0x9D, 0x89, 0xCE, 0x87, 0x17,
+    0xB1, 0xA0, 0x87, 0x02, 0x46, 0x70, 0xFE, 0x02,
+    0x6F, 0x6C, 0x7C, 0xBD, 0xA1, 0x1C, 0xAE, 0xF9,
+    0x59, 0xBB, 0x2D, 0x35, 0x1B, 0xF8, 0x56, 0xF8,
+    0x05, 0x5D, 0x1C, 0x0E, 0xBD, 0xAA, 0xA9, 0xD1,
+    0xB1, 0x78, 0x86, 0xFC, 0x2C, 0x56, 0x2B, 0x5E,
+    0x99, 0x64, 0x2F, 0xC0, 0x64, 0x71, 0x0C, 0x0D,
+    0x34, 0x88, 0xA0, 0x2B, 0x5E, 0xD7, 0xF6, 0xFD
+  },
+  {
+    0x94, 0xC9, 0x6F, 0x02, 0xA8, 0xF5, 0x76, 0xAC,
+    0xA3, 0x2B, 0xA6, 0x1C, 0x2B, 0x20, 0x6F, 0x90,
+    0x72, 0x85, 0xD9, 0x29, 0x9B, 0x83, 0xAC, 0x17,
+    0x5C, 0x20, 0x9A, 0x8D, 0x43, 0xD5, 0x3B, 0xFE,
+    0x68, 0x3D, 0xD1, 0xD8, 0x3E, 0x75, 0x49, 0xCB,
+    0x90, 0x6C, 0x28, 0xF5, 0x9A, 0xB7, 0xC4, 0x6F,
+    0x87, 0x51, 0x36, 0x6A, 0x28, 0xC3, 0x9D, 0xD5,
+    0xFE, 0x26, 0x93, 0xC9, 0x01, 0x96, 0x66, 0xC8
+  },
+  {
+    0x31, 0xA0, 0xCD, 0x21, 0x5E, 0xBD, 0x2C, 0xB6,
+    0x1D, 0xE5, 0xB9, 0xED, 0xC9, 0x1E, 0x61, 0x95,
+    0xE3, 0x1C, 0x59, 0xA5, 0x64, 0x8D, 0x5C, 0x9F,
+    0x73, 0x7E, 0x12, 0x5B, 0x26, 0x05, 0x70, 0x8F,
+    0x2E, 0x32, 0x5A, 0xB3, 0x38, 0x1C, 0x8D, 0xCE,
+    0x1A, 0x3E, 0x95, 0x88, 0x86, 0xF1, 0xEC, 0xDC,
+    0x60, 0x31, 0x8F, 0x88, 0x2C, 0xFE, 0x20, 0xA2,
+    0x41, 0x91, 0x35, 0x2E, 0x61, 0x7B, 0x0F, 0x21
+  },
+  {
+    0x91, 0xAB, 0x50, 0x4A, 0x52, 0x2D, 0xCE, 0x78,
+    0x77, 0x9F, 0x4C, 0x6C, 0x6B, 0xA2, 0xE6, 0xB6,
+    0xDB, 0x55, 0x65, 0xC7, 0x6D, 0x3E, 0x7E, 0x7C,
+    0x92, 0x0C, 0xAF, 0x7F, 0x75, 0x7E, 0xF9, 0xDB,
+    0x7C, 0x8F, 0xCF, 0x10, 0xE5, 0x7F, 0x03, 0x37,
+    0x9E, 0xA9, 0xBF, 0x75, 0xEB, 0x59, 0x89, 0x5D,
+    0x96, 0xE1, 0x49, 0x80, 0x0B, 0x6A, 0xAE, 0x01,
+    0xDB, 0x77, 0x8B, 0xB9, 0x0A, 0xFB, 0xC9, 0x89
+  },
+  {
+    0xD8, 0x5C, 0xAB, 0xC6, 0xBD, 0x5B, 0x1A, 0x01,
+    0xA5, 0xAF, 0xD8, 0xC6, 0x73, 0x47, 0x40, 0xDA,
+    0x9F, 0xD1, 0xC1, 0xAC, 0xC6, 0xDB, 0x29, 0xBF,
+    0xC8, 0xA2, 0xE5, 0xB6, 0x68, 0xB0, 0x28, 0xB6,
+    0xB3, 0x15, 0x4B, 0xFB, 0x87, 0x03, 0xFA, 0x31,
+    0x80, 0x25, 0x1D, 0x58, 0x9A, 0xD3, 0x80, 0x40,
+    0xCE, 0xB7, 0x07, 0xC4, 0xBA, 0xD1, 0xB5, 0x34,
+    0x3C, 0xB4, 0x26, 0xB6, 0x1E, 0xAA, 0x49, 0xC1
+  },
+  {
+    0xD6, 0x2E, 0xFB, 0xEC, 0x2C, 0xA9, 0xC1, 0xF8,
+    0xBD, 0x66, 0xCE, 0x8B, 0x3F, 0x6A, 0x89, 0x8C,
+    0xB3, 0xF7, 0x56, 0x6B, 0xA6, 0x56, 0x8C, 0x61,
+    0x8A, 0xD1, 0xFE, 0xB2, 0xB6, 0x5B, 0x76, 0xC3,
+    0xCE, 0x1D, 0xD2, 0x0F, 0x73, 0x95, 0x37, 0x2F,
+    0xAF, 0x28, 0x42, 0x7F, 0x61, 0xC9, 0x27, 0x80,
+    0x49, 0xCF, 0x01, 0x40, 0xDF, 0x43, 0x4F, 0x56,
+    0x33, 0x04, 0x8C, 0x86, 0xB8, 0x1E, 0x03, 0x99
+  },
+  {
+    0x7C, 0x8F, 0xDC, 0x61, 0x75, 0x43, 0x9E, 0x2C,
+    0x3D, 0xB1, 0x5B, 0xAF, 0xA7, 0xFB, 0x06, 0x14,
+    0x3A, 0x6A, 0x23, 0xBC, 0x90, 0xF4, 0x49, 0xE7,
+    0x9D, 0xEE, 0xF7, 0x3C, 0x3D, 0x49, 0x2A, 0x67,
+    0x17, 0x15, 0xC1, 0x93, 0xB6, 0xFE, 0xA9, 0xF0,
+    0x36, 0x05, 0x0B, 0x94, 0x60, 0x69, 0x85, 0x6B,
+    0x89, 0x7E, 0x08, 0xC0, 0x07, 0x68, 0xF5, 0xEE,
+    0x5D, 0xDC, 0xF7, 0x0B, 0x7C, 0xD6, 0xD0, 0xE0
+  },
+  {
+    0x58, 0x60, 0x2E, 0xE7, 0x46, 0x8E, 0x6B, 0xC9,
+    0xDF, 0x21, 0xBD, 0x51, 0xB2, 0x3C, 0x00, 0x5F,
+    0x72, 0xD6, 0xCB, 0x01, 0x3F, 0x0A, 0x1B, 0x48,
+    0xCB, 0xEC, 0x5E, 0xCA, 0x29, 0x92, 0x99, 0xF9,
+    0x7F, 0x09, 0xF5, 0x4A, 0x9A, 0x01, 0x48, 0x3E,
+    0xAE, 0xB3, 0x15, 0xA6, 0x47, 0x8B, 0xAD, 0x37,
+    0xBA, 0x47, 0xCA, 0x13, 0x47, 0xC7, 0xC8, 0xFC,
+    0x9E, 0x66, 0x95, 0x59, 0x2C, 0x91, 0xD7, 0x23
+  },
+  {
+    0x27, 0xF5, 0xB7, 0x9E, 0xD2, 0x56, 0xB0, 0x50,
+    0x99, 0x3D, 0x79, 0x34, 0x96, 0xED, 0xF4, 0x80,
+    0x7C, 0x1D, 0x85, 0xA7, 0xB0, 0xA6, 0x7C, 0x9C,
+    0x4F, 0xA9, 0x98, 0x60, 0x75, 0x0B, 0x0A, 0xE6,
+    0x69, 0x89, 0x67, 0x0A, 0x8F, 0xFD, 0x78, 0x56,
+    0xD7, 0xCE, 0x41, 0x15, 0x99, 0xE5, 0x8C, 0x4D,
+    0x77, 0xB2, 0x32, 0xA6, 0x2B, 0xEF, 0x64, 0xD1,
+    0x52, 0x75, 0xBE, 0x46, 0xA6, 0x82, 0x35, 0xFF
+  },
+  {
+    0x39, 0x57, 0xA9, 0x76, 0xB9, 0xF1, 0x88, 0x7B,
+    0xF0, 0x04, 0xA8, 0xDC, 0xA9, 0x42, 0xC9, 0x2D,
+    0x2B, 0x37, 0xEA, 0x52, 0x60, 0x0F, 0x25, 0xE0,
+    0xC9, 0xBC, 0x57, 0x07, 0xD0, 0x27, 0x9C, 0x00,
+    0xC6, 0xE8, 0x5A, 0x83, 0x9B, 0x0D, 0x2D, 0x8E,
+    0xB5, 0x9C, 0x51, 0xD9, 0x47, 0x88, 0xEB, 0xE6,
+    0x24, 0x74, 0xA7, 0x91, 0xCA, 0xDF, 0x52, 0xCC,
+    0xCF, 0x20, 0xF5, 0x07, 0x0B, 0x65, 0x73, 0xFC
+  },
+  {
+    0xEA, 0xA2, 0x37, 0x6D, 0x55, 0x38, 0x0B, 0xF7,
+    0x72, 0xEC, 0xCA, 0x9C, 0xB0, 0xAA, 0x46, 0x68,
+    0xC9, 0x5C, 0x70, 0x71, 0x62, 0xFA, 0x86, 0xD5,
+    0x18, 0xC8, 0xCE, 0x0C, 0xA9, 0xBF, 0x73, 0x62,
+    0xB9, 0xF2, 0xA0, 0xAD, 0xC3, 0xFF, 0x59, 0x92,
+    0x2D, 0xF9, 0x21, 0xB9, 0x45, 0x67, 0xE8, 0x1E,
+    0x45, 0x2F, 0x6C, 0x1A, 0x07, 0xFC, 0x81, 0x7C,
+    0xEB, 0xE9, 0x96, 0x04, 0xB3, 0x50, 0x5D, 0x38
+  },
+  {
+    0xC1, 0xE2, 0xC7, 0x8B, 0x6B, 0x27, 0x34, 0xE2,
+    0x48, 0x0E, 0xC5, 0x50, 0x43, 0x4C, 0xB5, 0xD6,
+    0x13, 0x11, 0x1A, 0xDC, 0xC2, 0x1D, 0x47, 0x55,
+    0x45, 0xC3, 0xB1, 0xB7, 0xE6, 0xFF, 0x12, 0x44,
+    0x44, 0x76, 0xE5, 0xC0, 0x55, 0x13, 0x2E, 0x22,
+    0x29, 0xDC, 0x0F, 0x80, 0x70, 0x44, 0xBB, 0x91,
+    0x9B, 0x1A, 0x56, 0x62, 0xDD, 0x38, 0xA9, 0xEE,
+    0x65, 0xE2, 0x43, 0xA3, 0x91, 0x1A, 0xED, 0x1A
+  },
+  {
+    0x8A, 0xB4, 0x87, 0x13, 0x38, 0x9D, 0xD0, 0xFC,
+    0xF9, 0xF9, 0x65, 0xD3, 0xCE, 0x66, 0xB1, 0xE5,
+    0x59, 0xA1, 0xF8, 0xC5, 0x87, 0x41, 0xD6, 0x76,
+    0x83, 0xCD, 0x97, 0x13, 0x54, 0xF4, 0x52, 0xE6,
+    0x2D, 0x02, 0x07, 0xA6, 0x5E, 0x43, 0x6C, 0x5D,
+    0x5D, 0x8F, 0x8E, 0xE7, 0x1C, 0x6A, 0xBF, 0xE5,
+    0x0E, 0x66, 0x90, 0x04, 0xC3, 0x02, 0xB3, 0x1A,
+    0x7E, 0xA8, 0x31, 0x1D, 0x4A, 0x91, 0x60, 0x51
+  },
+  {
+    0x24, 0xCE, 0x0A, 0xDD, 0xAA, 0x4C, 0x65, 0x03,
+    0x8B, 0xD1, 0xB1, 0xC0, 0xF1, 0x45, 0x2A, 0x0B,
+    0x12, 0x87, 0x77, 0xAA, 0xBC, 0x94, 0xA2, 0x9D,
+    0xF2, 0xFD, 0x6C, 0x7E, 0x2F, 0x85, 0xF8, 0xAB,
+    0x9A, 0xC7, 0xEF, 0xF5, 0x16, 0xB0, 0xE0, 0xA8,
+    0x25, 0xC8, 0x4A, 0x24, 0xCF, 0xE4, 0x92, 0xEA,
+    0xAD, 0x0A, 0x63, 0x08, 0xE4, 0x6D, 0xD4, 0x2F,
+    0xE8, 0x33, 0x3A, 0xB9, 0x71, 0xBB, 0x30, 0xCA
+  },
+  {
+    0x51, 0x54, 0xF9, 0x29, 0xEE, 0x03, 0x04, 0x5B,
+    0x6B, 0x0C, 0x00, 0x04, 0xFA, 0x77, 0x8E, 0xDE,
+    0xE1, 0xD1, 0x39, 0x89, 0x32, 0x67, 0xCC, 0x84,
+    0x82, 0x5A, 0xD7, 0xB3, 0x6C, 0x63, 0xDE, 0x32,
+    0x79, 0x8E, 0x4A, 0x16, 0x6D, 0x24, 0x68, 0x65,
+    0x61, 0x35, 0x4F, 0x63, 0xB0, 0x07, 0x09, 0xA1,
+    0x36, 0x4B, 0x3C, 0x24, 0x1D, 0xE3, 0xFE, 0xBF,
+    0x07, 0x54, 0x04, 0x58, 0x97, 0x46, 0x7C, 0xD4
+  },
+  {
+    0xE7, 0x4E, 0x90, 0x79, 0x20, 0xFD, 0x87, 0xBD,
+    0x5A, 0xD6, 0x36, 0xDD, 0x11, 0x08, 0x5E, 0x50,
+    0xEE, 0x70, 0x45, 0x9C, 0x44, 0x3E, 0x1C, 0xE5,
+    0x80, 0x9A, 0xF2, 0xBC, 0x2E, 0xBA, 0x39, 0xF9,
+    0xE6, 0xD7, 0x12, 0x8E, 0x0E, 0x37, 0x12, 0xC3,
+    0x16, 0xDA, 0x06, 0xF4, 0x70, 0x5D, 0x78, 0xA4,
+    0x83, 0x8E, 0x28, 0x12, 0x1D, 0x43, 0x44, 0xA2,
+    0xC7, 0x9C, 0x5E, 0x0D, 0xB3, 0x07, 0xA6, 0x77
+  },
+  {
+    0xBF, 0x91, 0xA2, 0x23, 0x34, 0xBA, 0xC2, 0x0F,
+    0x3F, 0xD8, 0x06, 0x63, 0xB3, 0xCD, 0x06, 0xC4,
+    0xE8, 0x80, 0x2F, 0x30, 0xE6, 0xB5, 0x9F, 0x90,
+    0xD3, 0x03, 0x5C, 0xC9, 0x79, 0x8A, 0x21, 0x7E,
+    0xD5, 0xA3, 0x1A, 0xBB, 0xDA, 0x7F, 0xA6, 0x84,
+    0x28, 0x27, 0xBD, 0xF2, 0xA7, 0xA1, 0xC2, 0x1F,
+    0x6F, 0xCF, 0xCC, 0xBB, 0x54, 0xC6, 0xC5, 0x29,
+    0x26, 0xF3, 0x2D, 0xA8, 0x16, 0x26, 0x9B, 0xE1
+  },
+  {
+    0xD9, 0xD5, 0xC7, 0x4B, 0xE5, 0x12, 0x1B, 0x0B,
+    0xD7, 0x42, 0xF2, 0x6B, 0xFF, 0xB8, 0xC8, 0x9F,
+    0x89, 0x17, 0x1F, 0x3F, 0x93, 0x49, 0x13, 0x49,
+    0x2B, 0x09, 0x03, 0xC2, 0x71, 0xBB, 0xE2, 0xB3,
+    0x39, 0x5E, 0xF2, 0x59, 0x66, 0x9B, 0xEF, 0x43,
+    0xB5, 0x7F, 0x7F, 0xCC, 0x30, 0x27, 0xDB, 0x01,
+    0x82, 0x3F, 0x6B, 0xAE, 0xE6, 0x6E, 0x4F, 0x9F,
+    0xEA, 0xD4, 0xD6, 0x72, 0x6C, 0x74, 0x1F, 0xCE
+  },
+  {
+    0x50, 0xC8, 0xB8, 0xCF, 0x34, 0xCD, 0x87, 0x9F,
+    0x80, 0xE2, 0xFA, 0xAB, 0x32, 0x30, 0xB0, 0xC0,
+    0xE1, 0xCC, 0x3E, 0x9D, 0xCA, 0xDE, 0xB1, 0xB9,
+    0xD9, 0x7A, 0xB9, 0x23, 0x41, 0x5D, 0xD9, 0xA1,
+    0xFE, 0x38, 0xAD, 0xDD, 0x5C, 0x11, 0x75, 0x6C,
+    0x67, 0x99, 0x0B, 0x25, 0x6E, 0x95, 0xAD, 0x6D,
+    0x8F, 0x9F, 0xED, 0xCE, 0x10, 0xBF, 0x1C, 0x90,
+    0x67, 0x9C, 0xDE, 0x0E, 0xCF, 0x1B, 0xE3, 0x47
+  },
+  {
+    0x0A, 0x38, 0x6E, 0x7C, 0xD5, 0xDD, 0x9B, 0x77,
+    0xA0, 0x35, 0xE0, 0x9F, 0xE6, 0xFE, 0xE2, 0xC8,
+    0xCE, 0x61, 0xB5, 0x38, 0x3C, 0x87, 0xEA, 0x43,
+    0x20, 0x50, 0x59, 0xC5, 0xE4, 0xCD, 0x4F, 0x44,
+    0x08, 0x31, 0x9B, 0xB0, 0xA8, 0x23, 0x60, 0xF6,
+    0xA5, 0x8E, 0x6C, 0x9C, 0xE3, 0xF4, 0x87, 0xC4,
+    0x46, 0x06, 0x3B, 0xF8, 0x13, 0xBC, 0x6B, 0xA5,
+    0x35, 0xE1, 0x7F, 0xC1, 0x82, 0x6C, 0xFC, 0x91
+  },
+  {
+    0x1F, 0x14, 0x59, 0xCB, 0x6B, 0x61, 0xCB, 0xAC,
+    0x5F, 0x0E, 0xFE, 0x8F, 0xC4, 0x87, 0x53, 0x8F,
+    0x42, 0x54, 0x89, 0x87, 0xFC, 0xD5, 0x62, 0x21,
+    0xCF, 0xA7, 0xBE, 0xB2, 0x25, 0x04, 0x76, 0x9E,
+    0x79, 0x2C, 0x45, 0xAD, 0xFB, 0x1D, 0x6B, 0x3D,
+    0x60, 0xD7, 0xB7, 0x49, 0xC8, 0xA7, 0x5B, 0x0B,
+    0xDF, 0x14, 0xE8, 0xEA, 0x72, 0x1B, 0x95, 0xDC,
+    0xA5, 0x38, 0xCA, 0x6E, 0x25, 0x71, 0x12, 0x09
+  },
+  {
+    0xE5, 0x8B, 0x38, 0x36, 0xB7, 0xD8, 0xFE, 0xDB,
+    0xB5, 0x0C, 0xA5, 0x72, 0x5C, 0x65, 0x71, 0xE7,
+    0x4C, 0x07, 0x85, 0xE9, 0x78, 0x21, 0xDA, 0xB8,
+    0xB6, 0x29, 0x8C, 0x10, 0xE4, 0xC0, 0x79, 0xD4,
+    0xA6, 0xCD, 0xF2, 0x2F, 0x0F, 0xED, 0xB5, 0x50,
+    0x32, 0x92, 0x5C, 0x16, 0x74, 0x81, 0x15, 0xF0,
+    0x1A, 0x10, 0x5E, 0x77, 0xE0, 0x0C, 0xEE, 0x3D,
+    0x07, 0x92, 0x4D, 0xC0, 0xD8, 0xF9, 0x06, 0x59
+  },
+  {
+    0xB9, 0x29, 0xCC, 0x65, 0x05, 0xF0, 0x20, 0x15,
+    0x86, 0x72, 0xDE, 0xDA, 0x56, 0xD0, 0xDB, 0x08,
+    0x1A, 0x2E, 0xE3, 0x4C, 0x00, 0xC1, 0x10, 0x00,
+    0x29, 0xBD, 0xF8, 0xEA, 0x98, 0x03, 0x4F, 0xA4,
+    0xBF, 0x3E, 0x86, 0x55, 0xEC, 0x69, 0x7F, 0xE3,
+    0x6F, 0x40, 0x55, 0x3C, 0x5B, 0xB4, 0x68, 0x01,
+    0x64, 0x4A, 0x62, 0x7D, 0x33, 0x42, 0xF4, 0xFC,
+    0x92, 0xB6, 0x1F, 0x03, 0x29, 0x0F, 0xB3, 0x81
+  },
+  {
+    0x72, 0xD3, 0x53, 0x99, 0x4B, 0x49, 0xD3, 0xE0,
+    0x31, 0x53, 0x92, 0x9A, 0x1E, 0x4D, 0x4F, 0x18,
+    0x8E, 0xE5, 0x8A, 0xB9, 0xE7, 0x2E, 0xE8, 0xE5,
+    0x12, 0xF2, 0x9B, 0xC7, 0x73, 0x91, 0x38, 0x19,
+    0xCE, 0x05, 0x7D, 0xDD, 0x70, 0x02, 0xC0, 0x43,
+    0x3E, 0xE0, 0xA1, 0x61, 0x14, 0xE3, 0xD1, 0x56,
+    0xDD, 0x2C, 0x4A, 0x7E, 0x80, 0xEE, 0x53, 0x37,
+    0x8B, 0x86, 0x70, 0xF2, 0x3E, 0x33, 0xEF, 0x56
+  },
+  {
+    0xC7, 0x0E, 0xF9, 0xBF, 0xD7, 0x75, 0xD4, 0x08,
+    0x17, 0x67, 0x37, 0xA0, 0x73, 0x6D, 0x68, 0x51,
+    0x7C, 0xE1, 0xAA, 0xAD, 0x7E, 0x81, 0xA9, 0x3C,
+    0x8C, 0x1E, 0xD9, 0x67, 0xEA, 0x21, 0x4F, 0x56,
+    0xC8, 0xA3, 0x77, 0xB1, 0x76, 0x3E, 0x67, 0x66,
+    0x15, 0xB6, 0x0F, 0x39, 0x88, 0x24, 0x1E, 0xAE,
+    0x6E, 0xAB, 0x96, 0x85, 0xA5, 0x12, 0x49, 0x29,
+    0xD2, 0x81, 0x88, 0xF2, 0x9E, 0xAB, 0x06, 0xF7
+  },
+  {
+    0xC2, 0x30, 0xF0, 0x80, 0x26, 0x79, 0xCB, 0x33,
+    0x82, 0x2E, 0xF8, 0xB3, 0xB2, 0x1B, 0xF7, 0xA9,
+    0xA2, 0x89, 0x42, 0x09, 0x29, 0x01, 0xD7, 0xDA,
+    0xC3, 0x76, 0x03, 0x00, 0x83, 0x10, 0x26, 0xCF,
+    0x35, 0x4C, 0x92, 0x32, 0xDF, 0x3E, 0x08, 0x4D,
+    0x99, 0x03, 0x13, 0x0C, 0x60, 0x1F, 0x63, 0xC1,
+    0xF4, 0xA4, 0xA4, 0xB8, 0x10, 0x6E, 0x46, 0x8C,
+    0xD4, 0x43, 0xBB, 0xE5, 0xA7, 0x34, 0xF4, 0x5F
+  },
+  {
+    0x6F, 0x43, 0x09, 0x4C, 0xAF, 0xB5, 0xEB, 0xF1,
+    0xF7, 0xA4, 0x93, 0x7E, 0xC5, 0x0F, 0x56, 0xA4,
+    0xC9, 0xDA, 0x30, 0x3C, 0xBB, 0x55, 0xAC, 0x1F,
+    0x27, 0xF1, 0xF1, 0x97, 0x6C, 0xD9, 0x6B, 0xED,
+    0xA9, 0x46, 0x4F, 0x0E, 0x7B, 0x9C, 0x54, 0x62,
+    0x0B, 0x8A, 0x9F, 0xBA, 0x98, 0x31, 0x64, 0xB8,
+    0xBE, 0x35, 0x78, 0x42, 0x5A, 0x02, 0x4F, 0x5F,
+    0xE1, 0x99, 0xC3, 0x63, 0x56, 0xB8, 0x89, 0x72
+  },
+  {
+    0x37, 0x45, 0x27, 0x3F, 0x4C, 0x38, 0x22, 0x5D,
+    0xB2, 0x33, 0x73, 0x81, 0x87, 0x1A, 0x0C, 0x6A,
+    0xAF, 0xD3, 0xAF, 0x9B, 0x01, 0x8C, 0x88, 0xAA,
+    0x02, 0x02, 0x58, 0x50, 0xA5, 0xDC, 0x3A, 0x42,
+    0xA1, 0xA3, 0xE0, 0x3E, 0x56, 0xCB, 0xF1, 0xB0,
+    0x87, 0x6D, 0x63, 0xA4, 0x41, 0xF1, 0xD2, 0x85,
+    0x6A, 0x39, 0xB8, 0x80, 0x1E, 0xB5, 0xAF, 0x32,
+    0x52, 0x01, 0xC4, 0x15, 0xD6, 0x5E, 0x97, 0xFE
+  },
+  {
+    0xC5, 0x0C, 0x44, 0xCC, 0xA3, 0xEC, 0x3E, 0xDA,
+    0xAE, 0x77, 0x9A, 0x7E, 0x17, 0x94, 0x50, 0xEB,
+    0xDD, 0xA2, 0xF9, 0x70, 0x67, 0xC6, 0x90, 0xAA,
+    0x6C, 0x5A, 0x4A, 0xC7, 0xC3, 0x01, 0x39, 0xBB,
+    0x27, 0xC0, 0xDF, 0x4D, 0xB3, 0x22, 0x0E, 0x63,
+    0xCB, 0x11, 0x0D, 0x64, 0xF3, 0x7F, 0xFE, 0x07,
+    0x8D, 0xB7, 0x26, 0x53, 0xE2, 0xDA, 0xAC, 0xF9,
+    0x3A, 0xE3, 0xF0, 0xA2, 0xD1, 0xA7, 0xEB, 0x2E
+  },
+  {
+    0x8A, 0xEF, 0x26, 0x3E, 0x38, 0x5C, 0xBC, 0x61,
+    0xE1, 0x9B, 0x28, 0x91, 0x42, 0x43, 0x26, 0x2A,
+    0xF5, 0xAF, 0xE8, 0x72, 0x6A, 0xF3, 0xCE, 0x39,
+    0xA7, 0x9C, 0x27, 0x02, 0x8C, 0xF3, 0xEC, 0xD3,
+    0xF8, 0xD2, 0xDF, 0xD9, 0xCF, 0xC9, 0xAD, 0x91,
+    0xB5, 0x8F, 0x6F, 0x20, 0x77, 0x8F, 0xD5, 0xF0,
+    0x28, 0x94, 0xA3, 0xD9, 0x1C, 0x7D, 0x57, 0xD1,
+    0xE4, 0xB8, 0x66, 0xA7, 0xF3, 0x64, 0xB6, 0xBE
+  },
+  {
+    0x28, 0x69, 0x61, 0x41, 0xDE, 0x6E, 0x2D, 0x9B,
+    0xCB, 0x32, 0x35, 0x57, 0x8A, 0x66, 0x16, 0x6C,
+    0x14, 0x48, 0xD3, 0xE9, 0x05, 0xA1, 0xB4, 0x82,
+    0xD4, 0x23, 0xBE, 0x4B, 0xC5, 0x36, 0x9B, 0xC8,
+    0xC7, 0x4D, 0xAE, 0x0A, 0xCC, 0x9C, 0xC1, 0x23,
+    0xE1, 0xD8, 0xDD, 0xCE, 0x9F, 0x97, 0x91, 0x7E,
+    0x8C, 0x01, 0x9C, 0x55, 0x2D, 0xA3, 0x2D, 0x39,
+    0xD2, 0x21, 0x9B, 0x9A, 0xBF, 0x0F, 0xA8, 0xC8
+  },
+  {
+    0x2F, 0xB9, 0xEB, 0x20, 0x85, 0x83, 0x01, 0x81,
+    0x90, 0x3A, 0x9D, 0xAF, 0xE3, 0xDB, 0x42, 0x8E,
+    0xE1, 0x5B, 0xE7, 0x66, 0x22, 0x24, 0xEF, 0xD6,
+    0x43, 0x37, 0x1F, 0xB2, 0x56, 0x46, 0xAE, 0xE7,
+    0x16, 0xE5, 0x31, 0xEC, 0xA6, 0x9B, 0x2B, 0xDC,
+    0x82, 0x33, 0xF1, 0xA8, 0x08, 0x1F, 0xA4, 0x3D,
+    0xA1, 0x50, 0x03, 0x02, 0x97, 0x5A, 0x77, 0xF4,
+    0x2F, 0xA5, 0x92, 0x13, 0x67, 0x10, 0xE9, 0xDC
+  },
+  {
+    0x66, 0xF9, 0xA7, 0x14, 0x3F, 0x7A, 0x33, 0x14,
+    0xA6, 0x69, 0xBF, 0x2E, 0x24, 0xBB, 0xB3, 0x50,
+    0x14, 0x26, 0x1D, 0x63, 0x9F, 0x49, 0x5B, 0x6C,
+    0x9C, 0x1F, 0x10, 0x4F, 0xE8, 0xE3, 0x20, 0xAC,
+    0xA6, 0x0D, 0x45, 0x50, 0xD6, 0x9D, 0x52, 0xED,
+    0xBD, 0x5A, 0x3C, 0xDE, 0xB4, 0x01, 0x4A, 0xE6,
+    0x5B, 0x1D, 0x87, 0xAA, 0x77, 0x0B, 0x69, 0xAE,
+    0x5C, 0x15, 0xF4, 0x33, 0x0B, 0x0B, 0x0A, 0xD8
+  },
+  {
+    0xF4, 0xC4, 0xDD, 0x1D, 0x59, 0x4C, 0x35, 0x65,
+    0xE3, 0xE2, 0x5C, 0xA4, 0x3D, 0xAD, 0x82, 0xF6,
+    0x2A, 0xBE, 0xA4, 0x83, 0x5E, 0xD4, 0xCD, 0x81,
+    0x1B, 0xCD, 0x97, 0x5E, 0x46, 0x27, 0x98, 0x28,
+    0xD4, 0x4D, 0x4C, 0x62, 0xC3, 0x67, 0x9F, 0x1B,
+    0x7F, 0x7B, 0x9D, 0xD4, 0x57, 0x1D, 0x7B, 0x49,
+    0x55, 0x73, 0x47, 0xB8, 0xC5, 0x46, 0x0C, 0xBD,
+    0xC1, 0xBE, 0xF6, 0x90, 0xFB, 0x2A, 0x08, 0xC0
+  },
+  {
+    0x8F, 0x1D, 0xC9, 0x64, 0x9C, 0x3A, 0x84, 0x55,
+    0x1F, 0x8F, 0x6E, 0x91, 0xCA, 0xC6, 0x82, 0x42,
+    0xA4, 0x3B, 0x1F, 0x8F, 0x32, 0x8E, 0xE9, 0x22,
+    0x80, 0x25, 0x73, 0x87, 0xFA, 0x75, 0x59, 0xAA,
+    0x6D, 0xB1, 0x2E, 0x4A, 0xEA, 0xDC, 0x2D, 0x26,
+    0x09, 0x91, 0x78, 0x74, 0x9C, 0x68, 0x64, 0xB3,
+    0x57, 0xF3, 0xF8, 0x3B, 0x2F, 0xB3, 0xEF, 0xA8,
+    0xD2, 0xA8, 0xDB, 0x05, 0x6B, 0xED, 0x6B, 0xCC
+  },
+  {
+    0x31, 0x39, 0xC1, 0xA7, 0xF9, 0x7A, 0xFD, 0x16,
+    0x75, 0xD4, 0x60, 0xEB, 0xBC, 0x07, 0xF2, 0x72,
+    0x8A, 0xA1, 0x50, 0xDF, 0x84, 0x96, 0x24, 0x51,
+    0x1E, 0xE0, 0x4B, 0x74, 0x3B, 0xA0, 0xA8, 0x33,
+    0x09, 0x2F, 0x18, 0xC1, 0x2D, 0xC9, 0x1B, 0x4D,
+    0xD2, 0x43, 0xF3, 0x33, 0x40, 0x2F, 0x59, 0xFE,
+    0x28, 0xAB, 0xDB, 0xBB, 0xAE, 0x30, 0x1E, 0x7B,
+    0x65, 0x9C, 0x7A, 0x26, 0xD5, 0xC0, 0xF9, 0x79
+  },
+  {
+    0x06, 0xF9, 0x4A, 0x29, 0x96, 0x15, 0x8A, 0x81,
+    0x9F, 0xE3, 0x4C, 0x40, 0xDE, 0x3C, 0xF0, 0x37,
+    0x9F, 0xD9, 0xFB, 0x85, 0xB3, 0xE3, 0x63, 0xBA,
+    0x39, 0x26, 0xA0, 0xE7, 0xD9, 0x60, 0xE3, 0xF4,
+    0xC2, 0xE0, 0xC7, 0x0C, 0x7C, 0xE0, 0xCC, 0xB2,
+    0xA6, 0x4F, 0xC2, 0x98, 0x69, 0xF6, 0xE7, 0xAB,
+    0x12, 0xBD, 0x4D, 0x3F, 0x14, 0xFC, 0xE9, 0x43,
+    0x27, 0x90, 0x27, 0xE7, 0x85, 0xFB, 0x5C, 0x29
+  },
+  {
+    0xC2, 0x9C, 0x39, 0x9E, 0xF3, 0xEE, 0xE8, 0x96,
+    0x1E, 0x87, 0x56, 0x5C, 0x1C, 0xE2, 0x63, 0x92,
+    0x5F, 0xC3, 0xD0, 0xCE, 0x26, 0x7D, 0x13, 0xE4,
+    0x8D, 0xD9, 0xE7, 0x32, 0xEE, 0x67, 0xB0, 0xF6,
+    0x9F, 0xAD, 0x56, 0x40, 0x1B, 0x0F, 0x10, 0xFC,
+    0xAA, 0xC1, 0x19, 0x20, 0x10, 0x46, 0xCC, 0xA2,
+    0x8C, 0x5B, 0x14, 0xAB, 0xDE, 0xA3, 0x21, 0x2A,
+    0xE6, 0x55, 0x62, 0xF7, 0xF1, 0x38, 0xDB, 0x3D
+  },
+  {
+    0x4C, 0xEC, 0x4C, 0x9D, 0xF5, 0x2E, 0xEF, 0x05,
+    0xC3, 0xF6, 0xFA, 0xAA, 0x97, 0x91, 0xBC, 0x74,
+    0x45, 0x93, 0x71, 0x83, 0x22, 0x4E, 0xCC, 0x37,
+    0xA1, 0xE5, 0x8D, 0x01, 0x32, 0xD3, 0x56, 0x17,
+    0x53, 0x1D, 0x7E, 0x79, 0x5F, 0x52, 0xAF, 0x7B,
+    0x1E, 0xB9, 0xD1, 0x47, 0xDE, 0x12, 0x92, 0xD3,
+    0x45, 0xFE, 0x34, 0x18, 0x23, 0xF8, 0xE6, 0xBC,
+    0x1E, 0x5B, 0xAD, 0xCA, 0x5C, 0x65, 0x61, 0x08
+  },
+  {
+    0x89, 0x8B, 0xFB, 0xAE, 0x93, 0xB3, 0xE1, 0x8D,
+    0x00, 0x69, 0x7E, 0xAB, 0x7D, 0x97, 0x04, 0xFA,
+    0x36, 0xEC, 0x33, 0x9D, 0x07, 0x61, 0x31, 0xCE,
+    0xFD, 0xF3, 0x0E, 0xDB, 0xE8, 0xD9, 0xCC, 0x81,
+    0xC3, 0xA8, 0x0B, 0x12, 0x96, 0x59, 0xB1, 0x63,
+    0xA3, 0x23, 0xBA, 0xB9, 0x79, 0x3D, 0x4F, 0xEE,
+    0xD9, 0x2D, 0x54, 0xDA, 0xE9, 0x66, 0xC7, 0x75,
+    0x29, 0x76, 0x4A, 0x09, 0xBE, 0x88, 0xDB, 0x45
+  },
+  {
+    0xEE, 0x9B, 0xD0, 0x46, 0x9D, 0x3A, 0xAF, 0x4F,
+    0x14, 0x03, 0x5B, 0xE4, 0x8A, 0x2C, 0x3B, 0x84,
+    0xD9, 0xB4, 0xB1, 0xFF, 0xF1, 0xD9, 0x45, 0xE1,
+    0xF1, 0xC1, 0xD3, 0x89, 0x80, 0xA9, 0x51, 0xBE,
+    0x19, 0x7B, 0x25, 0xFE, 0x22, 0xC7, 0x31, 0xF2,
+    0x0A, 0xEA, 0xCC, 0x93, 0x0B, 0xA9, 0xC4, 0xA1,
+    0xF4, 0x76, 0x22, 0x27, 0x61, 0x7A, 0xD3, 0x50,
+    0xFD, 0xAB, 0xB4, 0xE8, 0x02, 0x73, 0xA0, 0xF4
+  },
+  {
+    0x3D, 0x4D, 0x31, 0x13, 0x30, 0x05, 0x81, 0xCD,
+    0x96, 0xAC, 0xBF, 0x09, 0x1C, 0x3D, 0x0F, 0x3C,
+    0x31, 0x01, 0x38, 0xCD, 0x69, 0x79, 0xE6, 0x02,
+    0x6C, 0xDE, 0x62, 0x3E, 0x2D, 0xD1, 0xB2, 0x4D,
+    0x4A, 0x86, 0x38, 0xBE, 0xD1, 0x07, 0x33, 0x44,
+    0x78, 0x3A, 0xD0, 0x64, 0x9C, 0xC6, 0x30, 0x5C,
+    0xCE, 0xC0, 0x4B, 0xEB, 0x49, 0xF3, 0x1C, 0x63,
+    0x30, 0x88, 0xA9, 0x9B, 0x65, 0x13, 0x02, 0x67
+  },
+  {
+    0x95, 0xC0, 0x59, 0x1A, 0xD9, 0x1F, 0x92, 0x1A,
+    0xC7, 0xBE, 0x6D, 0x9C, 0xE3, 0x7E, 0x06, 0x63,
+    0xED, 0x80, 0x11, 0xC1, 0xCF, 0xD6, 0xD0, 0x16,
+    0x2A, 0x55, 0x72, 0xE9, 0x43, 0x68, 0xBA, 0xC0,
+    0x20, 0x24, 0x48, 0x5E, 0x6A, 0x39, 0x85, 0x4A,
+    0xA4, 0x6F, 0xE3, 0x8E, 0x97, 0xD6, 0xC6, 0xB1,
+    0x94, 0x7C, 0xD2, 0x72, 0xD8, 0x6B, 0x06, 0xBB,
+    0x5B, 0x2F, 0x78, 0xB9, 0xB6, 0x8D, 0x55, 0x9D
+  },
+  {
+    0x22, 0x7B, 0x79, 0xDE, 0xD3, 0x68, 0x15, 0x3B,
+    0xF4, 0x6C, 0x0A, 0x3C, 0xA9, 0x78, 0xBF, 0xDB,
+    0xEF, 0x31, 0xF3, 0x02, 0x4A, 0x56, 0x65, 0x84,
+    0x24, 0x68, 0x49, 0x0B, 0x0F, 0xF7, 0x48, 0xAE,
+    0x04, 0xE7, 0x83, 0x2E, 0xD4, 0xC9, 0xF4, 0x9D,
+    0xE9, 0xB1, 0x70, 0x67, 0x09, 0xD6, 0x23, 0xE5,
+    0xC8, 0xC1, 0x5E, 0x3C, 0xAE, 0xCA, 0xE8, 0xD5,
+    0xE4, 0x33, 0x43, 0x0F, 0xF7, 0x2F, 0x20, 0xEB
+  },
+  {
+    0x5D, 0x34, 0xF3, 0x95, 0x2F, 0x01, 0x05, 0xEE,
+    0xF8, 0x8A, 0xE8, 0xB6, 0x4C, 0x6C, 0xE9, 0x5E,
+    0xBF, 0xAD, 0xE0, 0xE0, 0x2C, 0x69, 0xB0, 0x87,
+    0x62, 0xA8, 0x71, 0x2D, 0x2E, 0x49, 0x11, 0xAD,
+    0x3F, 0x94, 0x1F, 0xC4, 0x03, 0x4D, 0xC9, 0xB2,
+    0xE4, 0x79, 0xFD, 0xBC, 0xD2, 0x79, 0xB9, 0x02,
+    0xFA, 0xF5, 0xD8, 0x38, 0xBB, 0x2E, 0x0C, 0x64,
+    0x95, 0xD3, 0x72, 0xB5, 0xB7, 0x02, 0x98, 0x13
+  },
+  {
+    0x7F, 0x93, 0x9B, 0xF8, 0x35, 0x3A, 0xBC, 0xE4,
+    0x9E, 0x77, 0xF1, 0x4F, 0x37, 0x50, 0xAF, 0x20,
+    0xB7, 0xB0, 0x39, 0x02, 0xE1, 0xA1, 0xE7, 0xFB,
+    0x6A, 0xAF, 0x76, 0xD0, 0x25, 0x9C, 0xD4, 0x01,
+    0xA8, 0x31, 0x90, 0xF1, 0x56, 0x40, 0xE7, 0x4F,
+    0x3E, 0x6C, 0x5A, 0x90, 0xE8, 0x39, 0xC7, 0x82,
+    0x1F, 0x64, 0x74, 0x75, 0x7F, 0x75, 0xC7, 0xBF,
+    0x90, 0x02, 0x08, 0x4D, 0xDC, 0x7A, 0x62, 0xDC
+  },
+  {
+    0x06, 0x2B, 0x61, 0xA2, 0xF9, 0xA3, 0x3A, 0x71,
+    0xD7, 0xD0, 0xA0, 0x61, 0x19, 0x64, 0x4C, 0x70,
+    0xB0, 0x71, 0x6A, 0x50, 0x4D, 0xE7, 0xE5, 0xE1,
+    0xBE, 0x49, 0xBD, 0x7B, 0x86, 0xE7, 0xED, 0x68,
+    0x17, 0x71, 0x4F, 0x9F, 0x0F, 0xC3, 0x13, 0xD0,
+    0x61, 0x29, 0x59, 0x7E, 0x9A, 0x22, 0x35, 0xEC,
+    0x85, 0x21, 0xDE, 0x36, 0xF7, 0x29, 0x0A, 0x90,
+    0xCC, 0xFC, 0x1F, 0xFA, 0x6D, 0x0A, 0xEE, 0x29
+  },
+  {
+    0xF2, 0x9E, 0x01, 0xEE, 0xAE, 0x64, 0x31, 0x1E,
+    0xB7, 0xF1, 0xC6, 0x42, 0x2F, 0x94, 0x6B, 0xF7,
+    0xBE, 0xA3, 0x63, 0x79, 0x52, 0x3E, 0x7B, 0x2B,
+    0xBA, 0xBA, 0x7D, 0x1D, 0x34, 0xA2, 0x2D, 0x5E,
+    0xA5, 0xF1, 0xC5, 0xA0, 0x9D, 0x5C, 0xE1, 0xFE,
+    0x68, 0x2C, 0xCE, 0xD9, 0xA4, 0x79, 0x8D, 0x1A,
+    0x05, 0xB4, 0x6C, 0xD7, 0x2D, 0xFF, 0x5C, 0x1B,
+    0x35, 0x54, 0x40, 0xB2, 0xA2, 0xD4, 0x76, 0xBC
+  },
+  {
+    0xEC, 0x38, 0xCD, 0x3B, 0xBA, 0xB3, 0xEF, 0x35,
+    0xD7, 0xCB, 0x6D, 0x5C, 0x91, 0x42, 0x98, 0x35,
+    0x1D, 0x8A, 0x9D, 0xC9, 0x7F, 0xCE, 0xE0, 0x51,
+    0xA8, 0xA0, 0x2F, 0x58, 0xE3, 0xED, 0x61, 0x84,
+    0xD0, 0xB7, 0x81, 0x0A, 0x56, 0x15, 0x41, 0x1A,
+    0xB1, 0xB9, 0x52, 0x09, 0xC3, 0xC8, 0x10, 0x11,
+    0x4F, 0xDE, 0xB2, 0x24, 0x52, 0x08, 0x4E, 0x77,
+    0xF3, 0xF8, 0x47, 0xC6, 0xDB, 0xAA, 0xFE, 0x16
+  },
+  {
+    0xC2, 0xAE, 0xF5, 0xE0, 0xCA, 0x43, 0xE8, 0x26,
+    0x41, 0x56, 0x5B, 0x8C, 0xB9, 0x43, 0xAA, 0x8B,
+    0xA5, 0x35, 0x50, 0xCA, 0xEF, 0x79, 0x3B, 0x65,
+    0x32, 0xFA, 0xFA, 0xD9, 0x4B, 0x81, 0x60, 0x82,
+    0xF0, 0x11, 0x3A, 0x3E, 0xA2, 0xF6, 0x36, 0x08,
+    0xAB, 0x40, 0x43, 0x7E, 0xCC, 0x0F, 0x02, 0x29,
+    0xCB, 0x8F, 0xA2, 0x24, 0xDC, 0xF1, 0xC4, 0x78,
+    0xA6, 0x7D, 0x9B, 0x64, 0x16, 0x2B, 0x92, 0xD1
+  },
+  {
+    0x15, 0xF5, 0x34, 0xEF, 0xFF, 0x71, 0x05, 0xCD,
+    0x1C, 0x25, 0x4D, 0x07, 0x4E, 0x27, 0xD5, 0x89,
+    0x8B, 0x89, 0x31, 0x3B, 0x7D, 0x36, 0x6D, 0xC2,
+    0xD7, 0xD8, 0x71, 0x13, 0xFA, 0x7D, 0x53, 0xAA,
+    0xE1, 0x3F, 0x6D, 0xBA, 0x48, 0x7A, 0xD8, 0x10,
+    0x3D, 0x5E, 0x85, 0x4C, 0x91, 0xFD, 0xB6, 0xE1,
+    0xE7, 0x4B, 0x2E, 0xF6, 0xD1, 0x43, 0x17, 0x69,
+    0xC3, 0x07, 0x67, 0xDD, 0xE0, 0x67, 0xA3, 0x5C
+  },
+  {
+    0x89, 0xAC, 0xBC, 0xA0, 0xB1, 0x69, 0x89, 0x7A,
+    0x0A, 0x27, 0x14, 0xC2, 0xDF, 0x8C, 0x95, 0xB5,
+    0xB7, 0x9C, 0xB6, 0x93, 0x90, 0x14, 0x2B, 0x7D,
+    0x60, 0x18, 0xBB, 0x3E, 0x30, 0x76, 0xB0, 0x99,
+    0xB7, 0x9A, 0x96, 0x41, 0x52, 0xA9, 0xD9, 0x12,
+    0xB1, 0xB8, 0x64, 0x12, 0xB7, 0xE3, 0x72, 0xE9,
+    0xCE, 0xCA, 0xD7, 0xF2, 0x5D, 0x4C, 0xBA, 0xB8,
+    0xA3, 0x17, 0xBE, 0x36, 0x49, 0x2A, 0x67, 0xD7
+  },
+  {
+    0xE3, 0xC0, 0x73, 0x91, 0x90, 0xED, 0x84, 0x9C,
+    0x9C, 0x96, 0x2F, 0xD9, 0xDB, 0xB5, 0x5E, 0x20,
+    0x7E, 0x62, 0x4F, 0xCA, 0xC1, 0xEB, 0x41, 0x76,
+    0x91, 0x51, 0x54, 0x99, 0xEE, 0xA8, 0xD8, 0x26,
+    0x7B, 0x7E, 0x8F, 0x12, 0x87, 0xA6, 0x36, 0x33,
+    0xAF, 0x50, 0x11, 0xFD, 0xE8, 0xC4, 0xDD, 0xF5,
+    0x5B, 0xFD, 0xF7, 0x22, 0xED, 0xF8, 0x88, 0x31,
+    0x41, 0x4F, 0x2C, 0xFA, 0xED, 0x59, 0xCB, 0x9A
+  },
+  {
+    0x8D, 0x6C, 0xF8, 0x7C, 0x08, 0x38, 0x0D, 0x2D,
+    0x15, 0x06, 0xEE, 0xE4, 0x6F, 0xD4, 0x22, 0x2D,
+    0x21, 0xD8, 0xC0, 0x4E, 0x58, 0x5F, 0xBF, 0xD0,
+    0x82, 0x69, 0xC9, 0x8F, 0x70, 0x28, 0x33, 0xA1,
+    0x56, 0x32, 0x6A, 0x07, 0x24, 0x65, 0x64, 0x00,
+    0xEE, 0x09, 0x35, 0x1D, 0x57, 0xB4, 0x40, 0x17,
+    0x5E, 0x2A, 0x5D, 0xE9, 0x3C, 0xC5, 0xF8, 0x0D,
+    0xB6, 0xDA, 0xF8, 0x35, 0x76, 0xCF, 0x75, 0xFA
+  },
+  {
+    0xDA, 0x24, 0xBE, 0xDE, 0x38, 0x36, 0x66, 0xD5,
+    0x63, 0xEE, 0xED, 0x37, 0xF6, 0x31, 0x9B, 0xAF,
+    0x20, 0xD5, 0xC7, 0x5D, 0x16, 0x35, 0xA6, 0xBA,
+    0x5E, 0xF4, 0xCF, 0xA1, 0xAC, 0x95, 0x48, 0x7E,
+    0x96, 0xF8, 0xC0, 0x8A, 0xF6, 0x00, 0xAA, 0xB8,
+    0x7C, 0x98, 0x6E, 0xBA, 0xD4, 0x9F, 0xC7, 0x0A,
+    0x58, 0xB4, 0x89, 0x0B, 0x9C, 0x87, 0x6E, 0x09,
+    0x10, 0x16, 0xDA, 0xF4, 0x9E, 0x1D, 0x32, 0x2E
+  },
+  {
+    0xF9, 0xD1, 0xD1, 0xB1, 0xE8, 0x7E, 0xA7, 0xAE,
+    0x75, 0x3A, 0x02, 0x97, 0x50, 0xCC, 0x1C, 0xF3,
+    0xD0, 0x15, 0x7D, 0x41, 0x80, 0x5E, 0x24, 0x5C,
+    0x56, 0x17, 0xBB, 0x93, 0x4E, 0x73, 0x2F, 0x0A,
+    0xE3, 0x18, 0x0B, 0x78, 0xE0, 0x5B, 0xFE, 0x76,
+    0xC7, 0xC3, 0x05, 0x1E, 0x3E, 0x3A, 0xC7, 0x8B,
+    0x9B, 0x50, 0xC0, 0x51, 0x42, 0x65, 0x7E, 0x1E,
+    0x03, 0x21, 0x5D, 0x6E, 0xC7, 0xBF, 0xD0, 0xFC
+  },
+  {
+    0x11, 0xB7, 0xBC, 0x16, 0x68, 0x03, 0x20, 0x48,
+    0xAA, 0x43, 0x34, 0x3D, 0xE4, 0x76, 0x39, 0x5E,
+    0x81, 0x4B, 0xBB, 0xC2, 0x23, 0x67, 0x8D, 0xB9,
+    0x51, 0xA1, 0xB0, 0x3A, 0x02, 0x1E, 0xFA, 0xC9,
+    0x48, 0xCF, 0xBE, 0x21, 0x5F, 0x97, 0xFE, 0x9A,
+    0x72, 0xA2, 0xF6, 0xBC, 0x03, 0x9E, 0x39, 0x56,
+    0xBF, 0xA4, 0x17, 0xC1, 0xA9, 0xF1, 0x0D, 0x6D,
+    0x7B, 0xA5, 0xD3, 0xD3, 0x2F, 0xF3, 0x23, 0xE5
+  },
+  {
+    0xB8, 0xD9, 0x00, 0x0E, 0x4F, 0xC2, 0xB0, 0x66,
+    0xED, 0xB9, 0x1A, 0xFE, 0xE8, 0xE7, 0xEB, 0x0F,
+    0x24, 0xE3, 0xA2, 0x01, 0xDB, 0x8B, 0x67, 0x93,
+    0xC0, 0x60, 0x85, 0x81, 0xE6, 0x28, 0xED, 0x0B,
+    0xCC, 0x4E, 0x5A, 0xA6, 0x78, 0x79, 0x92, 0xA4,
+    0xBC, 0xC4, 0x4E, 0x28, 0x80, 0x93, 0xE6, 0x3E,
+    0xE8, 0x3A, 0xBD, 0x0B, 0xC3, 0xEC, 0x6D, 0x09,
+    0x34, 0xA6, 0x74, 0xA4, 0xDA, 0x13, 0x83, 0x8A
+  },
+  {
+    0xCE, 0x32, 0x5E, 0x29, 0x4F, 0x9B, 0x67, 0x19,
+    0xD6, 0xB6, 0x12, 0x78, 0x27, 0x6A, 0xE0, 0x6A,
+    0x25, 0x64, 0xC0, 0x3B, 0xB0, 0xB7, 0x83, 0xFA,
+    0xFE, 0x78, 0x5B, 0xDF, 0x89, 0xC7, 0xD5, 0xAC,
+    0xD8, 0x3E, 0x78, 0x75, 0x6D, 0x30, 0x1B, 0x44,
+    0x56, 0x99, 0x02, 0x4E, 0xAE, 0xB7, 0x7B, 0x54,
+    0xD4, 0x77, 0x33, 0x6E, 0xC2, 0xA4, 0xF3, 0x32,
+    0xF2, 0xB3, 0xF8, 0x87, 0x65, 0xDD, 0xB0, 0xC3
+  },
+  {
+    0x29, 0xAC, 0xC3, 0x0E, 0x96, 0x03, 0xAE, 0x2F,
+    0xCC, 0xF9, 0x0B, 0xF9, 0x7E, 0x6C, 0xC4, 0x63,
+    0xEB, 0xE2, 0x8C, 0x1B, 0x2F, 0x9B, 0x4B, 0x76,
+    0x5E, 0x70, 0x53, 0x7C, 0x25, 0xC7, 0x02, 0xA2,
+    0x9D, 0xCB, 0xFB, 0xF1, 0x4C, 0x99, 0xC5, 0x43,
+    0x45, 0xBA, 0x2B, 0x51, 0xF1, 0x7B, 0x77, 0xB5,
+    0xF1, 0x5D, 0xB9, 0x2B, 0xBA, 0xD8, 0xFA, 0x95,
+    0xC4, 0x71, 0xF5, 0xD0, 0x70, 0xA1, 0x37, 0xCC
+  },
+  {
+    0x33, 0x79, 0xCB, 0xAA, 0xE5, 0x62, 0xA8, 0x7B,
+    0x4C, 0x04, 0x25, 0x55, 0x0F, 0xFD, 0xD6, 0xBF,
+    0xE1, 0x20, 0x3F, 0x0D, 0x66, 0x6C, 0xC7, 0xEA,
+    0x09, 0x5B, 0xE4, 0x07, 0xA5, 0xDF, 0xE6, 0x1E,
+    0xE9, 0x14, 0x41, 0xCD, 0x51, 0x54, 0xB3, 0xE5,
+    0x3B, 0x4F, 0x5F, 0xB3, 0x1A, 0xD4, 0xC7, 0xA9,
+    0xAD, 0x5C, 0x7A, 0xF4, 0xAE, 0x67, 0x9A, 0xA5,
+    0x1A, 0x54, 0x00, 0x3A, 0x54, 0xCA, 0x6B, 0x2D
+  },
+  {
+    0x30, 0x95, 0xA3, 0x49, 0xD2, 0x45, 0x70, 0x8C,
+    0x7C, 0xF5, 0x50, 0x11, 0x87, 0x03, 0xD7, 0x30,
+    0x2C, 0x27, 0xB6, 0x0A, 0xF5, 0xD4, 0xE6, 0x7F,
+    0xC9, 0x78, 0xF8, 0xA4, 0xE6, 0x09, 0x53, 0xC7,
+    0xA0, 0x4F, 0x92, 0xFC, 0xF4, 0x1A, 0xEE, 0x64,
+    0x32, 0x1C, 0xCB, 0x70, 0x7A, 0x89, 0x58, 0x51,
+    0x55, 0x2B, 0x1E, 0x37, 0xB0, 0x0B, 0xC5, 0xE6,
+    0xB7, 0x2F, 0xA5, 0xBC, 0xEF, 0x9E, 0x3F, 0xFF
+  },
+  {
+    0x07, 0x26, 0x2D, 0x73, 0x8B, 0x09, 0x32, 0x1F,
+    0x4D, 0xBC, 0xCE, 0xC4, 0xBB, 0x26, 0xF4, 0x8C,
+    0xB0, 0xF0, 0xED, 0x24, 0x6C, 0xE0, 0xB3, 0x1B,
+    0x9A, 0x6E, 0x7B, 0xC6, 0x83, 0x04, 0x9F, 0x1F,
+    0x3E, 0x55, 0x45, 0xF2, 0x8C, 0xE9, 0x32, 0xDD,
+    0x98, 0x5C, 0x5A, 0xB0, 0xF4, 0x3B, 0xD6, 0xDE,
+    0x07, 0x70, 0x56, 0x0A, 0xF3, 0x29, 0x06, 0x5E,
+    0xD2, 0xE4, 0x9D, 0x34, 0x62, 0x4C, 0x2C, 0xBB
+  },
+  {
+    0xB6, 0x40, 0x5E, 0xCA, 0x8E, 0xE3, 0x31, 0x6C,
+    0x87, 0x06, 0x1C, 0xC6, 0xEC, 0x18, 0xDB, 0xA5,
+    0x3E, 0x6C, 0x25, 0x0C, 0x63, 0xBA, 0x1F, 0x3B,
+    0xAE, 0x9E, 0x55, 0xDD, 0x34, 0x98, 0x03, 0x6A,
+    0xF0, 0x8C, 0xD2, 0x72, 0xAA, 0x24, 0xD7, 0x13,
+    0xC6, 0x02, 0x0D, 0x77, 0xAB, 0x2F, 0x39, 0x19,
+    0xAF, 0x1A, 0x32, 0xF3, 0x07, 0x42, 0x06, 0x18,
+    0xAB, 0x97, 0xE7, 0x39, 0x53, 0x99, 0x4F, 0xB4
+  },
+  {
+    0x7E, 0xE6, 0x82, 0xF6, 0x31, 0x48, 0xEE, 0x45,
+    0xF6, 0xE5, 0x31, 0x5D, 0xA8, 0x1E, 0x5C, 0x6E,
+    0x55, 0x7C, 0x2C, 0x34, 0x64, 0x1F, 0xC5, 0x09,
+    0xC7, 0xA5, 0x70, 0x10, 0x88, 0xC3, 0x8A, 0x74,
+    0x75, 0x61, 0x68, 0xE2, 0xCD, 0x8D, 0x35, 0x1E,
+    0x88, 0xFD, 0x1A, 0x45, 0x1F, 0x36, 0x0A, 0x01,
+    0xF5, 0xB2, 0x58, 0x0F, 0x9B, 0x5A, 0x2E, 0x8C,
+    0xFC, 0x13, 0x8F, 0x3D, 0xD5, 0x9A, 0x3F, 0xFC
+  },
+  {
+    0x1D, 0x26, 0x3C, 0x17, 0x9D, 0x6B, 0x26, 0x8F,
+    0x6F, 0xA0, 0x16, 0xF3, 0xA4, 0xF2, 0x9E, 0x94,
+    0x38, 0x91, 0x12, 0x5E, 0xD8, 0x59, 0x3C, 0x81,
+    0x25, 0x60, 0x59, 0xF5, 0xA7, 0xB4, 0x4A, 0xF2,
+    0xDC, 0xB2, 0x03, 0x0D, 0x17, 0x5C, 0x00, 0xE6,
+    0x2E, 0xCA, 0xF7, 0xEE, 0x96, 0x68, 0x2A, 0xA0,
+    0x7A, 0xB2, 0x0A, 0x61, 0x10, 0x24, 0xA2, 0x85,
+    0x32, 0xB1, 0xC2, 0x5B, 0x86, 0x65, 0x79, 0x02
+  },
+  {
+    0x10, 0x6D, 0x13, 0x2C, 0xBD, 0xB4, 0xCD, 0x25,
+    0x97, 0x81, 0x28, 0x46, 0xE2, 0xBC, 0x1B, 0xF7,
+    0x32, 0xFE, 0xC5, 0xF0, 0xA5, 0xF6, 0x5D, 0xBB,
+    0x39, 0xEC, 0x4E, 0x6D, 0xC6, 0x4A, 0xB2, 0xCE,
+    0x6D, 0x24, 0x63, 0x0D, 0x0F, 0x15, 0xA8, 0x05,
+    0xC3, 0x54, 0x00, 0x25, 0xD8, 0x4A, 0xFA, 0x98,
+    0xE3, 0x67, 0x03, 0xC3, 0xDB, 0xEE, 0x71, 0x3E,
+    0x72, 0xDD, 0xE8, 0x46, 0x5B, 0xC1, 0xBE, 0x7E
+  },
+  {
+    0x0E, 0x79, 0x96, 0x82, 0x26, 0x65, 0x06, 0x67,
+    0xA8, 0xD8, 0x62, 0xEA, 0x8D, 0xA4, 0x89, 0x1A,
+    0xF5, 0x6A, 0x4E, 0x3A, 0x8B, 0x6D, 0x17, 0x50,
+    0xE3, 0x94, 0xF0, 0xDE, 0xA7, 0x6D, 0x64, 0x0D,
+    0x85, 0x07, 0x7B, 0xCE, 0xC2, 0xCC, 0x86, 0x88,
+    0x6E, 0x50, 0x67, 0x51, 0xB4, 0xF6, 0xA5, 0x83,
+    0x8F, 0x7F, 0x0B, 0x5F, 0xEF, 0x76, 0x5D, 0x9D,
+    0xC9, 0x0D, 0xCD, 0xCB, 0xAF, 0x07, 0x9F, 0x08
+  },
+  {
+    0x52, 0x11, 0x56, 0xA8, 0x2A, 0xB0, 0xC4, 0xE5,
+    0x66, 0xE5, 0x84, 0x4D, 0x5E, 0x31, 0xAD, 0x9A,
+    0xAF, 0x14, 0x4B, 0xBD, 0x5A, 0x46, 0x4F, 0xDC,
+    0xA3, 0x4D, 0xBD, 0x57, 0x17, 0xE8, 0xFF, 0x71,
+    0x1D, 0x3F, 0xFE, 0xBB, 0xFA, 0x08, 0x5D, 0x67,
+    0xFE, 0x99, 0x6A, 0x34, 0xF6, 0xD3, 0xE4, 0xE6,
+    0x0B, 0x13, 0x96, 0xBF, 0x4B, 0x16, 0x10, 0xC2,
+    0x63, 0xBD, 0xBB, 0x83, 0x4D, 0x56, 0x08, 0x16
+  },
+  {
+    0x1A, 0xBA, 0x88, 0xBE, 0xFC, 0x55, 0xBC, 0x25,
+    0xEF, 0xBC, 0xE0, 0x2D, 0xB8, 0xB9, 0x93, 0x3E,
+    0x46, 0xF5, 0x76, 0x61, 0xBA, 0xEA, 0xBE, 0xB2,
+    0x1C, 0xC2, 0x57, 0x4D, 0x2A, 0x51, 0x8A, 0x3C,
+    0xBA, 0x5D, 0xC5, 0xA3, 0x8E, 0x49, 0x71, 0x34,
+    0x40, 0xB2, 0x5F, 0x9C, 0x74, 0x4E, 0x75, 0xF6,
+    0xB8, 0x5C, 0x9D, 0x8F, 0x46, 0x81, 0xF6, 0x76,
+    0x16, 0x0F, 0x61, 0x05, 0x35, 0x7B, 0x84, 0x06
+  },
+  {
+    0x5A, 0x99, 0x49, 0xFC, 0xB2, 0xC4, 0x73, 0xCD,
+    0xA9, 0x68, 0xAC, 0x1B, 0x5D, 0x08, 0x56, 0x6D,
+    0xC2, 0xD8, 0x16, 0xD9, 0x60, 0xF5, 0x7E, 0x63,
+    0xB8, 0x98, 0xFA, 0x70, 0x1C, 0xF8, 0xEB, 0xD3,
+    0xF5, 0x9B, 0x12, 0x4D, 0x95, 0xBF, 0xBB, 0xED,
+    0xC5, 0xF1, 0xCF, 0x0E, 0x17, 0xD5, 0xEA, 0xED,
+    0x0C, 0x02, 0xC5, 0x0B, 0x69, 0xD8, 0xA4, 0x02,
+    0xCA, 0xBC, 0xCA, 0x44, 0x33, 0xB5, 0x1F, 0xD4
+  },
+  {
+    0xB0, 0xCE, 0xAD, 0x09, 0x80, 0x7C, 0x67, 0x2A,
+    0xF2, 0xEB, 0x2B, 0x0F, 0x06, 0xDD, 0xE4, 0x6C,
+    0xF5, 0x37, 0x0E, 0x15, 0xA4, 0x09, 0x6B, 0x1A,
+    0x7D, 0x7C, 0xBB, 0x36, 0xEC, 0x31, 0xC2, 0x05,
+    0xFB, 0xEF, 0xCA, 0x00, 0xB7, 0xA4, 0x16, 0x2F,
+    0xA8, 0x9F, 0xB4, 0xFB, 0x3E, 0xB7, 0x8D, 0x79,
+    0x77, 0x0C, 0x23, 0xF4, 0x4E, 0x72, 0x06, 0x66,
+    0x4C, 0xE3, 0xCD, 0x93, 0x1C, 0x29, 0x1E, 0x5D
+  },
+  {
+    0xBB, 0x66, 0x64, 0x93, 0x1E, 0xC9, 0x70, 0x44,
+    0xE4, 0x5B, 0x2A, 0xE4, 0x20, 0xAE, 0x1C, 0x55,
+    0x1A, 0x88, 0x74, 0xBC, 0x93, 0x7D, 0x08, 0xE9,
+    0x69, 0x39, 0x9C, 0x39, 0x64, 0xEB, 0xDB, 0xA8,
+    0x34, 0x6C, 0xDD, 0x5D, 0x09, 0xCA, 0xAF, 0xE4,
+    0xC2, 0x8B, 0xA7, 0xEC, 0x78, 0x81, 0x91, 0xCE,
+    0xCA, 0x65, 0xDD, 0xD6, 0xF9, 0x5F, 0x18, 0x58,
+    0x3E, 0x04, 0x0D, 0x0F, 0x30, 0xD0, 0x36, 0x4D
+  },
+  {
+    0x65, 0xBC, 0x77, 0x0A, 0x5F, 0xAA, 0x37, 0x92,
+    0x36, 0x98, 0x03, 0x68, 0x3E, 0x84, 0x4B, 0x0B,
+    0xE7, 0xEE, 0x96, 0xF2, 0x9F, 0x6D, 0x6A, 0x35,
+    0x56, 0x80, 0x06, 0xBD, 0x55, 0x90, 0xF9, 0xA4,
+    0xEF, 0x63, 0x9B, 0x7A, 0x80, 0x61, 0xC7, 0xB0,
+    0x42, 0x4B, 0x66, 0xB6, 0x0A, 0xC3, 0x4A, 0xF3,
+    0x11, 0x99, 0x05, 0xF3, 0x3A, 0x9D, 0x8C, 0x3A,
+    0xE1, 0x83, 0x82, 0xCA, 0x9B, 0x68, 0x99, 0x00
+  },
+  {
+    0xEA, 0x9B, 0x4D, 0xCA, 0x33, 0x33, 0x36, 0xAA,
+    0xF8, 0x39, 0xA4, 0x5C, 0x6E, 0xAA, 0x48, 0xB8,
+    0xCB, 0x4C, 0x7D, 0xDA, 0xBF, 0xFE, 0xA4, 0xF6,
+    0x43, 0xD6, 0x35, 0x7E, 0xA6, 0x62, 0x8A, 0x48,
+    0x0A, 0x5B, 0x45, 0xF2, 0xB0, 0x52, 0xC1, 0xB0,
+    0x7D, 0x1F, 0xED, 0xCA, 0x91, 0x8B, 0x6F, 0x11,
+    0x39, 0xD8, 0x0F, 0x74, 0xC2, 0x45, 0x10, 0xDC,
+    0xBA, 0xA4, 0xBE, 0x70, 0xEA, 0xCC, 0x1B, 0x06
+  },
+  {
+    0xE6, 0x34, 0x2F, 0xB4, 0xA7, 0x80, 0xAD, 0x97,
+    0x5D, 0x0E, 0x24, 0xBC, 0xE1, 0x49, 0x98, 0x9B,
+    0x91, 0xD3, 0x60, 0x55, 0x7E, 0x87, 0x99, 0x4F,
+    0x6B, 0x45, 0x7B, 0x89, 0x55, 0x75, 0xCC, 0x02,
+    0xD0, 0xC1, 0x5B, 0xAD, 0x3C, 0xE7, 0x57, 0x7F,
+    0x4C, 0x63, 0x92, 0x7F, 0xF1, 0x3F, 0x3E, 0x38,
+    0x1F, 0xF7, 0xE7, 0x2B, 0xDB, 0xE7, 0x45, 0x32,
+    0x48, 0x44, 0xA9, 0xD2, 0x7E, 0x3F, 0x1C, 0x01
+  },
+  {
+    0x3E, 0x20, 0x9C, 0x9B, 0x33, 0xE8, 0xE4, 0x61,
+    0x17, 0x8A, 0xB4, 0x6B, 0x1C, 0x64, 0xB4, 0x9A,
+    0x07, 0xFB, 0x74, 0x5F, 0x1C, 0x8B, 0xC9, 0x5F,
+    0xBF, 0xB9, 0x4C, 0x6B, 0x87, 0xC6, 0x95, 0x16,
+    0x65, 0x1B, 0x26, 0x4E, 0xF9, 0x80, 0x93, 0x7F,
+    0xAD, 0x41, 0x23, 0x8B, 0x91, 0xDD, 0xC0, 0x11,
+    0xA5, 0xDD, 0x77, 0x7C, 0x7E, 0xFD, 0x44, 0x94,
+    0xB4, 0xB6, 0xEC, 0xD3, 0xA9, 0xC2, 0x2A, 0xC0
+  },
+  {
+    0xFD, 0x6A, 0x3D, 0x5B, 0x18, 0x75, 0xD8, 0x04,
+    0x86, 0xD6, 0xE6, 0x96, 0x94, 0xA5, 0x6D, 0xBB,
+    0x04, 0xA9, 0x9A, 0x4D, 0x05, 0x1F, 0x15, 0xDB,
+    0x26, 0x89, 0x77, 0x6B, 0xA1, 0xC4, 0x88, 0x2E,
+    0x6D, 0x46, 0x2A, 0x60, 0x3B, 0x70, 0x15, 0xDC,
+    0x9F, 0x4B, 0x74, 0x50, 0xF0, 0x53, 0x94, 0x30,
+    0x3B, 0x86, 0x52, 0xCF, 0xB4, 0x04, 0xA2, 0x66,
+    0x96, 0x2C, 0x41, 0xBA, 0xE6, 0xE1, 0x8A, 0x94
+  },
+  {
+    0x95, 0x1E, 0x27, 0x51, 0x7E, 0x6B, 0xAD, 0x9E,
+    0x41, 0x95, 0xFC, 0x86, 0x71, 0xDE, 0xE3, 0xE7,
+    0xE9, 0xBE, 0x69, 0xCE, 0xE1, 0x42, 0x2C, 0xB9,
+    0xFE, 0xCF, 0xCE, 0x0D, 0xBA, 0x87, 0x5F, 0x7B,
+    0x31, 0x0B, 0x93, 0xEE, 0x3A, 0x3D, 0x55, 0x8F,
+    0x94, 0x1F, 0x63, 0x5F, 0x66, 0x8F, 0xF8, 0x32,
+    0xD2, 0xC1, 0xD0, 0x33, 0xC5, 0xE2, 0xF0, 0x99,
+    0x7E, 0x4C, 0x66, 0xF1, 0x47, 0x34, 0x4E, 0x02
+  },
+  {
+    0x8E, 0xBA, 0x2F, 0x87, 0x4F, 0x1A, 0xE8, 0x40,
+    0x41, 0x90, 0x3C, 0x7C, 0x42, 0x53, 0xC8, 0x22,
+    0x92, 0x53, 0x0F, 0xC8, 0x50, 0x95, 0x50, 0xBF,
+    0xDC, 0x34, 0xC9, 0x5C, 0x7E, 0x28, 0x89, 0xD5,
+    0x65, 0x0B, 0x0A, 0xD8, 0xCB, 0x98, 0x8E, 0x5C,
+    0x48, 0x94, 0xCB, 0x87, 0xFB, 0xFB, 0xB1, 0x96,
+    0x12, 0xEA, 0x93, 0xCC, 0xC4, 0xC5, 0xCA, 0xD1,
+    0x71, 0x58, 0xB9, 0x76, 0x34, 0x64, 0xB4, 0x92
+  },
+  {
+    0x16, 0xF7, 0x12, 0xEA, 0xA1, 0xB7, 0xC6, 0x35,
+    0x47, 0x19, 0xA8, 0xE7, 0xDB, 0xDF, 0xAF, 0x55,
+    0xE4, 0x06, 0x3A, 0x4D, 0x27, 0x7D, 0x94, 0x75,
+    0x50, 0x01, 0x9B, 0x38, 0xDF, 0xB5, 0x64, 0x83,
+    0x09, 0x11, 0x05, 0x7D, 0x50, 0x50, 0x61, 0x36,
+    0xE2, 0x39, 0x4C, 0x3B, 0x28, 0x94, 0x5C, 0xC9,
+    0x64, 0x96, 0x7D, 0x54, 0xE3, 0x00, 0x0C, 0x21,
+    0x81, 0x62, 0x6C, 0xFB, 0x9B, 0x73, 0xEF, 0xD2
+  },
+  {
+    0xC3, 0x96, 0x39, 0xE7, 0xD5, 0xC7, 0xFB, 0x8C,
+    0xDD, 0x0F, 0xD3, 0xE6, 0xA5, 0x20, 0x96, 0x03,
+    0x94, 0x37, 0x12, 0x2F, 0x21, 0xC7, 0x8F, 0x16,
+    0x79, 0xCE, 0xA9, 0xD7, 0x8A, 0x73, 0x4C, 0x56,
+    0xEC, 0xBE, 0xB2, 0x86, 0x54, 0xB4, 0xF1, 0x8E,
+    0x34, 0x2C, 0x33, 0x1F, 0x6F, 0x72, 0x29, 0xEC,
+    0x4B, 0x4B, 0xC2, 0x81, 0xB2, 0xD8, 0x0A, 0x6E,
+    0xB5, 0x00, 0x43, 0xF3, 0x17, 0x96, 0xC8, 0x8C
+  },
+  {
+    0x72, 0xD0, 0x81, 0xAF, 0x99, 0xF8, 0xA1, 0x73,
+    0xDC, 0xC9, 0xA0, 0xAC, 0x4E, 0xB3, 0x55, 0x74,
+    0x05, 0x63, 0x9A, 0x29, 0x08, 0x4B, 0x54, 0xA4,
+    0x01, 0x72, 0x91, 0x2A, 0x2F, 0x8A, 0x39, 0x51,
+    0x29, 0xD5, 0x53, 0x6F, 0x09, 0x18, 0xE9, 0x02,
+    0xF9, 0xE8, 0xFA, 0x60, 0x00, 0x99, 0x5F, 0x41,
+    0x68, 0xDD, 0xC5, 0xF8, 0x93, 0x01, 0x1B, 0xE6,
+    0xA0, 0xDB, 0xC9, 0xB8, 0xA1, 0xA3, 0xF5, 0xBB
+  },
+  {
+    0xC1, 0x1A, 0xA8, 0x1E, 0x5E, 0xFD, 0x24, 0xD5,
+    0xFC, 0x27, 0xEE, 0x58, 0x6C, 0xFD, 0x88, 0x47,
+    0xFB, 0xB0, 0xE2, 0x76, 0x01, 0xCC, 0xEC, 0xE5,
+    0xEC, 0xCA, 0x01, 0x98, 0xE3, 0xC7, 0x76, 0x53,
+    0x93, 0xBB, 0x74, 0x45, 0x7C, 0x7E, 0x7A, 0x27,
+    0xEB, 0x91, 0x70, 0x35, 0x0E, 0x1F, 0xB5, 0x38,
+    0x57, 0x17, 0x75, 0x06, 0xBE, 0x3E, 0x76, 0x2C,
+    0xC0, 0xF1, 0x4D, 0x8C, 0x3A, 0xFE, 0x90, 0x77
+  },
+  {
+    0xC2, 0x8F, 0x21, 0x50, 0xB4, 0x52, 0xE6, 0xC0,
+    0xC4, 0x24, 0xBC, 0xDE, 0x6F, 0x8D, 0x72, 0x00,
+    0x7F, 0x93, 0x10, 0xFE, 0xD7, 0xF2, 0xF8, 0x7D,
+    0xE0, 0xDB, 0xB6, 0x4F, 0x44, 0x79, 0xD6, 0xC1,
+    0x44, 0x1B, 0xA6, 0x6F, 0x44, 0xB2, 0xAC, 0xCE,
+    0xE6, 0x16, 0x09, 0x17, 0x7E, 0xD3, 0x40, 0x12,
+    0x8B, 0x40, 0x7E, 0xCE, 0xC7, 0xC6, 0x4B, 0xBE,
+    0x50, 0xD6, 0x3D, 0x22, 0xD8, 0x62, 0x77, 0x27
+  },
+  {
+    0xF6, 0x3D, 0x88, 0x12, 0x28, 0x77, 0xEC, 0x30,
+    0xB8, 0xC8, 0xB0, 0x0D, 0x22, 0xE8, 0x90, 0x00,
+    0xA9, 0x66, 0x42, 0x61, 0x12, 0xBD, 0x44, 0x16,
+    0x6E, 0x2F, 0x52, 0x5B, 0x76, 0x9C, 0xCB, 0xE9,
+    0xB2, 0x86, 0xD4, 0x37, 0xA0, 0x12, 0x91, 0x30,
+    0xDD, 0xE1, 0xA8, 0x6C, 0x43, 0xE0, 0x4B, 0xED,
+    0xB5, 0x94, 0xE6, 0x71, 0xD9, 0x82, 0x83, 0xAF,
+    0xE6, 0x4C, 0xE3, 0x31, 0xDE, 0x98, 0x28, 0xFD
+  },
+  {
+    0x34, 0x8B, 0x05, 0x32, 0x88, 0x0B, 0x88, 0xA6,
+    0x61, 0x4A, 0x8D, 0x74, 0x08, 0xC3, 0xF9, 0x13,
+    0x35, 0x7F, 0xBB, 0x60, 0xE9, 0x95, 0xC6, 0x02,
+    0x05, 0xBE, 0x91, 0x39, 0xE7, 0x49, 0x98, 0xAE,
+    0xDE, 0x7F, 0x45, 0x81, 0xE4, 0x2F, 0x6B, 0x52,
+    0x69, 0x8F, 0x7F, 0xA1, 0x21, 0x97, 0x08, 0xC1,
+    0x44, 0x98, 0x06, 0x7F, 0xD1, 0xE0, 0x95, 0x02,
+    0xDE, 0x83, 0xA7, 0x7D, 0xD2, 0x81, 0x15, 0x0C
+  },
+  {
+    0x51, 0x33, 0xDC, 0x8B, 0xEF, 0x72, 0x53, 0x59,
+    0xDF, 0xF5, 0x97, 0x92, 0xD8, 0x5E, 0xAF, 0x75,
+    0xB7, 0xE1, 0xDC, 0xD1, 0x97, 0x8B, 0x01, 0xC3,
+    0x5B, 0x1B, 0x85, 0xFC, 0xEB, 0xC6, 0x33, 0x88,
+    0xAD, 0x99, 0xA1, 0x7B, 0x63, 0x46, 0xA2, 0x17,
+    0xDC, 0x1A, 0x96, 0x22, 0xEB, 0xD1, 0x22, 0xEC,
+    0xF6, 0x91, 0x3C, 0x4D, 0x31, 0xA6, 0xB5, 0x2A,
+    0x69, 0x5B, 0x86, 0xAF, 0x00, 0xD7, 0x41, 0xA0
+  },
+  {
+    0x27, 0x53, 0xC4, 0xC0, 0xE9, 0x8E, 0xCA, 0xD8,
+    0x06, 0xE8, 0x87, 0x80, 0xEC, 0x27, 0xFC, 0xCD,
+    0x0F, 0x5C, 0x1A, 0xB5, 0x47, 0xF9, 0xE4, 0xBF,
+    0x16, 0x59, 0xD1, 0x92, 0xC2, 0x3A, 0xA2, 0xCC,
+    0x97, 0x1B, 0x58, 0xB6, 0x80, 0x25, 0x80, 0xBA,
+    0xEF, 0x8A, 0xDC, 0x3B, 0x77, 0x6E, 0xF7, 0x08,
+    0x6B, 0x25, 0x45, 0xC2, 0x98, 0x7F, 0x34, 0x8E,
+    0xE3, 0x71, 0x9C, 0xDE, 0xF2, 0x58, 0xC4, 0x03
+  },
+  {
+    0xB1, 0x66, 0x35, 0x73, 0xCE, 0x4B, 0x9D, 0x8C,
+    0xAE, 0xFC, 0x86, 0x50, 0x12, 0xF3, 0xE3, 0x97,
+    0x14, 0xB9, 0x89, 0x8A, 0x5D, 0xA6, 0xCE, 0x17,
+    0xC2, 0x5A, 0x6A, 0x47, 0x93, 0x1A, 0x9D, 0xDB,
+    0x9B, 0xBE, 0x98, 0xAD, 0xAA, 0x55, 0x3B, 0xEE,
+    0xD4, 0x36, 0xE8, 0x95, 0x78, 0x45, 0x54, 0x16,
+    0xC2, 0xA5, 0x2A, 0x52, 0x5C, 0xF2, 0x86, 0x2B,
+    0x8D, 0x1D, 0x49, 0xA2, 0x53, 0x1B, 0x73, 0x91
+  },
+  {
+    0x64, 0xF5, 0x8B, 0xD6, 0xBF, 0xC8, 0x56, 0xF5,
+    0xE8, 0x73, 0xB2, 0xA2, 0x95, 0x6E, 0xA0, 0xED,
+    0xA0, 0xD6, 0xDB, 0x0D, 0xA3, 0x9C, 0x8C, 0x7F,
+    0xC6, 0x7C, 0x9F, 0x9F, 0xEE, 0xFC, 0xFF, 0x30,
+    0x72, 0xCD, 0xF9, 0xE6, 0xEA, 0x37, 0xF6, 0x9A,
+    0x44, 0xF0, 0xC6, 0x1A, 0xA0, 0xDA, 0x36, 0x93,
+    0xC2, 0xDB, 0x5B, 0x54, 0x96, 0x0C, 0x02, 0x81,
+    0xA0, 0x88, 0x15, 0x1D, 0xB4, 0x2B, 0x11, 0xE8
+  },
+  {
+    0x07, 0x64, 0xC7, 0xBE, 0x28, 0x12, 0x5D, 0x90,
+    0x65, 0xC4, 0xB9, 0x8A, 0x69, 0xD6, 0x0A, 0xED,
+    0xE7, 0x03, 0x54, 0x7C, 0x66, 0xA1, 0x2E, 0x17,
+    0xE1, 0xC6, 0x18, 0x99, 0x41, 0x32, 0xF5, 0xEF,
+    0x82, 0x48, 0x2C, 0x1E, 0x3F, 0xE3, 0x14, 0x6C,
+    0xC6, 0x53, 0x76, 0xCC, 0x10, 0x9F, 0x01, 0x38,
+    0xED, 0x9A, 0x80, 0xE4, 0x9F, 0x1F, 0x3C, 0x7D,
+    0x61, 0x0D, 0x2F, 0x24, 0x32, 0xF2, 0x06, 0x05
+  },
+  {
+    0xF7, 0x48, 0x78, 0x43, 0x98, 0xA2, 0xFF, 0x03,
+    0xEB, 0xEB, 0x07, 0xE1, 0x55, 0xE6, 0x61, 0x16,
+    0xA8, 0x39, 0x74, 0x1A, 0x33, 0x6E, 0x32, 0xDA,
+    0x71, 0xEC, 0x69, 0x60, 0x01, 0xF0, 0xAD, 0x1B,
+    0x25, 0xCD, 0x48, 0xC6, 0x9C, 0xFC, 0xA7, 0x26,
+    0x5E, 0xCA, 0x1D, 0xD7, 0x19, 0x04, 0xA0, 0xCE,
+    0x74, 0x8A, 0xC4, 0x12, 0x4F, 0x35, 0x71, 0x07,
+    0x6D, 0xFA, 0x71, 0x16, 0xA9, 0xCF, 0x00, 0xE9
+  },
+  {
+    0x3F, 0x0D, 0xBC, 0x01, 0x86, 0xBC, 0xEB, 0x6B,
+    0x78, 0x5B, 0xA7, 0x8D, 0x2A, 0x2A, 0x01, 0x3C,
+    0x91, 0x0B, 0xE1, 0x57, 0xBD, 0xAF, 0xFA, 0xE8,
+    0x1B, 0xB6, 0x66, 0x3B, 0x1A, 0x73, 0x72, 0x2F,
+    0x7F, 0x12, 0x28, 0x79, 0x5F, 0x3E, 0xCA, 0xDA,
+    0x87, 0xCF, 0x6E, 0xF0, 0x07, 0x84, 0x74, 0xAF,
+    0x73, 0xF3, 0x1E, 0xCA, 0x0C, 0xC2, 0x00, 0xED,
+    0x97, 0x5B, 0x68, 0x93, 0xF7, 0x61, 0xCB, 0x6D
+  },
+  {
+    0xD4, 0x76, 0x2C, 0xD4, 0x59, 0x98, 0x76, 0xCA,
+    0x75, 0xB2, 0xB8, 0xFE, 0x24, 0x99, 0x44, 0xDB,
+    0xD2, 0x7A, 0xCE, 0x74, 0x1F, 0xDA, 0xB9, 0x36,
+    0x16, 0xCB, 0xC6, 0xE4, 0x25, 0x46, 0x0F, 0xEB,
+    0x51, 0xD4, 0xE7, 0xAD, 0xCC, 0x38, 0x18, 0x0E,
+    0x7F, 0xC4, 0x7C, 0x89, 0x02, 0x4A, 0x7F, 0x56,
+    0x19, 0x1A, 0xDB, 0x87, 0x8D, 0xFD, 0xE4, 0xEA,
+    0xD6, 0x22, 0x23, 0xF5, 0xA2, 0x61, 0x0E, 0xFE
+  },
+  {
+    0xCD, 0x36, 0xB3, 0xD5, 0xB4, 0xC9, 0x1B, 0x90,
+    0xFC, 0xBB, 0xA7, 0x95, 0x13, 0xCF, 0xEE, 0x19,
+    0x07, 0xD8, 0x64, 0x5A, 0x16, 0x2A, 0xFD, 0x0C,
+    0xD4, 0xCF, 0x41, 0x92, 0xD4, 0xA5, 0xF4, 0xC8,
+    0x92, 0x18, 0x3A, 0x8E, 0xAC, 0xDB, 0x2B, 0x6B,
+    0x6A, 0x9D, 0x9A, 0xA8, 0xC1, 0x1A, 0xC1, 0xB2,
+    0x61, 0xB3, 0x80, 0xDB, 0xEE, 0x24, 0xCA, 0x46,
+    0x8F, 0x1B, 0xFD, 0x04, 0x3C, 0x58, 0xEE, 0xFE
+  },
+  {
+    0x98, 0x59, 0x34, 0x52, 0x28, 0x16, 0x61, 0xA5,
+    0x3C, 0x48, 0xA9, 0xD8, 0xCD, 0x79, 0x08, 0x26,
+    0xC1, 0xA1, 0xCE, 0x56, 0x77, 0x38, 0x05, 0x3D,
+    0x0B, 0xEE, 0x4A, 0x91, 0xA3, 0xD5, 0xBD, 0x92,
+    0xEE, 0xFD, 0xBA, 0xBE, 0xBE, 0x32, 0x04, 0xF2,
+    0x03, 0x1C, 0xA5, 0xF7, 0x81, 0xBD, 0xA9, 0x9E,
+    0xF5, 0xD8, 0xAE, 0x56, 0xE5, 0xB0, 0x4A, 0x9E,
+    0x1E, 0xCD, 0x21, 0xB0, 0xEB, 0x05, 0xD3, 0xE1
+  },
+  {
+    0x77, 0x1F, 0x57, 0xDD, 0x27, 0x75, 0xCC, 0xDA,
+    0xB5, 0x59, 0x21, 0xD3, 0xE8, 0xE3, 0x0C, 0xCF,
+    0x48, 0x4D, 0x61, 0xFE, 0x1C, 0x1B, 0x9C, 0x2A,
+    0xE8, 0x19, 0xD0, 0xFB, 0x2A, 0x12, 0xFA, 0xB9,
+    0xBE, 0x70, 0xC4, 0xA7, 0xA1, 0x38, 0xDA, 0x84,
+    0xE8, 0x28, 0x04, 0x35, 0xDA, 0xAD, 0xE5, 0xBB,
+    0xE6, 0x6A, 0xF0, 0x83, 0x6A, 0x15, 0x4F, 0x81,
+    0x7F, 0xB1, 0x7F, 0x33, 0x97, 0xE7, 0x25, 0xA3
+  },
+  {
+    0xC6, 0x08, 0x97, 0xC6, 0xF8, 0x28, 0xE2, 0x1F,
+    0x16, 0xFB, 0xB5, 0xF1, 0x5B, 0x32, 0x3F, 0x87,
+    0xB6, 0xC8, 0x95, 0x5E, 0xAB, 0xF1, 0xD3, 0x80,
+    0x61, 0xF7, 0x07, 0xF6, 0x08, 0xAB, 0xDD, 0x99,
+    0x3F, 0xAC, 0x30, 0x70, 0x63, 0x3E, 0x28, 0x6C,
+    0xF8, 0x33, 0x9C, 0xE2, 0x95, 0xDD, 0x35, 0x2D,
+    0xF4, 0xB4, 0xB4, 0x0B, 0x2F, 0x29, 0xDA, 0x1D,
+    0xD5, 0x0B, 0x3A, 0x05, 0xD0, 0x79, 0xE6, 0xBB
+  },
+  {
+    0x82, 0x10, 0xCD, 0x2C, 0x2D, 0x3B, 0x13, 0x5C,
+    0x2C, 0xF0, 0x7F, 0xA0, 0xD1, 0x43, 0x3C, 0xD7,
+    0x71, 0xF3, 0x25, 0xD0, 0x75, 0xC6, 0x46, 0x9D,
+    0x9C, 0x7F, 0x1B, 0xA0, 0x94, 0x3C, 0xD4, 0xAB,
+    0x09, 0x80, 0x8C, 0xAB, 0xF4, 0xAC, 0xB9, 0xCE,
+    0x5B, 0xB8, 0x8B, 0x49, 0x89, 0x29, 0xB4, 0xB8,
+    0x47, 0xF6, 0x81, 0xAD, 0x2C, 0x49, 0x0D, 0x04,
+    0x2D, 0xB2, 0xAE, 0xC9, 0x42, 0x14, 0xB0, 0x6B
+  },
+  {
+    0x1D, 0x4E, 0xDF, 0xFF, 0xD8, 0xFD, 0x80, 0xF7,
+    0xE4, 0x10, 0x78, 0x40, 0xFA, 0x3A, 0xA3, 0x1E,
+    0x32, 0x59, 0x84, 0x91, 0xE4, 0xAF, 0x70, 0x13,
+    0xC1, 0x97, 0xA6, 0x5B, 0x7F, 0x36, 0xDD, 0x3A,
+    0xC4, 0xB4, 0x78, 0x45, 0x61, 0x11, 0xCD, 0x43,
+    0x09, 0xD9, 0x24, 0x35, 0x10, 0x78, 0x2F, 0xA3,
+    0x1B, 0x7C, 0x4C, 0x95, 0xFA, 0x95, 0x15, 0x20,
+    0xD0, 0x20, 0xEB, 0x7E, 0x5C, 0x36, 0xE4, 0xEF
+  },
+  {
+    0xAF, 0x8E, 0x6E, 0x91, 0xFA, 0xB4, 0x6C, 0xE4,
+    0x87, 0x3E, 0x1A, 0x50, 0xA8, 0xEF, 0x44, 0x8C,
+    0xC2, 0x91, 0x21, 0xF7, 0xF7, 0x4D, 0xEE, 0xF3,
+    0x4A, 0x71, 0xEF, 0x89, 0xCC, 0x00, 0xD9, 0x27,
+    0x4B, 0xC6, 0xC2, 0x45, 0x4B, 0xBB, 0x32, 0x30,
+    0xD8, 0xB2, 0xEC, 0x94, 0xC6, 0x2B, 0x1D, 0xEC,
+    0x85, 0xF3, 0x59, 0x3B, 0xFA, 0x30, 0xEA, 0x6F,
+    0x7A, 0x44, 0xD7, 0xC0, 0x94, 0x65, 0xA2, 0x53
+  },
+  {
+    0x29, 0xFD, 0x38, 0x4E, 0xD4, 0x90, 0x6F, 0x2D,
+    0x13, 0xAA, 0x9F, 0xE7, 0xAF, 0x90, 0x59, 0x90,
+    0x93, 0x8B, 0xED, 0x80, 0x7F, 0x18, 0x32, 0x45,
+    0x4A, 0x37, 0x2A, 0xB4, 0x12, 0xEE, 0xA1, 0xF5,
+    0x62, 0x5A, 0x1F, 0xCC, 0x9A, 0xC8, 0x34, 0x3B,
+    0x7C, 0x67, 0xC5, 0xAB, 0xA6, 0xE0, 0xB1, 0xCC,
+    0x46, 0x44, 0x65, 0x49, 0x13, 0x69, 0x2C, 0x6B,
+    0x39, 0xEB, 0x91, 0x87, 0xCE, 0xAC, 0xD3, 0xEC
+  },
+  {
+    0xA2, 0x68, 0xC7, 0x88, 0x5D, 0x98, 0x74, 0xA5,
+    0x1C, 0x44, 0xDF, 0xFE, 0xD8, 0xEA, 0x53, 0xE9,
+    0x4F, 0x78, 0x45, 0x6E, 0x0B, 0x2E, 0xD9, 0x9F,
+    0xF5, 0xA3, 0x92, 0x47, 0x60, 0x81, 0x38, 0x26,
+    0xD9, 0x60, 0xA1, 0x5E, 0xDB, 0xED, 0xBB, 0x5D,
+    0xE5, 0x22, 0x6B, 0xA4, 0xB0, 0x74, 0xE7, 0x1B,
+    0x05, 0xC5, 0x5B, 0x97, 0x56, 0xBB, 0x79, 0xE5,
+    0x5C, 0x02, 0x75, 0x4C, 0x2C, 0x7B, 0x6C, 0x8A
+  },
+  {
+    0x0C, 0xF8, 0x54, 0x54, 0x88, 0xD5, 0x6A, 0x86,
+    0x81, 0x7C, 0xD7, 0xEC, 0xB1, 0x0F, 0x71, 0x16,
+    0xB7, 0xEA, 0x53, 0x0A, 0x45, 0xB6, 0xEA, 0x49,
+    0x7B, 0x6C, 0x72, 0xC9, 0x97, 0xE0, 0x9E, 0x3D,
+    0x0D, 0xA8, 0x69, 0x8F, 0x46, 0xBB, 0x00, 0x6F,
+    0xC9, 0x77, 0xC2, 0xCD, 0x3D, 0x11, 0x77, 0x46,
+    0x3A, 0xC9, 0x05, 0x7F, 0xDD, 0x16, 0x62, 0xC8,
+    0x5D, 0x0C, 0x12, 0x64, 0x43, 0xC1, 0x04, 0x73
+  },
+  {
+    0xB3, 0x96, 0x14, 0x26, 0x8F, 0xDD, 0x87, 0x81,
+    0x51, 0x5E, 0x2C, 0xFE, 0xBF, 0x89, 0xB4, 0xD5,
+    0x40, 0x2B, 0xAB, 0x10, 0xC2, 0x26, 0xE6, 0x34,
+    0x4E, 0x6B, 0x9A, 0xE0, 0x00, 0xFB, 0x0D, 0x6C,
+    0x79, 0xCB, 0x2F, 0x3E, 0xC8, 0x0E, 0x80, 0xEA,
+    0xEB, 0x19, 0x80, 0xD2, 0xF8, 0x69, 0x89, 0x16,
+    0xBD, 0x2E, 0x9F, 0x74, 0x72, 0x36, 0x65, 0x51,
+    0x16, 0x64, 0x9C, 0xD3, 0xCA, 0x23, 0xA8, 0x37
+  },
+  {
+    0x74, 0xBE, 0xF0, 0x92, 0xFC, 0x6F, 0x1E, 0x5D,
+    0xBA, 0x36, 0x63, 0xA3, 0xFB, 0x00, 0x3B, 0x2A,
+    0x5B, 0xA2, 0x57, 0x49, 0x65, 0x36, 0xD9, 0x9F,
+    0x62, 0xB9, 0xD7, 0x3F, 0x8F, 0x9E, 0xB3, 0xCE,
+    0x9F, 0xF3, 0xEE, 0xC7, 0x09, 0xEB, 0x88, 0x36,
+    0x55, 0xEC, 0x9E, 0xB8, 0x96, 0xB9, 0x12, 0x8F,
+    0x2A, 0xFC, 0x89, 0xCF, 0x7D, 0x1A, 0xB5, 0x8A,
+    0x72, 0xF4, 0xA3, 0xBF, 0x03, 0x4D, 0x2B, 0x4A
+  },
+  {
+    0x3A, 0x98, 0x8D, 0x38, 0xD7, 0x56, 0x11, 0xF3,
+    0xEF, 0x38, 0xB8, 0x77, 0x49, 0x80, 0xB3, 0x3E,
+    0x57, 0x3B, 0x6C, 0x57, 0xBE, 0xE0, 0x46, 0x9B,
+    0xA5, 0xEE, 0xD9, 0xB4, 0x4F, 0x29, 0x94, 0x5E,
+    0x73, 0x47, 0x96, 0x7F, 0xBA, 0x2C, 0x16, 0x2E,
+    0x1C, 0x3B, 0xE7, 0xF3, 0x10, 0xF2, 0xF7, 0x5E,
+    0xE2, 0x38, 0x1E, 0x7B, 0xFD, 0x6B, 0x3F, 0x0B,
+    0xAE, 0xA8, 0xD9, 0x5D, 0xFB, 0x1D, 0xAF, 0xB1
+  },
+  {
+    0x58, 0xAE, 0xDF, 0xCE, 0x6F, 0x67, 0xDD, 0xC8,
+    0x5A, 0x28, 0xC9, 0x92, 0xF1, 0xC0, 0xBD, 0x09,
+    0x69, 0xF0, 0x41, 0xE6, 0x6F, 0x1E, 0xE8, 0x80,
+    0x20, 0xA1, 0x25, 0xCB, 0xFC, 0xFE, 0xBC, 0xD6,
+    0x17, 0x09, 0xC9, 0xC4, 0xEB, 0xA1, 0x92, 0xC1,
+    0x5E, 0x69, 0xF0, 0x20, 0xD4, 0x62, 0x48, 0x60,
+    0x19, 0xFA, 0x8D, 0xEA, 0x0C, 0xD7, 0xA4, 0x29,
+    0x21, 0xA1, 0x9D, 0x2F, 0xE5, 0x46, 0xD4, 0x3D
+  },
+  {
+    0x93, 0x47, 0xBD, 0x29, 0x14, 0x73, 0xE6, 0xB4,
+    0xE3, 0x68, 0x43, 0x7B, 0x8E, 0x56, 0x1E, 0x06,
+    0x5F, 0x64, 0x9A, 0x6D, 0x8A, 0xDA, 0x47, 0x9A,
+    0xD0, 0x9B, 0x19, 0x99, 0xA8, 0xF2, 0x6B, 0x91,
+    0xCF, 0x61, 0x20, 0xFD, 0x3B, 0xFE, 0x01, 0x4E,
+    0x83, 0xF2, 0x3A, 0xCF, 0xA4, 0xC0, 0xAD, 0x7B,
+    0x37, 0x12, 0xB2, 0xC3, 0xC0, 0x73, 0x32, 0x70,
+    0x66, 0x31, 0x12, 0xCC, 0xD9, 0x28, 0x5C, 0xD9
+  },
+  {
+    0xB3, 0x21, 0x63, 0xE7, 0xC5, 0xDB, 0xB5, 0xF5,
+    0x1F, 0xDC, 0x11, 0xD2, 0xEA, 0xC8, 0x75, 0xEF,
+    0xBB, 0xCB, 0x7E, 0x76, 0x99, 0x09, 0x0A, 0x7E,
+    0x7F, 0xF8, 0xA8, 0xD5, 0x07, 0x95, 0xAF, 0x5D,
+    0x74, 0xD9, 0xFF, 0x98, 0x54, 0x3E, 0xF8, 0xCD,
+    0xF8, 0x9A, 0xC1, 0x3D, 0x04, 0x85, 0x27, 0x87,
+    0x56, 0xE0, 0xEF, 0x00, 0xC8, 0x17, 0x74, 0x56,
+    0x61, 0xE1, 0xD5, 0x9F, 0xE3, 0x8E, 0x75, 0x37
+  },
+  {
+    0x10, 0x85, 0xD7, 0x83, 0x07, 0xB1, 0xC4, 0xB0,
+    0x08, 0xC5, 0x7A, 0x2E, 0x7E, 0x5B, 0x23, 0x46,
+    0x58, 0xA0, 0xA8, 0x2E, 0x4F, 0xF1, 0xE4, 0xAA,
+    0xAC, 0x72, 0xB3, 0x12, 0xFD, 0xA0, 0xFE, 0x27,
+    0xD2, 0x33, 0xBC, 0x5B, 0x10, 0xE9, 0xCC, 0x17,
+    0xFD, 0xC7, 0x69, 0x7B, 0x54, 0x0C, 0x7D, 0x95,
+    0xEB, 0x21, 0x5A, 0x19, 0xA1, 0xA0, 0xE2, 0x0E,
+    0x1A, 0xBF, 0xA1, 0x26, 0xEF, 0xD5, 0x68, 0xC7
+  },
+  {
+    0x4E, 0x5C, 0x73, 0x4C, 0x7D, 0xDE, 0x01, 0x1D,
+    0x83, 0xEA, 0xC2, 0xB7, 0x34, 0x7B, 0x37, 0x35,
+    0x94, 0xF9, 0x2D, 0x70, 0x91, 0xB9, 0xCA, 0x34,
+    0xCB, 0x9C, 0x6F, 0x39, 0xBD, 0xF5, 0xA8, 0xD2,
+    0xF1, 0x34, 0x37, 0x9E, 0x16, 0xD8, 0x22, 0xF6,
+    0x52, 0x21, 0x70, 0xCC, 0xF2, 0xDD, 0xD5, 0x5C,
+    0x84, 0xB9, 0xE6, 0xC6, 0x4F, 0xC9, 0x27, 0xAC,
+    0x4C, 0xF8, 0xDF, 0xB2, 0xA1, 0x77, 0x01, 0xF2
+  },
+  {
+    0x69, 0x5D, 0x83, 0xBD, 0x99, 0x0A, 0x11, 0x17,
+    0xB3, 0xD0, 0xCE, 0x06, 0xCC, 0x88, 0x80, 0x27,
+    0xD1, 0x2A, 0x05, 0x4C, 0x26, 0x77, 0xFD, 0x82,
+    0xF0, 0xD4, 0xFB, 0xFC, 0x93, 0x57, 0x55, 0x23,
+    0xE7, 0x99, 0x1A, 0x5E, 0x35, 0xA3, 0x75, 0x2E,
+    0x9B, 0x70, 0xCE, 0x62, 0x99, 0x2E, 0x26, 0x8A,
+    0x87, 0x77, 0x44, 0xCD, 0xD4, 0x35, 0xF5, 0xF1,
+    0x30, 0x86, 0x9C, 0x9A, 0x20, 0x74, 0xB3, 0x38
+  },
+  {
+    0xA6, 0x21, 0x37, 0x43, 0x56, 0x8E, 0x3B, 0x31,
+    0x58, 0xB9, 0x18, 0x43, 0x01, 0xF3, 0x69, 0x08,
+    0x47, 0x55, 0x4C, 0x68, 0x45, 0x7C, 0xB4, 0x0F,
+    0xC9, 0xA4, 0xB8, 0xCF, 0xD8, 0xD4, 0xA1, 0x18,
+    0xC3, 0x01, 0xA0, 0x77, 0x37, 0xAE, 0xDA, 0x0F,
+    0x92, 0x9C, 0x68, 0x91, 0x3C, 0x5F, 0x51, 0xC8,
+    0x03, 0x94, 0xF5, 0x3B, 0xFF, 0x1C, 0x3E, 0x83,
+    0xB2, 0xE4, 0x0C, 0xA9, 0x7E, 0xBA, 0x9E, 0x15
+  },
+  {
+    0xD4, 0x44, 0xBF, 0xA2, 0x36, 0x2A, 0x96, 0xDF,
+    0x21, 0x3D, 0x07, 0x0E, 0x33, 0xFA, 0x84, 0x1F,
+    0x51, 0x33, 0x4E, 0x4E, 0x76, 0x86, 0x6B, 0x81,
+    0x39, 0xE8, 0xAF, 0x3B, 0xB3, 0x39, 0x8B, 0xE2,
+    0xDF, 0xAD, 0xDC, 0xBC, 0x56, 0xB9, 0x14, 0x6D,
+    0xE9, 0xF6, 0x81, 0x18, 0xDC, 0x58, 0x29, 0xE7,
+    0x4B, 0x0C, 0x28, 0xD7, 0x71, 0x19, 0x07, 0xB1,
+    0x21, 0xF9, 0x16, 0x1C, 0xB9, 0x2B, 0x69, 0xA9
+  },
+  {
+    0x14, 0x27, 0x09, 0xD6, 0x2E, 0x28, 0xFC, 0xCC,
+    0xD0, 0xAF, 0x97, 0xFA, 0xD0, 0xF8, 0x46, 0x5B,
+    0x97, 0x1E, 0x82, 0x20, 0x1D, 0xC5, 0x10, 0x70,
+    0xFA, 0xA0, 0x37, 0x2A, 0xA4, 0x3E, 0x92, 0x48,
+    0x4B, 0xE1, 0xC1, 0xE7, 0x3B, 0xA1, 0x09, 0x06,
+    0xD5, 0xD1, 0x85, 0x3D, 0xB6, 0xA4, 0x10, 0x6E,
+    0x0A, 0x7B, 0xF9, 0x80, 0x0D, 0x37, 0x3D, 0x6D,
+    0xEE, 0x2D, 0x46, 0xD6, 0x2E, 0xF2, 0xA4, 0x61
+  }
+};
+
+static const uint8_t blake2b_ckb_kat[BLAKE2_KAT_LENGTH][BLAKE2B_CKB_HASH_BYTES] =
+{
+  {
+    0x44, 0xF4, 0xC6, 0x97, 0x44, 0xD5, 0xF8, 0xC5,
+    0x5D, 0x64, 0x20, 0x62, 0x94, 0x9D, 0xCA, 0xE4,
+    0x9B, 0xC4, 0xE7, 0xEF, 0x43, 0xD3, 0x88, 0xC5,
+    0xA1, 0x2F, 0x42, 0xB5, 0x63, 0x3D, 0x16, 0x3E
+  },
+  {
+    0xEF, 0x3F, 0x12, 0x52, 0xFE, 0x6F, 0x37, 0x3C,
+    0x05, 0xE5, 0xE9, 0xC6, 0x37, 0x1E, 0x23, 0x0E,
+    0x29, 0xC1, 0x22, 0x6B, 0x21, 0x75, 0x2A, 0xB2,
+    0x16, 0x11, 0x47, 0x9B, 0x57, 0xA0, 0xF9, 0xD6
+  },
+  {
+    0xE3, 0xC2, 0xB1, 0xE3, 0xD5, 0x71, 0x76, 0xFF,
+    0xCD, 0x02, 0xCB, 0xDF, 0x3A, 0x53, 0x71, 0x60,
+    0x72, 0x60, 0xDA, 0x55, 0x1E, 0x4C, 0x6B, 0xB9,
+    0x7F, 0x2A, 0xCF, 0xF4, 0x1B, 0xC6, 0x2A, 0x90
+  },
+  {
+    0x54, 0x77, 0x38, 0x3E, 0x25, 0xAE, 0x13, 0xA6,
+    0xD0, 0x0D, 0x3E, 0xD7, 0x19, 0x21, 0xC0, 0x86,
+    0xB9, 0xB2, 0x67, 0x6F, 0x18, 0xBF, 0xF7, 0xE6,
+    0x82, 0x81, 0x0D, 0x68, 0x06, 0x6F, 0x91, 0xC5
+  },
+  {
+    0x3C, 0x91, 0xCB, 0xF7, 0x4A, 0xFD, 0xF4, 0x40,
+    0x01, 0xB7, 0x98, 0x43, 0x73, 0x7E, 0x30, 0x38,
+    0xAC, 0x12, 0x31, 0x7E, 0x6F, 0x5E, 0x7E, 0x5A,
+    0x6D, 0xDB, 0xAE, 0x06, 0x37, 0x8E, 0x3C, 0xC6
+  },
+  {
+    0xE3, 0xF3, 0x5A, 0x0A, 0x30, 0xA6, 0xB4, 0xBC,
+    0x53, 0x45, 0x24, 0x4E, 0x5B, 0x29, 0x14, 0x9D,
+    0xDA, 0x13, 0x04, 0x24, 0x5A, 0xE7, 0xBA, 0x37,
+    0xAB, 0xB9, 0xE4, 0x62, 0x49, 0x55, 0x67, 0x68
+  },
+  {
+    0x20, 0xA5, 0x84, 0x6D, 0xC5, 0x4F, 0x01, 0x72,
+    0xD2, 0x15, 0xF7, 0x16, 0x59, 0xE2, 0x4B, 0x3B,
+    0x9B, 0x12, 0x29, 0x16, 0xF3, 0x52, 0xFD, 0x98,
+    0xB5, 0xA4, 0xD0, 0xEC, 0xE2, 0x08, 0xBE, 0xCE
+  },
+  {
+    0x7E, 0xBE, 0x6B, 0x8E, 0x60, 0xB5, 0xD8, 0x41,
+    0x6A, 0x79, 0x78, 0x3E, 0xC4, 0x0B, 0x97, 0x2F,
+    0x67, 0x21, 0x5A, 0xE8, 0x03, 0xDA, 0xAE, 0x37,
+    0x45, 0x22, 0x35, 0x7C, 0xB1, 0x8A, 0x15, 0x36
+  },
+  {
+    0x19, 0xE1, 0x45, 0xC7, 0xA2, 0xBB, 0x9A, 0xFD,
+    0x9B, 0xF0, 0xF3, 0xCE, 0x20, 0xCC, 0x41, 0x56,
+    0x45, 0xA6, 0xC0, 0xC9, 0x96, 0xC6, 0xE6, 0xB3,
+    0x67, 0xE7, 0x2F, 0x28, 0xFE, 0x0D, 0x51, 0x07
+  },
+  {
+    0x4B, 0x89, 0x38, 0x7A, 0x2E, 0x80, 0xA9, 0xC8,
+    0xBF, 0x04, 0x49, 0xC6, 0x7A, 0x09, 0x18, 0x88,
+    0x9E, 0x62, 0x3E, 0x5A, 0xC9, 0x35, 0x89, 0xAC,
+    0x47, 0xFA, 0x6A, 0xD1, 0xE3, 0xEC, 0x9B, 0x71
+  },
+  {
+    0x47, 0x66, 0xA7, 0x2E, 0x22, 0xFC, 0xB0, 0x4D,
+    0x8E, 0xF4, 0x84, 0xAA, 0x8F, 0xE3, 0xA2, 0x0E,
+    0xDA, 0x36, 0x1F, 0xE0, 0x3A, 0x77, 0xDC, 0x44,
+    0x60, 0xDB, 0xC7, 0x9D, 0xF1, 0xFF, 0x01, 0x2A
+  },
+  {
+    0x63, 0x0D, 0xD0, 0x27, 0x98, 0x52, 0x7D, 0xFD,
+    0xDF, 0xAD, 0x5F, 0xAD, 0xB1, 0xFE, 0x8D, 0x23,
+    0x9D, 0x40, 0xFB, 0x11, 0xD3, 0xCB, 0x93, 0xD1,
+    0x9A, 0x10, 0x57, 0x71, 0x50, 0x2A, 0xDB, 0x5D
+  },
+  {
+    0x32, 0xDF, 0xBA, 0x4A, 0x5B, 0x8D, 0xC3, 0x07,
+    0x84, 0xB3, 0xD1, 0xF8, 0x41, 0x27, 0x5D, 0x50,
+    0x15, 0x79, 0x7D, 0x91, 0x2A, 0xE3, 0x79, 0xCD,
+    0x6B, 0xAA, 0xBD, 0x3F, 0x0C, 0xCD, 0xB9, 0x76
+  },
+  {
+    0xB7, 0xB1, 0x97, 0xD3, 0x05, 0x4D, 0x75, 0xE0,
+    0x6E, 0x97, 0xAA, 0x05, 0xF9, 0xB7, 0x4D, 0x23,
+    0x1D, 0xB8, 0xF9, 0xC1, 0xAC, 0x0E, 0xB3, 0x19,
+    0x9D, 0x99, 0x21, 0x1A, 0x8A, 0x7F, 0xEF, 0x15
+  },
+  {
+    0x65, 0x6D, 0xC3, 0xE8, 0x7F, 0x18, 0x89, 0xC1,
+    0x37, 0x53, 0xAE, 0x44, 0xDC, 0xB7, 0x57, 0x67,
+    0x4D, 0x11, 0x20, 0xC7, 0xF6, 0x4E, 0x92, 0x07,
+    0x42, 0x9F, 0x38, 0x62, 0x7D, 0x43, 0x45, 0x33
+  },
+  {
+    0x41, 0x52, 0x6D, 0x19, 0x19, 0x12, 0xCA, 0x75,
+    0xC9, 0xE8, 0x87, 0x5D, 0x78, 0x89, 0xBB, 0xC6,
+    0x47, 0xD5, 0xF0, 0xF2, 0x83, 0x33, 0x48, 0x37,
+    0x0B, 0x8C, 0xD8, 0xA4, 0x2A, 0xD8, 0x9D, 0x3A
+  },
+  {
+    0x60, 0xC8, 0x71, 0x50, 0x94, 0xAC, 0x13, 0xCF,
+    0xAE, 0x7F, 0xC1, 0xA5, 0x65, 0x3C, 0xBE, 0xC3,
+    0xA6, 0xD0, 0xC0, 0x54, 0x9E, 0x4A, 0x47, 0xFD,
+    0xB1, 0x79, 0x89, 0x99, 0x29, 0x72, 0x8D, 0x1C
+  },
+  {
+    0xED, 0xDD, 0xBA, 0x2D, 0x10, 0xA2, 0xAB, 0x1E,
+    0x05, 0x2F, 0xC8, 0xCA, 0x13, 0x8E, 0xCD, 0xFE,
+    0x6A, 0xE3, 0x1D, 0x06, 0xCF, 0x04, 0xFA, 0x24,
+    0x44, 0x2B, 0x01, 0x58, 0x32, 0x92, 0xF7, 0xA2
+  },
+  {
+    0x4E, 0xFD, 0xC9, 0xF5, 0xE2, 0xB2, 0x75, 0x83,
+    0xF9, 0xDB, 0x11, 0xBD, 0x94, 0x30, 0x5A, 0x46,
+    0xAF, 0x80, 0x85, 0x3A, 0xC4, 0x66, 0x6B, 0x26,
+    0xD6, 0xDD, 0xCC, 0x59, 0xEC, 0xE6, 0x58, 0x31
+  },
+  {
+    0xF9, 0x73, 0x56, 0x25, 0x8E, 0x8C, 0x16, 0x47,
+    0xBC, 0x60, 0xDB, 0xC8, 0x80, 0x54, 0x02, 0x3B,
+    0x28, 0xA2, 0x8F, 0x52, 0xE8, 0xC3, 0xBE, 0x03,
+    0x70, 0x2C, 0xE0, 0x2E, 0x8C, 0x08, 0x16, 0x92
+  },
+  {
+    0xA2, 0x2F, 0x20, 0xDF, 0x7C, 0x3C, 0x21, 0x5D,
+    0x9F, 0x37, 0x96, 0x36, 0x18, 0x03, 0x90, 0xA8,
+    0x1D, 0x39, 0x52, 0xE2, 0x66, 0xC0, 0x38, 0xAC,
+    0x89, 0xC2, 0xE3, 0x17, 0x5B, 0x5F, 0xF8, 0x48
+  },
+  {
+    0xF1, 0xBB, 0xDE, 0x2D, 0x3E, 0x38, 0x6B, 0x0B,
+    0x9D, 0x52, 0x6E, 0x69, 0xBD, 0xC9, 0x61, 0x69,
+    0x90, 0x5D, 0x89, 0x50, 0x12, 0xC9, 0xDE, 0xB9,
+    0xC0, 0x65, 0x1E, 0x5B, 0x26, 0xC3, 0xFB, 0xDF
+  },
+  {
+    0xA2, 0x45, 0x5A, 0xEF, 0xE9, 0xC5, 0x66, 0xB5,
+    0x59, 0x39, 0x67, 0x2A, 0xD8, 0xA3, 0xAC, 0x14,
+    0x39, 0xDF, 0x64, 0xC8, 0xBA, 0xC9, 0xBF, 0xFA,
+    0x73, 0xF4, 0xCB, 0x92, 0x30, 0xEF, 0x71, 0x04
+  },
+  {
+    0x23, 0xBA, 0xBB, 0x72, 0xA9, 0x38, 0xF3, 0xC7,
+    0x7A, 0x7B, 0x85, 0x60, 0x26, 0xA4, 0x45, 0xD3,
+    0x12, 0xEB, 0x88, 0x6C, 0xA8, 0x7F, 0xBC, 0x09,
+    0x05, 0xFC, 0xD5, 0xA9, 0xBE, 0x19, 0x5F, 0xD8
+  },
+  {
+    0xD9, 0x57, 0xC5, 0x55, 0x85, 0x6F, 0x15, 0x4B,
+    0xE6, 0xA9, 0xE2, 0xDC, 0xA9, 0x9B, 0x7E, 0x0B,
+    0x29, 0x6B, 0x4B, 0xC1, 0x85, 0x82, 0x6F, 0xCD,
+    0x7F, 0x59, 0x43, 0xE2, 0x02, 0x6E, 0xDE, 0x89
+  },
+  {
+    0x78, 0xD0, 0x9F, 0xF8, 0x1F, 0x55, 0xBB, 0x21,
+    0xE5, 0xB3, 0x33, 0x64, 0xF7, 0xB0, 0xF3, 0x59,
+    0xFF, 0x9F, 0xA5, 0x4D, 0x9F, 0x6F, 0x10, 0x99,
+    0x23, 0x7D, 0xDB, 0x22, 0x26, 0xC3, 0xFE, 0x7B
+  },
+  {
+    0x89, 0x31, 0x7B, 0x6F, 0x58, 0x02, 0xF2, 0x7A,
+    0x16, 0x1A, 0xFE, 0x2B, 0xC3, 0xD7, 0xA7, 0x69,
+    0x10, 0xBC, 0x71, 0xAB, 0x27, 0xC7, 0x60, 0x62,
+    0x17, 0xEE, 0x57, 0x11, 0x9C, 0xEC, 0x12, 0x3F
+  },
+  {
+    0x79, 0x5D, 0xB7, 0x80, 0xE0, 0xAE, 0x49, 0x8B,
+    0xDE, 0x3F, 0x7F, 0x34, 0x24, 0x35, 0x97, 0x64,
+    0xB3, 0x8F, 0x14, 0xD0, 0xD3, 0x20, 0x01, 0xA3,
+    0x07, 0x6E, 0xF1, 0xDD, 0x28, 0xC3, 0xCE, 0x8E
+  },
+  {
+    0x3B, 0xB1, 0xD5, 0x6B, 0xF6, 0xF4, 0xA2, 0x2E,
+    0xEA, 0xD1, 0x72, 0x0F, 0x1B, 0x7E, 0x68, 0x00,
+    0x4A, 0x16, 0xA6, 0xA2, 0x43, 0x11, 0xFF, 0x9F,
+    0x76, 0x14, 0xDB, 0x14, 0x35, 0xDA, 0x79, 0xD9
+  },
+  {
+    0x76, 0xCA, 0x6F, 0x21, 0xF5, 0x7D, 0x27, 0x33,
+    0x52, 0x17, 0x83, 0xB1, 0x1B, 0x0A, 0x38, 0x1E,
+    0x91, 0x84, 0x43, 0x9F, 0x1B, 0x58, 0x71, 0xFD,
+    0xA6, 0x6C, 0x64, 0x11, 0x6A, 0x08, 0x14, 0xB2
+  },
+  {
+    0x6D, 0xFF, 0xC3, 0xCF, 0x1F, 0x77, 0x0A, 0x02,
+    0xFF, 0xD6, 0x92, 0x9A, 0xB8, 0xC7, 0x51, 0xE4,
+    0x58, 0x98, 0x24, 0x98, 0x3E, 0xD3, 0x0B, 0x52,
+    0xDE, 0xA3, 0x73, 0x3F, 0x70, 0xC6, 0x8B, 0xD1
+  },
+  {
+    0xC7, 0x43, 0x18, 0x53, 0x7E, 0x2C, 0x66, 0x82,
+    0x71, 0xDB, 0xA8, 0x0C, 0x53, 0x97, 0x9D, 0x0D,
+    0xF4, 0x8F, 0x25, 0xD4, 0xE2, 0x0C, 0x7A, 0x31,
+    0xC3, 0x74, 0x1D, 0xFE, 0xAD, 0x15, 0x43, 0x97
+  },
+  {
+    0x5E, 0xF2, 0x1C, 0x91, 0x65, 0x86, 0xED, 0x31,
+    0x12, 0x46, 0x8F, 0x10, 0x77, 0x56, 0x79, 0x7E,
+    0xCB, 0x56, 0xC7, 0x2F, 0xC7, 0x2D, 0x4D, 0xA3,
+    0x3D, 0x0F, 0x87, 0x6D, 0x6A, 0x17, 0x8C, 0xF9
+  },
+  {
+    0xF6, 0x4B, 0xA3, 0x71, 0xA6, 0x1B, 0xD2, 0x42,
+    0xCC, 0xDD, 0x73, 0x5E, 0xB0, 0x7C, 0x72, 0xE0,
+    0xE6, 0x34, 0x3A, 0x7D, 0x49, 0x80, 0xE4, 0x91,
+    0x32, 0x3E, 0x68, 0x6E, 0xF9, 0x12, 0xA0, 0x3A
+  },
+  {
+    0xA8, 0x4A, 0xCB, 0x65, 0xBE, 0x5E, 0x22, 0xEF,
+    0xF2, 0x07, 0xF6, 0xEC, 0x85, 0x0A, 0x16, 0x06,
+    0x53, 0xD7, 0x10, 0x32, 0x0C, 0xBD, 0xCD, 0x16,
+    0x7E, 0xA8, 0xF2, 0xDA, 0x27, 0xC6, 0x55, 0x0B
+  },
+  {
+    0x3C, 0x95, 0x9B, 0xFC, 0x30, 0xCE, 0x8E, 0xD7,
+    0x14, 0xCC, 0x1C, 0xE2, 0x05, 0x0B, 0x50, 0xBD,
+    0xFE, 0xD6, 0xD7, 0xA0, 0xB0, 0x2B, 0x1E, 0x3E,
+    0x0A, 0x30, 0x7B, 0x5C, 0xB1, 0xD2, 0xB5, 0x89
+  },
+  {
+    0x7F, 0xCC, 0x9F, 0x19, 0x9D, 0x02, 0xDB, 0xA5,
+    0x3C, 0x4A, 0xA1, 0xD7, 0x08, 0x93, 0x2A, 0xA7,
+    0xED, 0xD8, 0x84, 0x42, 0x70, 0x6C, 0x51, 0xE6,
+    0x35, 0xBD, 0xB2, 0x1C, 0x9F, 0x91, 0x29, 0x57
+  },
+  {
+    0x99, 0xD3, 0x06, 0xEE, 0x0F, 0xC9, 0x58, 0x0D,
+    0x0D, 0x4B, 0xD1, 0xF6, 0x4C, 0xFA, 0x27, 0xAC,
+    0x16, 0xF0, 0xB3, 0x27, 0x0F, 0xF1, 0xCB, 0x80,
+    0xDD, 0x45, 0x45, 0xD1, 0x99, 0x87, 0x92, 0xE1
+  },
+  {
+    0x55, 0xBE, 0x3B, 0xBA, 0x59, 0x7B, 0x0C, 0xBF,
+    0xC2, 0xC4, 0x9F, 0x1B, 0xA1, 0xF5, 0x2A, 0x87,
+    0x46, 0x20, 0xD1, 0x35, 0xAC, 0xD1, 0xEF, 0x66,
+    0xF6, 0x6C, 0xA8, 0x1E, 0x2F, 0xDA, 0xED, 0x04
+  },
+  {
+    0xEC, 0x6D, 0x99, 0x43, 0x36, 0xBA, 0x72, 0x22,
+    0xB9, 0x84, 0x60, 0xE8, 0x8C, 0x81, 0x36, 0x60,
+    0x46, 0xBC, 0xBF, 0x37, 0x89, 0x6C, 0x5B, 0x7E,
+    0x2E, 0x6A, 0x36, 0x27, 0x1C, 0x6B, 0x4B, 0xEA
+  },
+  {
+    0xFE, 0xE2, 0x73, 0x0D, 0x1B, 0xD2, 0x3B, 0xC3,
+    0xB6, 0x7D, 0x47, 0xA5, 0x49, 0x67, 0xFA, 0x77,
+    0x43, 0x01, 0x74, 0x95, 0xC9, 0x9A, 0x50, 0x37,
+    0xC6, 0xEC, 0xAA, 0x0B, 0xE4, 0xBD, 0x1D, 0x5B
+  },
+  {
+    0xF2, 0x9A, 0x10, 0x12, 0xD7, 0x20, 0x7C, 0x33,
+    0x38, 0xED, 0x01, 0x5B, 0x77, 0xA4, 0x2A, 0x4D,
+    0x4B, 0x56, 0xF2, 0x8A, 0xE0, 0xF3, 0x2F, 0x34,
+    0xC6, 0x6E, 0x38, 0xF5, 0x5C, 0x3C, 0x68, 0xE3
+  },
+  {
+    0xE7, 0xE0, 0xAE, 0x83, 0x94, 0x2D, 0xF9, 0x63,
+    0xC3, 0xBD, 0xE8, 0x80, 0x6B, 0xCD, 0x7D, 0xE1,
+    0x64, 0xDB, 0x28, 0x2A, 0x58, 0xF5, 0x60, 0xA6,
+    0x20, 0x3C, 0xC7, 0x5B, 0xEE, 0x19, 0xD8, 0x4D
+  },
+  {
+    0xF1, 0xFB, 0x59, 0x0A, 0xF3, 0x0D, 0x76, 0x78,
+    0xE5, 0xC3, 0xA2, 0xF8, 0xDE, 0x7C, 0x56, 0x96,
+    0x7C, 0x43, 0x37, 0x5E, 0x12, 0xAA, 0xD7, 0x66,
+    0xFF, 0xD0, 0x14, 0x7E, 0x91, 0x46, 0x01, 0x58
+  },
+  {
+    0x01, 0x68, 0xF7, 0xB7, 0xB8, 0xF1, 0x8E, 0x08,
+    0x23, 0x7E, 0x35, 0x6C, 0x69, 0xBC, 0x64, 0xF4,
+    0xFF, 0x19, 0x7A, 0x54, 0xFF, 0x96, 0x06, 0x16,
+    0xBA, 0xE0, 0x49, 0x1C, 0x6E, 0x78, 0x6B, 0x5E
+  },
+  {
+    0x0E, 0xF1, 0xE5, 0x7E, 0x32, 0xF4, 0x12, 0xA1,
+    0x57, 0x49, 0xFE, 0xE8, 0xDE, 0x5C, 0x17, 0x6F,
+    0xD8, 0x30, 0x7A, 0xBB, 0xC3, 0x29, 0xB0, 0xEE,
+    0xF2, 0x84, 0x38, 0xF6, 0xA3, 0x9B, 0x6B, 0x1A
+  },
+  {
+    0x78, 0x30, 0x6E, 0x31, 0x8E, 0x49, 0x36, 0x78,
+    0x49, 0x04, 0xDE, 0x0C, 0x64, 0xEA, 0x14, 0x13,
+    0x93, 0xC3, 0x01, 0x68, 0x7F, 0xA3, 0x67, 0xDF,
+    0x95, 0x85, 0x65, 0x16, 0x32, 0xB4, 0x11, 0x59
+  },
+  {
+    0xD9, 0x56, 0xA3, 0x09, 0x9D, 0x1E, 0xB3, 0x62,
+    0x4B, 0x59, 0x45, 0xBB, 0xA8, 0x6C, 0xF5, 0x91,
+    0x02, 0x3E, 0x92, 0xD6, 0x81, 0xF1, 0x91, 0x8C,
+    0x9B, 0x8A, 0x15, 0x5E, 0x03, 0x96, 0x1B, 0x20
+  },
+  {
+    0xC6, 0x23, 0x6F, 0x9D, 0xBA, 0x53, 0x52, 0x64,
+    0xF1, 0xC9, 0x61, 0xCB, 0xB4, 0xE8, 0x73, 0x23,
+    0x03, 0x43, 0x81, 0x6C, 0x49, 0x76, 0x63, 0x1B,
+    0x4D, 0xEE, 0xB2, 0xF6, 0x28, 0xF6, 0xDB, 0x84
+  },
+  {
+    0x5B, 0x26, 0x0C, 0x76, 0x4A, 0x57, 0x22, 0xD6,
+    0x84, 0x4B, 0x74, 0x89, 0xB2, 0xD6, 0x4B, 0xA9,
+    0x4F, 0x7D, 0x62, 0xAC, 0xBF, 0xDC, 0x5E, 0xB6,
+    0x28, 0x30, 0xA0, 0x5D, 0x75, 0xB0, 0xCD, 0xC7
+  },
+  {
+    0xF4, 0x27, 0xDE, 0xC7, 0x11, 0x00, 0xD8, 0x81,
+    0xF6, 0x20, 0xFD, 0x0F, 0xB7, 0xFC, 0x53, 0xF2,
+    0xF0, 0x60, 0x94, 0xCB, 0x62, 0x7A, 0xE6, 0x84,
+    0xBD, 0xC9, 0x8F, 0xB7, 0x0B, 0x9E, 0x3B, 0x07
+  },
+  {
+    0x1D, 0x9D, 0x04, 0xC6, 0x98, 0x5F, 0x10, 0x7F,
+    0xDA, 0x27, 0x07, 0x35, 0x18, 0x9F, 0xC0, 0xB8,
+    0x1F, 0x26, 0xA8, 0x52, 0xE9, 0xCB, 0x83, 0xD9,
+    0xC5, 0x63, 0x2B, 0x02, 0xA3, 0xDA, 0x7F, 0xD1
+  },
+  {
+    0xAF, 0x9A, 0xE9, 0xA8, 0x8C, 0x70, 0x5B, 0x09,
+    0xF7, 0x69, 0xC5, 0x32, 0x17, 0x50, 0xD1, 0xB0,
+    0xA1, 0x99, 0x29, 0x23, 0xCB, 0x58, 0x6D, 0x41,
+    0xEC, 0x14, 0x99, 0x87, 0xE7, 0x60, 0xD9, 0x46
+  },
+  {
+    0x67, 0xDD, 0x65, 0x13, 0x06, 0x90, 0x99, 0x99,
+    0xB0, 0xEF, 0x78, 0x6F, 0x49, 0xBF, 0x93, 0x30,
+    0x33, 0x74, 0x2E, 0x26, 0x75, 0x30, 0x53, 0x44,
+    0xB4, 0x67, 0x61, 0x89, 0x5B, 0x6E, 0x62, 0x33
+  },
+  {
+    0xBF, 0x2D, 0x36, 0x3F, 0x72, 0xE2, 0xFA, 0x37,
+    0xE9, 0x16, 0xED, 0x7C, 0xFB, 0x87, 0x04, 0x45,
+    0xBD, 0xB9, 0x42, 0x16, 0x4D, 0xA0, 0x4D, 0x0B,
+    0x18, 0xDB, 0x40, 0x2C, 0x04, 0x35, 0x68, 0x55
+  },
+  {
+    0x13, 0x4B, 0x3B, 0xD5, 0x71, 0xF3, 0x67, 0xDE,
+    0x8E, 0x03, 0xF2, 0x00, 0xF0, 0xF9, 0x14, 0x07,
+    0x77, 0xC2, 0xEA, 0x1B, 0xB3, 0xF2, 0x1A, 0x7F,
+    0xCE, 0xF3, 0x8A, 0x83, 0xCF, 0x89, 0xE1, 0x3A
+  },
+  {
+    0x46, 0x3C, 0x10, 0x89, 0x4F, 0xEA, 0x96, 0xFB,
+    0x62, 0xE3, 0xD3, 0x36, 0xEC, 0xEE, 0xE7, 0x76,
+    0xE2, 0xC8, 0x93, 0x54, 0x8E, 0x6A, 0xF2, 0x73,
+    0x39, 0x80, 0x37, 0x72, 0xC4, 0xDB, 0x54, 0x69
+  },
+  {
+    0xF6, 0x61, 0x7A, 0x34, 0x30, 0x3A, 0xE3, 0xC6,
+    0xE8, 0x9B, 0x26, 0x18, 0xE9, 0xAA, 0x2C, 0xCD,
+    0x2D, 0x84, 0xDE, 0x46, 0x60, 0x6E, 0x1F, 0xB7,
+    0xE4, 0xEF, 0x34, 0xCD, 0xC9, 0x9E, 0x71, 0x05
+  },
+  {
+    0x5F, 0x68, 0x44, 0xE2, 0x03, 0x8B, 0xA6, 0xDD,
+    0x29, 0x9D, 0x64, 0x5E, 0x98, 0xEF, 0x95, 0x11,
+    0x1B, 0x28, 0x79, 0x95, 0x10, 0x6D, 0xAF, 0x42,
+    0x1E, 0x5E, 0xD5, 0x0A, 0x9D, 0x15, 0x7F, 0xAF
+  },
+  {
+    0x43, 0x92, 0xC5, 0xCF, 0x1C, 0xBB, 0x8D, 0xDB,
+    0x31, 0xDC, 0xFA, 0x12, 0x7A, 0x09, 0x28, 0x20,
+    0x7B, 0x3E, 0x93, 0x7F, 0x9D, 0x39, 0x67, 0xC1,
+    0x0B, 0x59, 0x38, 0x2E, 0x5A, 0xEF, 0xF0, 0x04
+  },
+  {
+    0xD0, 0x8D, 0x29, 0xCA, 0x8D, 0x28, 0x36, 0xF5,
+    0x7F, 0xF2, 0xA7, 0xE4, 0xB3, 0xAE, 0x52, 0x2E,
+    0xD3, 0xBF, 0xAF, 0xDF, 0x8A, 0x7E, 0x82, 0x4B,
+    0x33, 0xB4, 0x86, 0x42, 0xAA, 0xF8, 0x6A, 0xDE
+  },
+  {
+    0x0A, 0x6F, 0x1D, 0x3F, 0xFA, 0x6E, 0xB3, 0xB3,
+    0xA5, 0x45, 0x71, 0xA1, 0x2A, 0x88, 0xD4, 0xCE,
+    0x1B, 0xD4, 0x5D, 0xBB, 0x41, 0xBF, 0x58, 0x86,
+    0x15, 0x8C, 0x93, 0x67, 0x6C, 0xC8, 0x87, 0xE0
+  },
+  {
+    0x10, 0xB8, 0x2F, 0x53, 0xFF, 0x26, 0x19, 0x12,
+    0xD6, 0xF7, 0x7B, 0x54, 0xBA, 0x77, 0xA3, 0x25,
+    0x79, 0x6E, 0x93, 0x71, 0xF6, 0xA1, 0xEF, 0x28,
+    0x63, 0x2E, 0x50, 0x30, 0x9B, 0xEE, 0xDA, 0xB5
+  },
+  {
+    0x70, 0xC1, 0x66, 0x73, 0x13, 0x4B, 0x11, 0xB6,
+    0xBE, 0xB8, 0xB6, 0xE9, 0xCC, 0x9A, 0xBB, 0x65,
+    0xE3, 0x8E, 0x99, 0xF1, 0xCB, 0xF3, 0x2A, 0x34,
+    0x78, 0xA0, 0x3E, 0x93, 0xF9, 0xD3, 0xA3, 0x79
+  },
+  {
+    0x19, 0xBA, 0xAD, 0x37, 0xE4, 0x49, 0x83, 0x39,
+    0x94, 0xD2, 0x6E, 0x0B, 0xB5, 0x7A, 0xC2, 0x81,
+    0xD1, 0x85, 0x03, 0x26, 0xE9, 0x80, 0x24, 0xA7,
+    0xE0, 0x07, 0xD4, 0xA4, 0x16, 0xEA, 0x42, 0x2A
+  },
+  {
+    0xE2, 0x7F, 0xA5, 0xBF, 0x57, 0x20, 0x2B, 0xF8,
+    0xE7, 0x2A, 0x66, 0x8B, 0x97, 0x2C, 0x5E, 0x50,
+    0x7D, 0x5F, 0xC6, 0xAE, 0xD1, 0x7A, 0x42, 0xE8,
+    0x94, 0x84, 0x03, 0x95, 0x3E, 0x7C, 0xC7, 0xC1
+  },
+  {
+    0x6F, 0x40, 0x96, 0xD3, 0x29, 0x9A, 0xB2, 0x2D,
+    0x68, 0x32, 0xCC, 0x9A, 0x07, 0xD9, 0x6E, 0x58,
+    0x58, 0xFE, 0xFA, 0xA2, 0xA0, 0x7F, 0xDA, 0x91,
+    0xF7, 0xE5, 0xF6, 0xB5, 0x14, 0x4F, 0xFD, 0x9B
+  },
+  {
+    0x16, 0x8C, 0x60, 0x8B, 0xD2, 0xD1, 0x77, 0x69,
+    0xF6, 0x51, 0x04, 0xA7, 0xE3, 0xEB, 0x5D, 0x26,
+    0x1D, 0x1E, 0x95, 0x7B, 0x6E, 0x21, 0xB6, 0x7F,
+    0x4A, 0xAD, 0xD8, 0xD4, 0x73, 0x5F, 0x9F, 0xBE
+  },
+  {
+    0xB4, 0x19, 0xD3, 0x81, 0xE2, 0x62, 0x03, 0x94,
+    0x47, 0x95, 0x68, 0x17, 0x3B, 0xD6, 0xBF, 0x53,
+    0x5E, 0x7B, 0xAB, 0x9B, 0x5F, 0x60, 0x83, 0x3C,
+    0x58, 0xA3, 0xDF, 0xF5, 0xAA, 0xF0, 0xA8, 0xD2
+  },
+  {
+    0x1F, 0xA5, 0xE8, 0x16, 0xAD, 0xCE, 0x7B, 0x4B,
+    0xC8, 0x12, 0x38, 0x21, 0x8D, 0x5B, 0x63, 0xF9,
+    0x7A, 0xFA, 0x23, 0x07, 0x7A, 0x7E, 0xFE, 0xCD,
+    0x72, 0x4E, 0x9B, 0x70, 0x0E, 0xFD, 0xE7, 0xE2
+  },
+  {
+    0x64, 0x9A, 0x28, 0x54, 0xA0, 0xF9, 0x70, 0xAD,
+    0xDF, 0xD6, 0x1D, 0xD1, 0x6F, 0x48, 0x0E, 0x04,
+    0x2E, 0x73, 0xBC, 0xA1, 0x1A, 0x98, 0x82, 0x9C,
+    0x25, 0xCE, 0x6A, 0xA7, 0x6C, 0x56, 0xE5, 0xD3
+  },
+  {
+    0xAF, 0x72, 0x55, 0x29, 0xBD, 0x63, 0x57, 0x9F,
+    0xB9, 0xA1, 0x15, 0x6A, 0x15, 0xB5, 0x8C, 0x2D,
+    0xC8, 0x77, 0xA1, 0x32, 0xBE, 0x05, 0xC8, 0xE2,
+    0xC0, 0xE0, 0x1D, 0xE8, 0x2D, 0x6C, 0xC3, 0xC2
+  },
+  {
+    0x1D, 0x67, 0x92, 0x98, 0xC7, 0xB5, 0xFC, 0x45,
+    0x9A, 0x9C, 0xB0, 0x10, 0x4C, 0x20, 0x0F, 0xFC,
+    0xDE, 0x07, 0x7E, 0x2A, 0x65, 0xBA, 0x51, 0x0E,
+    0x73, 0x4D, 0x36, 0x57, 0xD1, 0x01, 0x58, 0xDD
+  },
+  {
+    0xE4, 0xEC, 0x90, 0x9F, 0x8D, 0x49, 0x90, 0x46,
+    0x8D, 0xE9, 0xA1, 0x59, 0x34, 0x90, 0x3C, 0x65,
+    0xC9, 0x2B, 0x8F, 0xB9, 0x0C, 0x01, 0xCE, 0xA0,
+    0xFB, 0xAA, 0x31, 0x3F, 0x4D, 0xDC, 0xFB, 0x2A
+  },
+  {
+    0x57, 0x66, 0xC7, 0xCF, 0xEC, 0x10, 0x21, 0x78,
+    0xDA, 0xD5, 0x1B, 0xC0, 0xB5, 0x7B, 0xE1, 0xF3,
+    0x31, 0x22, 0x1D, 0x8F, 0xE0, 0x24, 0x00, 0x5F,
+    0x68, 0x5D, 0x7D, 0x23, 0x57, 0xE5, 0x88, 0x63
+  },
+  {
+    0x6F, 0xAD, 0xD1, 0xB9, 0x30, 0x8C, 0xF9, 0xA2,
+    0x55, 0x95, 0x9A, 0x13, 0x5C, 0x47, 0xAB, 0xDF,
+    0x6A, 0xAF, 0xAE, 0x19, 0x1C, 0xCF, 0x1A, 0xB1,
+    0x56, 0x9E, 0xF6, 0xB3, 0xDE, 0xA8, 0x4E, 0xAA
+  },
+  {
+    0xF4, 0x1D, 0x30, 0x9B, 0x28, 0x82, 0x5C, 0x5B,
+    0x64, 0x3E, 0x3F, 0x30, 0x7D, 0x6F, 0x36, 0x99,
+    0xA3, 0x35, 0x6D, 0x2F, 0xDB, 0xB7, 0xF0, 0xE3,
+    0x72, 0xA2, 0xA4, 0xB2, 0xCB, 0xF9, 0x44, 0xB4
+  },
+  {
+    0x60, 0x84, 0x0F, 0xCF, 0x74, 0x9A, 0x77, 0xBE,
+    0x39, 0xEB, 0xAA, 0x3E, 0xAD, 0x15, 0x77, 0x6E,
+    0x43, 0xE3, 0xBD, 0x99, 0xDC, 0x88, 0xB7, 0x79,
+    0x74, 0x7A, 0xF0, 0xB5, 0x5B, 0xDA, 0x6C, 0xB2
+  },
+  {
+    0xD7, 0x55, 0xB9, 0xA8, 0x71, 0x56, 0x7B, 0x2E,
+    0x25, 0xEF, 0x47, 0xE6, 0x99, 0xEA, 0x1E, 0xAF,
+    0xCD, 0x35, 0x0D, 0x94, 0x70, 0x70, 0x22, 0xBC,
+    0x62, 0x85, 0xF9, 0x2D, 0x33, 0x77, 0x70, 0x6E
+  },
+  {
+    0xC7, 0x07, 0x3B, 0x32, 0xD5, 0x81, 0x3A, 0x89,
+    0x25, 0xE9, 0xA6, 0x98, 0x49, 0x07, 0xEA, 0x0E,
+    0x20, 0xBA, 0xE6, 0xC0, 0xF6, 0x5B, 0x34, 0x06,
+    0x92, 0xB5, 0xE3, 0x65, 0x1F, 0x70, 0xDF, 0xD8
+  },
+  {
+    0xEC, 0x38, 0x87, 0x9C, 0xB4, 0x2E, 0xD4, 0x93,
+    0x5A, 0x22, 0x09, 0xB0, 0x6E, 0x5C, 0x9D, 0x8D,
+    0x4E, 0x89, 0xE6, 0xFC, 0x78, 0x13, 0x37, 0xF9,
+    0x69, 0x1E, 0x81, 0x29, 0x62, 0x89, 0x4F, 0x70
+  },
+  {
+    0x9E, 0x89, 0x9A, 0xB9, 0xBA, 0xF3, 0x0F, 0x03,
+    0x7A, 0xC6, 0x6D, 0xBA, 0x18, 0x7E, 0xAA, 0xA9,
+    0x91, 0x76, 0x54, 0x4E, 0xB1, 0x23, 0xB7, 0x6E,
+    0xFF, 0x0B, 0xEA, 0xE4, 0xBF, 0x50, 0x10, 0x70
+  },
+  {
+    0x24, 0x3F, 0xCF, 0x63, 0xE4, 0x36, 0x47, 0x85,
+    0xFA, 0x2E, 0xAE, 0x12, 0x28, 0x47, 0x15, 0x72,
+    0xF9, 0xF6, 0xD3, 0xC5, 0xBB, 0x48, 0xB8, 0x80,
+    0xF4, 0xC9, 0x98, 0xBC, 0x97, 0x68, 0x58, 0x26
+  },
+  {
+    0xF3, 0x3C, 0x8D, 0x81, 0x5F, 0xF4, 0x1B, 0x55,
+    0x9B, 0x25, 0xD8, 0xA4, 0xB2, 0x4A, 0x0A, 0x72,
+    0xAC, 0xEA, 0x14, 0xC2, 0xB0, 0x20, 0x88, 0x17,
+    0x11, 0xE9, 0xF1, 0xCC, 0x64, 0x0F, 0x1E, 0x08
+  },
+  {
+    0xD5, 0xE7, 0x6A, 0x8A, 0x73, 0xEF, 0x61, 0x77,
+    0x83, 0x56, 0xFA, 0x84, 0xC0, 0x52, 0x41, 0xCF,
+    0x88, 0xBF, 0x0F, 0x2B, 0xF3, 0xB0, 0x57, 0x3C,
+    0x86, 0xA6, 0x95, 0x70, 0xC6, 0xEA, 0x14, 0xB5
+  },
+  {
+    0x02, 0x05, 0x64, 0xFF, 0x3E, 0xF5, 0x76, 0xA7,
+    0x97, 0xD8, 0xAA, 0xD8, 0x56, 0x50, 0x9D, 0xC6,
+    0xB2, 0xAB, 0xF5, 0xF7, 0xD7, 0x1C, 0xC7, 0x7A,
+    0x78, 0x48, 0xCC, 0x6F, 0x9D, 0x56, 0x7C, 0x15
+  },
+  {
+    0x46, 0x27, 0x19, 0x7C, 0x65, 0x36, 0xAE, 0x01,
+    0x02, 0xFE, 0x16, 0xEC, 0x87, 0x68, 0x0B, 0x3A,
+    0x1E, 0x91, 0xB8, 0xDE, 0x08, 0xCF, 0xCF, 0xDA,
+    0x1A, 0xDA, 0x28, 0x8F, 0xDC, 0xFB, 0x70, 0xB3
+  },
+  {
+    0xA3, 0x6B, 0xE1, 0xE2, 0x64, 0x82, 0xCB, 0x84,
+    0x17, 0x09, 0xC9, 0x61, 0xE7, 0x94, 0xE1, 0xA7,
+    0x99, 0x66, 0x8F, 0x55, 0x5D, 0xED, 0x64, 0x01,
+    0x84, 0x68, 0x20, 0xB1, 0xCF, 0xAD, 0x3C, 0xA1
+  },
+  {
+    0xB7, 0x5A, 0x78, 0x36, 0x12, 0x79, 0xDB, 0x61,
+    0xF6, 0x9F, 0x33, 0x74, 0x9E, 0x28, 0xB3, 0x7D,
+    0xFB, 0x91, 0x97, 0x9C, 0xE6, 0x1F, 0xCB, 0x92,
+    0x0C, 0x79, 0x21, 0x53, 0x5D, 0x3E, 0x48, 0xA1
+  },
+  {
+    0x41, 0x6E, 0x2F, 0x91, 0xF1, 0x4A, 0xBE, 0xCB,
+    0x9C, 0x7A, 0x7E, 0x39, 0x00, 0x46, 0xD5, 0xED,
+    0x18, 0xD2, 0x0C, 0x56, 0x52, 0xBA, 0xC2, 0xB4,
+    0x95, 0x1E, 0x02, 0xC0, 0x16, 0x3D, 0xC3, 0x13
+  },
+  {
+    0xCD, 0x39, 0x83, 0x8A, 0x72, 0xFB, 0xDE, 0x1F,
+    0x48, 0x1D, 0x77, 0xA9, 0xA9, 0x9F, 0x8D, 0x59,
+    0x95, 0xDC, 0xF6, 0x61, 0x58, 0x5A, 0x29, 0xE7,
+    0x98, 0xA7, 0xAA, 0x80, 0x1E, 0xD7, 0x99, 0x19
+  },
+  {
+    0x66, 0x49, 0xB1, 0x8B, 0xE2, 0x3A, 0x2C, 0xCF,
+    0x2D, 0x9E, 0x2A, 0xEF, 0xF6, 0x8F, 0x18, 0x66,
+    0xC7, 0xBF, 0x0D, 0x89, 0xDE, 0x13, 0x0E, 0x27,
+    0x46, 0x6D, 0xDC, 0x1E, 0x67, 0x36, 0x37, 0x27
+  },
+  {
+    0x2C, 0x2C, 0xF2, 0xBD, 0xCD, 0xED, 0x74, 0xC0,
+    0x65, 0xEC, 0x72, 0xFD, 0xCA, 0x9D, 0x6D, 0xF1,
+    0x4A, 0x0E, 0x2E, 0x7F, 0x23, 0x7C, 0x37, 0xCF,
+    0x0E, 0x5D, 0xB5, 0xBB, 0x93, 0x2E, 0xD9, 0x87
+  },
+  {
+    0x75, 0x72, 0xD2, 0x86, 0x9F, 0x47, 0x87, 0x85,
+    0xBD, 0xEF, 0xE5, 0xBF, 0xB8, 0x89, 0x1B, 0xA7,
+    0x4B, 0x08, 0x7C, 0x37, 0x98, 0x66, 0x83, 0xA9,
+    0xDF, 0x28, 0x1C, 0xB9, 0xA5, 0x1C, 0xC9, 0x36
+  },
+  {
+    0x8C, 0x5B, 0xD8, 0x6D, 0x86, 0xC6, 0x36, 0x03,
+    0x0F, 0xC7, 0x61, 0x9A, 0x50, 0xD3, 0x8A, 0x6E,
+    0xBA, 0x10, 0x76, 0x48, 0xB0, 0x20, 0x8A, 0x0B,
+    0xC6, 0xD5, 0xB4, 0x7A, 0xB3, 0x1A, 0x6F, 0x5C
+  },
+  {
+    0xDA, 0x07, 0xA4, 0xC3, 0x3E, 0x15, 0xD1, 0x4D,
+    0xF9, 0x76, 0x86, 0xA1, 0x10, 0xD9, 0x21, 0x23,
+    0xE9, 0x10, 0xF4, 0xE7, 0xDC, 0xFB, 0xB8, 0x36,
+    0xFD, 0xAB, 0x5B, 0x8B, 0x5E, 0x01, 0x27, 0xD5
+  },
+  {
+    0x4C, 0x98, 0x00, 0xED, 0xFF, 0xD8, 0xE3, 0x9B,
+    0x9D, 0x05, 0x19, 0x70, 0x72, 0x76, 0xE5, 0x55,
+    0x65, 0x73, 0xB1, 0xE8, 0x19, 0x63, 0xFD, 0x82,
+    0x6B, 0xC5, 0xD0, 0x69, 0x7A, 0x61, 0x78, 0xD8
+  },
+  {
+    0x59, 0x16, 0xE8, 0x4D, 0x25, 0x10, 0x68, 0x59,
+    0xBB, 0xFE, 0x73, 0x0F, 0xAA, 0xD9, 0xF1, 0x45,
+    0x9B, 0xC8, 0xA4, 0xC5, 0x27, 0xE9, 0x58, 0xD4,
+    0xB5, 0x3D, 0xDF, 0x7B, 0x8F, 0xC1, 0xB9, 0x95
+  },
+  {
+    0x3A, 0xB0, 0x88, 0xD9, 0x61, 0xF9, 0xA3, 0xBF,
+    0x9D, 0x08, 0x9B, 0xD5, 0x0C, 0x4F, 0x08, 0xE4,
+    0x3F, 0x76, 0x34, 0xC0, 0x72, 0xA3, 0xC8, 0x1F,
+    0x46, 0x74, 0xF7, 0x86, 0xE4, 0x85, 0xFE, 0xBD
+  },
+  {
+    0x7F, 0xC5, 0xE5, 0xD9, 0x3E, 0xAD, 0xEC, 0x7C,
+    0x1D, 0x09, 0x6F, 0x97, 0x83, 0x3B, 0x0E, 0x95,
+    0xF6, 0xAB, 0xA1, 0xA2, 0xAB, 0x0F, 0x52, 0xC6,
+    0x70, 0xC2, 0xB1, 0xE2, 0x35, 0xA3, 0xFE, 0x1D
+  },
+  {
+    0xC9, 0x6C, 0x93, 0xE6, 0xC3, 0xDF, 0x0B, 0x34,
+    0x69, 0xA2, 0x3F, 0x13, 0xF8, 0x8C, 0x23, 0x8F,
+    0x9A, 0xE7, 0x06, 0xB2, 0xAB, 0x9D, 0x4D, 0xBC,
+    0xEC, 0xA5, 0x2F, 0xFB, 0xD3, 0x91, 0xC6, 0x32
+  },
+  {
+    0xE1, 0x1E, 0xD8, 0x2A, 0x33, 0xEE, 0x99, 0xF7,
+    0x34, 0x4B, 0x1A, 0x55, 0x49, 0x42, 0x36, 0xB0,
+    0x81, 0xE0, 0xC5, 0x75, 0xCF, 0x66, 0x49, 0x29,
+    0x9F, 0xC1, 0x82, 0xA2, 0x29, 0x31, 0x43, 0x1A
+  },
+  {
+    0xEC, 0xD7, 0xBB, 0xA8, 0xF3, 0x0E, 0x4A, 0x36,
+    0x16, 0x06, 0x49, 0xB5, 0x05, 0x91, 0x37, 0xCC,
+    0x69, 0x31, 0x37, 0xF7, 0xDA, 0xFA, 0x3C, 0x24,
+    0xD6, 0xC3, 0x87, 0x8B, 0x4F, 0xBB, 0x8F, 0xEC
+  },
+  {
+    0x70, 0x91, 0x93, 0x08, 0x30, 0xB1, 0xF8, 0xE4,
+    0x07, 0xCE, 0x1D, 0x3A, 0x1B, 0x90, 0x80, 0xF2,
+    0x6E, 0xF8, 0x8A, 0xE3, 0x3D, 0x0A, 0x91, 0xF6,
+    0x32, 0x9E, 0xCE, 0xB1, 0x52, 0x0D, 0xB5, 0x3A
+  },
+  {
+    0x2D, 0xD3, 0x9F, 0xF2, 0x25, 0xCC, 0x7B, 0x68,
+    0x46, 0xDE, 0x1B, 0x03, 0xA0, 0xBC, 0x2F, 0xDC,
+    0x40, 0x54, 0x6B, 0x32, 0x42, 0x96, 0xEE, 0x02,
+    0xCF, 0x53, 0xDF, 0x08, 0x78, 0x4F, 0x31, 0x4D
+  },
+  {
+    0x4D, 0x2C, 0xAC, 0x68, 0x3D, 0x5F, 0x13, 0x8B,
+    0x93, 0x07, 0x1B, 0xA4, 0x9F, 0xD7, 0xA9, 0xB3,
+    0xD0, 0x11, 0x0B, 0x7E, 0x92, 0xC7, 0x53, 0x28,
+    0xEC, 0x41, 0xA0, 0x7F, 0xDE, 0x42, 0xE4, 0xE7
+  },
+  {
+    0x0F, 0xFF, 0xD4, 0x6D, 0x27, 0xDE, 0xCC, 0xCD,
+    0x37, 0x8E, 0xED, 0x58, 0x86, 0x96, 0xC6, 0x71,
+    0x03, 0xEF, 0x12, 0x58, 0x21, 0x3C, 0x9E, 0x53,
+    0x07, 0x59, 0x07, 0x3F, 0xCE, 0xFE, 0xF6, 0x46
+  },
+  {
+    0x3E, 0xF3, 0x94, 0xBF, 0xC1, 0x50, 0xEF, 0x6F,
+    0x7D, 0x4F, 0x9C, 0xCD, 0xE0, 0x8E, 0xD7, 0xD7,
+    0x6A, 0x91, 0x6C, 0xB4, 0x0B, 0x3E, 0xF3, 0x43,
+    0xCD, 0x94, 0x08, 0x8A, 0x26, 0xEA, 0xE4, 0x38
+  },
+  {
+    0xAF, 0xF3, 0xB0, 0x99, 0x00, 0xE0, 0x65, 0x6C,
+    0x61, 0xFC, 0x2E, 0xD5, 0xC6, 0x28, 0xB5, 0x52,
+    0xE2, 0x3E, 0x20, 0x40, 0xC7, 0x5A, 0x92, 0xA9,
+    0x0F, 0xD0, 0x61, 0x67, 0xB3, 0x75, 0x05, 0xDC
+  },
+  {
+    0x29, 0x05, 0x6F, 0xE4, 0x0E, 0xD4, 0x4E, 0xF1,
+    0x88, 0x30, 0xCC, 0xA6, 0x77, 0x6D, 0x79, 0x55,
+    0xD2, 0xDE, 0xCE, 0x58, 0x40, 0x72, 0x98, 0x47,
+    0xBC, 0xA6, 0x2D, 0x69, 0xD7, 0x91, 0xF6, 0xBF
+  },
+  {
+    0x08, 0xC9, 0xE7, 0x2E, 0x65, 0x85, 0x28, 0x39,
+    0x6A, 0xAA, 0x0E, 0x2B, 0x4D, 0x98, 0x16, 0x73,
+    0xDA, 0x4E, 0x3D, 0xFA, 0xDC, 0x0C, 0x5F, 0x4F,
+    0xEC, 0x92, 0xFC, 0xE6, 0x3A, 0xF2, 0xCA, 0x47
+  },
+  {
+    0xC0, 0x89, 0x67, 0x7C, 0xCB, 0xB9, 0x0F, 0x35,
+    0xFD, 0xF0, 0x58, 0x78, 0xDB, 0x07, 0xC5, 0x9B,
+    0xB9, 0x44, 0xB6, 0xD0, 0x39, 0x94, 0x0E, 0xD9,
+    0xED, 0x95, 0x41, 0xE7, 0x99, 0xE7, 0x88, 0x8F
+  },
+  {
+    0x9A, 0xA7, 0xFC, 0x75, 0xBE, 0xD3, 0x71, 0xDA,
+    0x85, 0xFC, 0x63, 0xF0, 0x73, 0xAD, 0xB9, 0xEF,
+    0x49, 0x37, 0xD3, 0x8D, 0xEE, 0xF8, 0x07, 0x32,
+    0x3D, 0x7C, 0x71, 0xF7, 0xA4, 0x82, 0x33, 0x3F
+  },
+  {
+    0x7B, 0x10, 0xC0, 0x50, 0xCE, 0x05, 0x2E, 0x1D,
+    0x81, 0x45, 0x8C, 0x13, 0x00, 0x0F, 0x90, 0x6E,
+    0x72, 0x16, 0xCB, 0x24, 0x0F, 0x94, 0xF5, 0x36,
+    0x0E, 0xC5, 0xB2, 0x1F, 0x6C, 0xE1, 0x6B, 0x65
+  },
+  {
+    0x6E, 0x91, 0xA3, 0x36, 0xD5, 0x69, 0x77, 0x64,
+    0xF7, 0x3C, 0x0D, 0xFD, 0xAE, 0x12, 0x80, 0x22,
+    0x76, 0x77, 0x97, 0x02, 0x97, 0xD1, 0x75, 0xE9,
+    0x16, 0xDA, 0xB6, 0xD3, 0x17, 0xEF, 0xF9, 0x16
+  },
+  {
+    0xFC, 0xE3, 0xE9, 0xA9, 0x73, 0x92, 0x6F, 0xAD,
+    0x84, 0x22, 0x10, 0x00, 0x3D, 0x77, 0x41, 0x7C,
+    0x93, 0xC8, 0xA3, 0xBE, 0xF2, 0xE3, 0x51, 0xDE,
+    0x0B, 0xDB, 0xF0, 0x2A, 0xBD, 0x44, 0xBA, 0x1C
+  },
+  {
+    0xB4, 0x6E, 0x09, 0xB8, 0x56, 0x71, 0x44, 0x45,
+    0x10, 0x84, 0x3F, 0x40, 0xB8, 0x78, 0x0F, 0x20,
+    0x35, 0xE6, 0xBB, 0xD3, 0x88, 0xBD, 0x1A, 0x69,
+    0xAA, 0x89, 0x47, 0xF0, 0xF5, 0x89, 0xC9, 0x3C
+  },
+  {
+    0x7C, 0x99, 0x41, 0x09, 0x82, 0x65, 0xC2, 0x54,
+    0x84, 0x24, 0xBB, 0xAE, 0x13, 0x29, 0xFC, 0x8D,
+    0xAA, 0x0D, 0xF4, 0x69, 0x77, 0xFE, 0x96, 0x97,
+    0x90, 0x41, 0x6D, 0xFC, 0xF7, 0x5A, 0xD6, 0x48
+  },
+  {
+    0x77, 0xCF, 0xAD, 0xD2, 0x3E, 0xFF, 0x6B, 0xC6,
+    0x05, 0x44, 0xED, 0x60, 0x13, 0x03, 0xF0, 0x88,
+    0x31, 0xAC, 0x05, 0x67, 0xB4, 0x22, 0x5E, 0xC8,
+    0x2B, 0x54, 0xA3, 0x95, 0x03, 0xC6, 0x59, 0xE0
+  },
+  {
+    0x22, 0x8F, 0xEE, 0xFF, 0x2B, 0x9D, 0xF4, 0x08,
+    0xFB, 0xD6, 0x43, 0x92, 0x1D, 0x25, 0x07, 0x2D,
+    0xE2, 0xFE, 0xFD, 0x64, 0xAC, 0x6D, 0x84, 0x53,
+    0xA8, 0xFE, 0xE7, 0xAA, 0x72, 0x8D, 0xF0, 0x78
+  },
+  {
+    0x85, 0xB1, 0xC7, 0xB4, 0xB0, 0xCB, 0xD6, 0x98,
+    0x9E, 0xFB, 0xB2, 0xDA, 0x83, 0x89, 0x2F, 0x8F,
+    0x75, 0xFA, 0x8F, 0x4F, 0xE2, 0xE1, 0xB9, 0x30,
+    0x4B, 0x31, 0x64, 0xEA, 0x77, 0xF2, 0xF4, 0x1F
+  },
+  {
+    0xDA, 0x49, 0x98, 0x64, 0x1E, 0x9A, 0xDD, 0xFA,
+    0xD8, 0xDA, 0x43, 0x24, 0x72, 0xBB, 0x86, 0x5F,
+    0x38, 0x71, 0xAA, 0x92, 0x82, 0xC5, 0xFD, 0x70,
+    0x72, 0x9B, 0x78, 0xEE, 0x5B, 0x2D, 0xDD, 0x58
+  },
+  {
+    0xA0, 0x51, 0x46, 0x89, 0xCC, 0x2C, 0x7D, 0x33,
+    0x5E, 0xED, 0x08, 0x3B, 0x47, 0xCC, 0x47, 0x9A,
+    0x69, 0x52, 0x20, 0x6B, 0x8D, 0xEE, 0x58, 0x3B,
+    0x27, 0x70, 0x42, 0xDB, 0xAB, 0x7A, 0x72, 0xAF
+  },
+  {
+    0xEE, 0xBF, 0x1D, 0xA2, 0xD7, 0x46, 0xFE, 0xD6,
+    0x12, 0xEB, 0xD1, 0xCD, 0x5D, 0xE2, 0x52, 0xDF,
+    0x44, 0xF1, 0x8E, 0x98, 0xDF, 0x86, 0x62, 0x90,
+    0xA6, 0xBB, 0xD4, 0xFA, 0x90, 0xB3, 0xEA, 0x06
+  },
+  {
+    0xA6, 0x74, 0x6A, 0x3B, 0xD9, 0xE9, 0xD6, 0xB3,
+    0x85, 0xEE, 0xF1, 0xFD, 0x8F, 0x62, 0x49, 0x18,
+    0x3A, 0xC6, 0x6B, 0x0A, 0x7B, 0x68, 0x17, 0xB0,
+    0xEE, 0x00, 0xD2, 0xA5, 0xB8, 0xED, 0xB0, 0xC1
+  },
+  {
+    0x42, 0x87, 0xC4, 0x7B, 0xA3, 0x75, 0xBC, 0x3C,
+    0x2C, 0xF7, 0x1C, 0xA5, 0x3B, 0x8B, 0x76, 0x2B,
+    0x45, 0x58, 0x5D, 0x9E, 0x8E, 0xE9, 0x69, 0x7E,
+    0x1D, 0xD1, 0xB9, 0x27, 0x88, 0x05, 0x01, 0x11
+  },
+  {
+    0xE6, 0x51, 0x12, 0x17, 0x67, 0xE9, 0xF2, 0x99,
+    0x14, 0x62, 0xB6, 0xF0, 0x6F, 0x10, 0x6F, 0x19,
+    0xE5, 0x2D, 0x83, 0x50, 0x02, 0x73, 0xF2, 0x4A,
+    0xDE, 0xB7, 0x3B, 0xC7, 0x23, 0x15, 0x42, 0x45
+  },
+  {
+    0xCF, 0xD8, 0x41, 0xCB, 0x95, 0xF8, 0x4B, 0x93,
+    0x2D, 0x25, 0x44, 0xDD, 0x57, 0x05, 0x8A, 0xC7,
+    0xDF, 0xF6, 0xC0, 0x3D, 0xB1, 0xCE, 0x0F, 0x07,
+    0x69, 0xDB, 0x5F, 0x15, 0xD9, 0xC2, 0x99, 0x13
+  },
+  {
+    0xBD, 0x88, 0x44, 0x67, 0xB7, 0xC1, 0x69, 0xBE,
+    0x49, 0xCD, 0xF8, 0x29, 0x07, 0xF4, 0x6D, 0xDC,
+    0x25, 0xC9, 0xBF, 0x36, 0xCF, 0x49, 0x5E, 0xEA,
+    0x85, 0x64, 0x39, 0xE1, 0x1A, 0x24, 0x8B, 0x4D
+  },
+  {
+    0x85, 0xD9, 0xDE, 0x2D, 0xA9, 0xC9, 0x35, 0x0A,
+    0x6B, 0x6C, 0x71, 0x21, 0x60, 0x14, 0x2A, 0xFC,
+    0xFA, 0x6F, 0x2D, 0x30, 0x72, 0xC1, 0x6D, 0xC0,
+    0xFD, 0xD8, 0xD2, 0xB4, 0x72, 0x18, 0xB4, 0x81
+  },
+  {
+    0x67, 0xC5, 0x5B, 0xD8, 0xE5, 0xC2, 0x8E, 0xF9,
+    0x02, 0x4C, 0xD9, 0xE6, 0x8C, 0xE1, 0x08, 0x32,
+    0x8F, 0xAE, 0xA6, 0xB1, 0x9A, 0x9F, 0x4F, 0x0D,
+    0x1C, 0x3A, 0xFC, 0x78, 0x9F, 0x29, 0xFE, 0x53
+  },
+  {
+    0x11, 0x0D, 0x19, 0x57, 0x21, 0x06, 0x5E, 0xBF,
+    0x33, 0xAF, 0xAC, 0x4C, 0x13, 0xDC, 0xF9, 0x22,
+    0xC1, 0x3B, 0x3F, 0x2B, 0xB2, 0x16, 0xAC, 0xDA,
+    0xB6, 0xD1, 0xB3, 0x44, 0xC8, 0x53, 0x41, 0xE2
+  },
+  {
+    0x5C, 0x16, 0x1B, 0xA7, 0x15, 0x66, 0xC6, 0xA0,
+    0x56, 0x45, 0xDD, 0x8E, 0x58, 0x9A, 0x53, 0xCC,
+    0x51, 0xCA, 0xCB, 0x0E, 0xA8, 0xB0, 0x6A, 0xED,
+    0xB7, 0xA4, 0xCD, 0x1A, 0x91, 0xF6, 0x49, 0x41
+  },
+  {
+    0xF4, 0xE3, 0x36, 0xD3, 0xBF, 0x50, 0xB3, 0x5A,
+    0x68, 0xA8, 0xAE, 0xE9, 0xED, 0x07, 0x81, 0x4E,
+    0xA0, 0x9D, 0x6D, 0x5B, 0x44, 0x57, 0xBD, 0xF2,
+    0x35, 0x5F, 0xA7, 0x8F, 0x18, 0xA3, 0xD3, 0xE7
+  },
+  {
+    0xAD, 0x40, 0xCA, 0xE2, 0xD4, 0x21, 0xA0, 0xD7,
+    0x3C, 0xED, 0x82, 0x36, 0xA7, 0x41, 0x16, 0xEA,
+    0xA1, 0xF7, 0x53, 0x29, 0xAA, 0x79, 0x89, 0xBC,
+    0x73, 0xBE, 0x80, 0xBD, 0x36, 0xDB, 0xFE, 0x57
+  },
+  {
+    0xC6, 0x7C, 0x6C, 0xA7, 0xC5, 0x7E, 0x77, 0x2E,
+    0x72, 0x09, 0x11, 0xA0, 0x0A, 0x23, 0x0F, 0x04,
+    0x4A, 0x6E, 0xEC, 0x27, 0xF6, 0xE8, 0xAE, 0x3D,
+    0x0F, 0xBE, 0x39, 0x71, 0xA7, 0x0F, 0xB4, 0xD9
+  },
+  {
+    0x66, 0xE6, 0x37, 0xC8, 0x06, 0xA5, 0xBE, 0xD3,
+    0x73, 0x1F, 0x61, 0xB8, 0x21, 0x9C, 0x8F, 0x19,
+    0x03, 0x3E, 0xF5, 0x51, 0xC5, 0x83, 0xD6, 0x13,
+    0xED, 0x30, 0x82, 0xBE, 0xC7, 0xB4, 0x58, 0x0B
+  },
+  {
+    0xC0, 0x01, 0x3A, 0x68, 0xE6, 0xDE, 0x15, 0x0B,
+    0x6B, 0x4F, 0x10, 0xAA, 0xFD, 0xDD, 0x4D, 0xCA,
+    0xB4, 0x02, 0xC8, 0xCA, 0xE4, 0xC9, 0xCD, 0x0B,
+    0x64, 0xD0, 0xEA, 0x5F, 0xD7, 0x07, 0x1B, 0x76
+  },
+  {
+    0xB3, 0x56, 0x1D, 0xB3, 0x8F, 0xC7, 0x09, 0xA8,
+    0xA3, 0x0D, 0x2B, 0x9E, 0x6F, 0x4E, 0x10, 0x24,
+    0x2C, 0x85, 0xAD, 0x88, 0xB7, 0x5B, 0x35, 0x02,
+    0xBD, 0xA9, 0x70, 0x9E, 0xC3, 0x3C, 0x5C, 0x0B
+  },
+  {
+    0x97, 0x78, 0xD7, 0x61, 0x41, 0xE2, 0x6C, 0xAC,
+    0x59, 0xC4, 0xD2, 0x3C, 0x5A, 0xDC, 0x6C, 0x3B,
+    0xA9, 0x3C, 0x8F, 0xFC, 0x78, 0x70, 0x4E, 0x3C,
+    0x4A, 0xF6, 0xDB, 0x9D, 0x12, 0x86, 0x7F, 0xA9
+  },
+  {
+    0x06, 0x3C, 0x0C, 0xDD, 0x72, 0x2C, 0xF0, 0x5F,
+    0x21, 0x6D, 0xEB, 0xD6, 0x72, 0x81, 0x98, 0xB0,
+    0xAE, 0xB8, 0x3A, 0x2F, 0x75, 0xB3, 0xA8, 0xB0,
+    0xCD, 0x93, 0x40, 0x54, 0xA0, 0xE9, 0xEF, 0x65
+  },
+  {
+    0x2E, 0x67, 0x31, 0xCB, 0xB5, 0xF9, 0x96, 0x49,
+    0x41, 0x0D, 0x30, 0xCA, 0xE4, 0xEB, 0x34, 0x7B,
+    0x19, 0x87, 0xC8, 0x7A, 0xF6, 0xC6, 0x1E, 0x03,
+    0x57, 0xA9, 0x9C, 0x5E, 0x45, 0x29, 0x68, 0x24
+  },
+  {
+    0xA5, 0x2E, 0x6E, 0xE5, 0x07, 0x32, 0x38, 0xD2,
+    0x11, 0x3A, 0x93, 0x5C, 0xE6, 0x8B, 0xA3, 0x3B,
+    0x04, 0x11, 0xFE, 0xF8, 0x84, 0x7A, 0x8F, 0x52,
+    0xA6, 0xA8, 0xD5, 0x6B, 0xEB, 0x49, 0x18, 0x2F
+  },
+  {
+    0xB5, 0x75, 0x7B, 0x41, 0xD2, 0xAF, 0x4D, 0xC6,
+    0xED, 0xB4, 0x8D, 0x9A, 0xE5, 0x60, 0x25, 0xD8,
+    0xBB, 0x9E, 0xD7, 0x81, 0x1D, 0xF2, 0xD0, 0xA7,
+    0xB2, 0x38, 0xD5, 0x2F, 0x27, 0x97, 0x79, 0x0E
+  },
+  {
+    0xB2, 0x44, 0xE9, 0x30, 0x23, 0x73, 0xA4, 0xC1,
+    0xDC, 0x95, 0x49, 0x1E, 0xAB, 0x6F, 0xAF, 0xB9,
+    0x00, 0x5D, 0x34, 0x4D, 0x71, 0x50, 0x99, 0xBB,
+    0x59, 0x5B, 0xC5, 0xAD, 0xDC, 0xAB, 0x91, 0x6A
+  },
+  {
+    0x59, 0x12, 0x05, 0xAC, 0x5E, 0x11, 0x81, 0x94,
+    0xB3, 0xAC, 0xC9, 0xBB, 0xE1, 0xB6, 0x56, 0x0F,
+    0x8E, 0xF0, 0x8C, 0x81, 0x35, 0x87, 0x9D, 0x6C,
+    0x92, 0x78, 0x0A, 0x53, 0x80, 0x0C, 0x0F, 0xFF
+  },
+  {
+    0x8E, 0x6A, 0x54, 0xC9, 0xE0, 0x7D, 0x80, 0xAA,
+    0x45, 0x79, 0x0D, 0x1C, 0x5B, 0xCC, 0x16, 0xD0,
+    0xA7, 0xAF, 0x4A, 0x91, 0xB6, 0x1D, 0x28, 0x84,
+    0xF4, 0xAF, 0xF6, 0x02, 0xC0, 0x38, 0xAF, 0xE7
+  },
+  {
+    0x6A, 0xD5, 0x17, 0xDD, 0x7B, 0xE4, 0x15, 0x98,
+    0x17, 0xD3, 0xDC, 0x1C, 0x3C, 0x92, 0x35, 0x04,
+    0xA3, 0xB8, 0x5F, 0xD8, 0xE3, 0xBE, 0x40, 0x21,
+    0x32, 0xD1, 0xC7, 0x30, 0x8B, 0xDC, 0xF9, 0x20
+  },
+  {
+    0x52, 0x53, 0xB1, 0x2F, 0xAF, 0xC7, 0xB3, 0x48,
+    0x23, 0x53, 0xF2, 0x33, 0x70, 0xD0, 0x15, 0x6B,
+    0xA1, 0x1D, 0xD6, 0xC5, 0xCA, 0xB6, 0x3B, 0xD8,
+    0xE6, 0xE3, 0x5D, 0x38, 0x47, 0xAC, 0xE7, 0x27
+  },
+  {
+    0x65, 0x53, 0x07, 0x59, 0x7A, 0x22, 0xD6, 0x42,
+    0xB5, 0x9E, 0x98, 0xD5, 0x63, 0x3B, 0x4B, 0x9B,
+    0x5B, 0x4B, 0xDB, 0xED, 0xB4, 0x8F, 0xB6, 0xB4,
+    0xA6, 0x9A, 0xFF, 0x24, 0x0B, 0x30, 0x96, 0xA4
+  },
+  {
+    0x4A, 0x87, 0xAB, 0x48, 0xDD, 0x02, 0x0F, 0x28,
+    0x04, 0x2D, 0xCC, 0x00, 0x7C, 0x61, 0x87, 0x02,
+    0xC5, 0xC9, 0x42, 0x09, 0xB7, 0x3B, 0xDC, 0x66,
+    0x3B, 0x73, 0xB3, 0x53, 0xB7, 0x8B, 0xC2, 0x99
+  },
+  {
+    0xC5, 0x5E, 0x87, 0xF6, 0xAB, 0xA2, 0xF6, 0xC1,
+    0x2C, 0x59, 0x7C, 0x1F, 0x4B, 0x63, 0x72, 0x03,
+    0xCA, 0x24, 0x10, 0x69, 0x6F, 0x80, 0xAD, 0x3A,
+    0xB8, 0xF8, 0xF9, 0xA5, 0x8E, 0xA4, 0xFC, 0xE9
+  },
+  {
+    0x58, 0x76, 0xFF, 0xE6, 0xCE, 0xDC, 0xAD, 0xDD,
+    0x1D, 0xEB, 0x86, 0x0F, 0xD7, 0x15, 0x76, 0xBB,
+    0xFA, 0xA2, 0xAF, 0x50, 0x43, 0xAB, 0xD8, 0xB6,
+    0xAA, 0x7B, 0xDF, 0x88, 0x5C, 0xED, 0x03, 0x34
+  },
+  {
+    0x8C, 0x88, 0x10, 0x82, 0xDA, 0x6A, 0x80, 0x33,
+    0xE4, 0x99, 0x25, 0x29, 0x5F, 0xA0, 0x1D, 0xE5,
+    0xF6, 0xF7, 0x1E, 0x9E, 0x5E, 0x33, 0x2D, 0x9A,
+    0xDA, 0x69, 0x38, 0x30, 0x8E, 0x81, 0x12, 0x43
+  },
+  {
+    0xCF, 0x6D, 0xFD, 0x72, 0xD6, 0xE2, 0xC4, 0xCF,
+    0x6E, 0x9B, 0x78, 0x27, 0x00, 0xE7, 0x3E, 0x91,
+    0x8E, 0xC0, 0x3A, 0x8C, 0xF9, 0xBD, 0x0D, 0x58,
+    0xA0, 0x84, 0x19, 0xAD, 0xFD, 0xC9, 0x96, 0xFD
+  },
+  {
+    0x92, 0x8C, 0x9F, 0x62, 0x25, 0x31, 0x88, 0x25,
+    0x2F, 0x97, 0xF1, 0x78, 0x8C, 0x43, 0x6F, 0x5A,
+    0x49, 0x0F, 0x3A, 0x66, 0x6A, 0x3F, 0x0A, 0x9A,
+    0x68, 0xE2, 0xA8, 0xB8, 0xCF, 0xD9, 0xFF, 0xFC
+  },
+  {
+    0x2F, 0x57, 0x7F, 0xC0, 0x44, 0x30, 0x2B, 0xCB,
+    0x72, 0x6A, 0xEC, 0x27, 0xA0, 0x7C, 0x41, 0x67,
+    0x45, 0x4D, 0xA5, 0x7E, 0x0C, 0xEC, 0x32, 0xD2,
+    0x2D, 0x1F, 0x9E, 0x53, 0xBD, 0x8A, 0xBA, 0xA2
+  },
+  {
+    0x6B, 0x02, 0x44, 0x38, 0xAB, 0xEB, 0x5A, 0x93,
+    0xBF, 0xDE, 0xCD, 0x88, 0x70, 0x5B, 0x13, 0xE5,
+    0xE9, 0x6D, 0xAC, 0xD1, 0xED, 0x86, 0xE0, 0xA3,
+    0x37, 0xBB, 0xD2, 0x21, 0xE4, 0xBF, 0x3B, 0x87
+  },
+  {
+    0x84, 0x8F, 0xF8, 0xE5, 0x89, 0x41, 0x4F, 0x05,
+    0xF9, 0xAF, 0x30, 0xD2, 0xB5, 0x57, 0xE0, 0xA8,
+    0xD2, 0xF8, 0x52, 0x17, 0xA5, 0x6A, 0xCE, 0xF1,
+    0xFD, 0xF5, 0xCF, 0x08, 0x82, 0x59, 0x31, 0x24
+  },
+  {
+    0x3A, 0x4F, 0x98, 0x5F, 0x2A, 0x94, 0x5F, 0xFA,
+    0x5F, 0xFE, 0x2C, 0xC2, 0x01, 0xCD, 0x2D, 0x31,
+    0xFA, 0x2B, 0xB8, 0xD3, 0x9F, 0xF5, 0xBE, 0xA1,
+    0x75, 0xDE, 0xA3, 0xCF, 0xDE, 0xBF, 0x50, 0xAB
+  },
+  {
+    0x2E, 0x32, 0xEF, 0xB6, 0x6B, 0x49, 0x21, 0xB5,
+    0x9E, 0xFE, 0xF6, 0xD0, 0x8D, 0xBE, 0xF7, 0x19,
+    0xF0, 0xE8, 0x77, 0xC8, 0xE1, 0x10, 0xD5, 0x4C,
+    0x46, 0x26, 0x5C, 0xD8, 0x82, 0xBD, 0xAF, 0xA1
+  },
+  {
+    0x72, 0xE6, 0x1E, 0x8E, 0x30, 0x75, 0x03, 0xD8,
+    0xDE, 0x07, 0xF9, 0xF9, 0xE4, 0x68, 0x07, 0xDE,
+    0x7F, 0xC2, 0x62, 0x41, 0xF1, 0x83, 0x86, 0x51,
+    0xB1, 0x3E, 0x90, 0x21, 0x38, 0x8E, 0x36, 0xD9
+  },
+  {
+    0xC5, 0x11, 0x73, 0x33, 0x5D, 0xF7, 0xFD, 0xE5,
+    0xA5, 0x26, 0x16, 0xA3, 0x50, 0xC9, 0xF9, 0x04,
+    0x56, 0xCE, 0x65, 0xE5, 0x54, 0x6D, 0xC4, 0x94,
+    0xC8, 0x1F, 0xD7, 0xD4, 0x0F, 0x88, 0x51, 0xD6
+  },
+  {
+    0xA2, 0xDB, 0x32, 0x4D, 0xB6, 0xC5, 0x10, 0x80,
+    0x77, 0xC8, 0x42, 0x90, 0xC2, 0x0B, 0x08, 0xDD,
+    0x01, 0x19, 0xA4, 0xFC, 0xF3, 0xA4, 0xD5, 0x15,
+    0xBE, 0x3E, 0x2C, 0x19, 0x52, 0x9B, 0xE8, 0x2E
+  },
+  {
+    0x27, 0x5F, 0x08, 0x83, 0x03, 0x88, 0x4A, 0x2F,
+    0xB1, 0x4D, 0x81, 0xEC, 0x67, 0xE7, 0x6E, 0x53,
+    0xA3, 0xCA, 0xDB, 0xE2, 0x55, 0x19, 0x29, 0xB1,
+    0x00, 0x08, 0x34, 0xC5, 0x79, 0xFE, 0xEB, 0x1D
+  },
+  {
+    0xDD, 0xB5, 0xC0, 0xCF, 0x60, 0xED, 0x01, 0xF7,
+    0x15, 0x91, 0x3F, 0x7E, 0x78, 0x4F, 0x49, 0x18,
+    0x01, 0x47, 0xF4, 0xED, 0xB5, 0x4A, 0xA5, 0x6B,
+    0x6C, 0xEB, 0x8D, 0xB8, 0x20, 0xFC, 0xF7, 0x95
+  },
+  {
+    0x43, 0x2C, 0x34, 0xC9, 0x5A, 0xA8, 0xA3, 0x29,
+    0x4F, 0xAC, 0x60, 0xB1, 0xFB, 0xF2, 0x6E, 0xB1,
+    0x33, 0x2E, 0x90, 0x0D, 0x0E, 0x6E, 0xB5, 0x11,
+    0xD5, 0x72, 0x09, 0x01, 0x8F, 0x15, 0x83, 0xD6
+  },
+  {
+    0x4F, 0xEE, 0x95, 0x8A, 0x3E, 0x05, 0x22, 0x3C,
+    0x19, 0xA9, 0x63, 0xFF, 0xDE, 0x35, 0x3C, 0xCB,
+    0x6E, 0x16, 0x1D, 0x29, 0x01, 0xD6, 0xA7, 0x74,
+    0x29, 0xE4, 0x79, 0x58, 0xE1, 0x4B, 0x62, 0x78
+  },
+  {
+    0xCC, 0x75, 0x26, 0x6E, 0x63, 0x93, 0xF0, 0x00,
+    0x87, 0xBF, 0x9C, 0xB0, 0x25, 0xD1, 0xE4, 0xEC,
+    0xED, 0x3C, 0xEC, 0xDB, 0x66, 0x6B, 0x51, 0xF6,
+    0xE1, 0x7D, 0x7D, 0x26, 0x57, 0xF5, 0x5B, 0x71
+  },
+  {
+    0x48, 0x22, 0xEB, 0x7D, 0x95, 0x00, 0x50, 0xEE,
+    0xED, 0x1E, 0xC3, 0xAA, 0xE9, 0xA3, 0x36, 0xA6,
+    0x7E, 0x09, 0xB5, 0x09, 0x73, 0x27, 0xA0, 0x39,
+    0x32, 0xEE, 0x27, 0x36, 0x30, 0x1D, 0x09, 0x9D
+  },
+  {
+    0x39, 0xEF, 0x98, 0xC6, 0x65, 0x4D, 0x7C, 0x88,
+    0xF6, 0x05, 0xBC, 0x6C, 0xDD, 0x55, 0x24, 0x7E,
+    0x15, 0x56, 0xF3, 0x88, 0xC7, 0x5C, 0x27, 0x16,
+    0xF0, 0xF9, 0x5F, 0x41, 0x0F, 0x19, 0x40, 0x3C
+  },
+  {
+    0x67, 0xB8, 0xB6, 0xAC, 0xF5, 0xBD, 0xB5, 0xEF,
+    0xB7, 0xD5, 0x43, 0x7F, 0x87, 0xD7, 0x06, 0x23,
+    0x8F, 0xE5, 0x44, 0x60, 0x3D, 0x02, 0x73, 0xD4,
+    0xD9, 0x6F, 0x01, 0x22, 0x76, 0xF8, 0xDB, 0xD9
+  },
+  {
+    0x92, 0xE2, 0xE4, 0xA8, 0x83, 0x68, 0x12, 0xB3,
+    0xBA, 0x4C, 0x6B, 0x23, 0x2A, 0x2B, 0xD6, 0x85,
+    0xF3, 0x55, 0x3F, 0xFA, 0xEE, 0x8D, 0x47, 0x52,
+    0x11, 0x40, 0x53, 0xE4, 0x3F, 0x59, 0xE2, 0xB2
+  },
+  {
+    0x65, 0xBF, 0xEA, 0xB4, 0xF2, 0x40, 0x35, 0x4A,
+    0x5F, 0xEC, 0x25, 0xD5, 0xD0, 0xDE, 0xEE, 0x38,
+    0x05, 0x8A, 0xA1, 0x10, 0xDD, 0x97, 0x78, 0xDF,
+    0xF8, 0x3F, 0xD7, 0x41, 0xD8, 0x43, 0x4A, 0xA1
+  },
+  {
+    0x5A, 0x4B, 0x03, 0x6F, 0x30, 0x00, 0xD8, 0xB7,
+    0x13, 0xAC, 0xE3, 0x2B, 0xE4, 0xFC, 0x7C, 0x6D,
+    0x22, 0x9D, 0x97, 0x0C, 0xA1, 0xC8, 0xB8, 0x3F,
+    0x62, 0x7D, 0xB3, 0xE0, 0x48, 0x88, 0x0E, 0xD6
+  },
+  {
+    0x27, 0x52, 0xB8, 0xA1, 0xB1, 0x73, 0x32, 0x57,
+    0x6A, 0x2E, 0x3F, 0x3B, 0xE8, 0xB9, 0xB7, 0xAA,
+    0x67, 0x01, 0x56, 0xA7, 0x1F, 0xDF, 0xA3, 0x57,
+    0xE8, 0x8A, 0xAF, 0x1C, 0x53, 0x2B, 0x3C, 0x47
+  },
+  {
+    0xDF, 0x5F, 0x63, 0xCE, 0x22, 0xFB, 0x2C, 0xD8,
+    0xF5, 0x78, 0xB3, 0x90, 0x7A, 0x89, 0x8C, 0x0A,
+    0x86, 0x6A, 0xFF, 0x9A, 0x42, 0x61, 0x45, 0x67,
+    0x38, 0x29, 0x6E, 0x71, 0x39, 0x00, 0x2E, 0x57
+  },
+  {
+    0x65, 0x71, 0x5D, 0xAB, 0xFE, 0x96, 0x24, 0xA9,
+    0xA2, 0x1A, 0x02, 0x0B, 0x24, 0x08, 0xAA, 0x91,
+    0x4A, 0x64, 0x9C, 0xE1, 0x79, 0x0A, 0x51, 0x63,
+    0x49, 0x50, 0x28, 0x8A, 0x06, 0xA0, 0x14, 0x26
+  },
+  {
+    0x8C, 0x0D, 0x62, 0xC6, 0x77, 0xD3, 0x55, 0xB6,
+    0x8E, 0x69, 0xE4, 0xAD, 0x6C, 0x90, 0x4A, 0xDE,
+    0x78, 0x62, 0x77, 0x8F, 0x1F, 0xEA, 0x37, 0xA3,
+    0x58, 0xCE, 0x05, 0xAF, 0xBC, 0xC6, 0x23, 0xDD
+  },
+  {
+    0x71, 0x94, 0x6F, 0x78, 0xDC, 0x72, 0x97, 0x42,
+    0x37, 0xA9, 0xE1, 0x98, 0xF7, 0xD6, 0x5D, 0x57,
+    0x32, 0x08, 0xF2, 0x05, 0x24, 0x63, 0x7A, 0xA6,
+    0x1A, 0x75, 0x21, 0x90, 0x8F, 0x26, 0x28, 0x1F
+  },
+  {
+    0x4F, 0x8D, 0x56, 0xBE, 0x06, 0x6E, 0x34, 0x2D,
+    0xD7, 0xEC, 0x62, 0x44, 0x19, 0x76, 0x36, 0xBB,
+    0x55, 0x66, 0xBE, 0xA0, 0x7F, 0x4F, 0xE6, 0x25,
+    0x23, 0x8A, 0x10, 0xF1, 0xE8, 0x92, 0x9E, 0x70
+  },
+  {
+    0x3C, 0xA7, 0xA1, 0xC0, 0x21, 0x0B, 0x82, 0x51,
+    0xD3, 0xFE, 0x7A, 0xAD, 0xE7, 0x94, 0xDA, 0xC9,
+    0x88, 0xBA, 0xBB, 0x79, 0x22, 0x66, 0xFD, 0x6C,
+    0x50, 0x3C, 0x88, 0x2A, 0x79, 0x81, 0x64, 0x3D
+  },
+  {
+    0xAE, 0xC9, 0x64, 0xD1, 0x7E, 0x59, 0xF5, 0x4F,
+    0xE6, 0x66, 0x6F, 0x8B, 0xF9, 0x14, 0xEC, 0x71,
+    0xF0, 0x4F, 0xC8, 0x22, 0xBA, 0x1E, 0xA4, 0xAC,
+    0xD4, 0x11, 0x70, 0xDF, 0xE2, 0x31, 0x8C, 0xF7
+  },
+  {
+    0xDB, 0x4C, 0x5D, 0xD3, 0xB6, 0xBF, 0x6F, 0xA7,
+    0xE4, 0x89, 0xF3, 0x4A, 0x5B, 0xB5, 0x2B, 0x1A,
+    0x1A, 0xBB, 0x92, 0xC9, 0xC8, 0x32, 0x16, 0x2F,
+    0xBD, 0xFF, 0xA9, 0xD4, 0xDB, 0x9B, 0x8D, 0x84
+  },
+  {
+    0xBB, 0x46, 0xB7, 0x86, 0x6B, 0xBF, 0x4D, 0x82,
+    0xEB, 0x9F, 0x96, 0x54, 0x41, 0x15, 0xF0, 0xA2,
+    0xD3, 0x52, 0xC7, 0x3D, 0x12, 0xEF, 0x3A, 0x0F,
+    0xF7, 0x7C, 0x02, 0xC7, 0x06, 0xEC, 0x6A, 0x72
+  },
+  {
+    0x94, 0x30, 0xF1, 0xBE, 0x33, 0x13, 0xC0, 0xF5,
+    0x51, 0x83, 0x34, 0xF5, 0x4E, 0xE6, 0x3A, 0xEF,
+    0x02, 0xA6, 0xFB, 0xF9, 0xCE, 0xFF, 0x5B, 0xAE,
+    0x18, 0x9F, 0x05, 0x29, 0x4C, 0x59, 0x62, 0x83
+  },
+  {
+    0x71, 0xF2, 0xE3, 0x9A, 0x89, 0xB8, 0x82, 0x5E,
+    0x76, 0xC1, 0x76, 0x37, 0x31, 0x0A, 0x9C, 0x32,
+    0x41, 0x3B, 0xFE, 0x40, 0x43, 0xD4, 0xEB, 0x68,
+    0x39, 0xC2, 0x93, 0x5F, 0x1A, 0x8A, 0xBE, 0x48
+  },
+  {
+    0x7B, 0x8A, 0xF8, 0x71, 0xED, 0xE0, 0x05, 0xA8,
+    0x8C, 0x3F, 0x30, 0xFD, 0xBA, 0x38, 0xF8, 0x5F,
+    0x9B, 0xAC, 0x51, 0x8B, 0x6D, 0x70, 0xFB, 0x06,
+    0x8F, 0x02, 0x88, 0x93, 0x56, 0x54, 0x00, 0x96
+  },
+  {
+    0x21, 0x8D, 0xBB, 0xC0, 0x82, 0x57, 0x66, 0x07,
+    0x16, 0xF5, 0xBD, 0xC7, 0xB7, 0x8F, 0x0E, 0xED,
+    0xD7, 0x9B, 0xB4, 0x38, 0xF5, 0xC4, 0xE2, 0xDB,
+    0x85, 0x26, 0x41, 0xA3, 0x5E, 0xB8, 0x2B, 0xE8
+  },
+  {
+    0x2C, 0xA9, 0xB2, 0xA7, 0xE2, 0x2D, 0x47, 0x4F,
+    0xFC, 0xE6, 0x23, 0x73, 0x6F, 0x57, 0xFF, 0xA1,
+    0x8F, 0x01, 0xAE, 0x32, 0xF4, 0x72, 0xE2, 0xD6,
+    0x22, 0x73, 0xAD, 0xCE, 0x79, 0x1F, 0x27, 0x16
+  },
+  {
+    0x11, 0x9B, 0xF6, 0xE2, 0x2A, 0x6D, 0x5F, 0x40,
+    0x01, 0x46, 0xF0, 0xC6, 0x3D, 0xAA, 0xD3, 0xF3,
+    0x09, 0x23, 0xCA, 0x32, 0x0A, 0xC7, 0x2F, 0x9F,
+    0xFE, 0x7B, 0xF8, 0xB6, 0xE1, 0xBB, 0xFF, 0xF7
+  },
+  {
+    0x50, 0x29, 0xD4, 0xB9, 0x81, 0xEB, 0x72, 0xBA,
+    0x41, 0x98, 0xD3, 0x00, 0xBD, 0x74, 0x74, 0xD8,
+    0x62, 0x44, 0xCC, 0xCF, 0x42, 0xB4, 0xF1, 0xE8,
+    0x8F, 0xED, 0xBD, 0x77, 0x45, 0x31, 0xA8, 0x88
+  },
+  {
+    0xC9, 0xD2, 0x12, 0x76, 0x1B, 0xF5, 0x73, 0x60,
+    0xD4, 0x82, 0xE0, 0x80, 0xC4, 0x77, 0x02, 0x48,
+    0xF1, 0xB6, 0xFB, 0x34, 0xF2, 0x3F, 0xD2, 0xBA,
+    0xF1, 0xEB, 0xDF, 0x17, 0x8D, 0x28, 0xFC, 0x35
+  },
+  {
+    0xB4, 0x7B, 0xAC, 0xE2, 0x37, 0xE3, 0x83, 0x30,
+    0x92, 0x92, 0x8B, 0x7E, 0x9B, 0xD5, 0x3C, 0x0E,
+    0x30, 0xD0, 0x54, 0x6C, 0x44, 0x3F, 0xFA, 0xCB,
+    0xE2, 0x60, 0x3E, 0xC9, 0x08, 0xBF, 0x12, 0x75
+  },
+  {
+    0xDA, 0x76, 0x04, 0x6E, 0x62, 0xDE, 0x99, 0x5B,
+    0x4E, 0x57, 0xC7, 0x38, 0x86, 0xAE, 0xEE, 0xA8,
+    0x0A, 0x47, 0x55, 0xB1, 0x48, 0x2A, 0x07, 0x19,
+    0xCE, 0xE5, 0x9B, 0x69, 0xFD, 0x22, 0xA8, 0xA0
+  },
+  {
+    0x58, 0x0E, 0xBC, 0x2B, 0x13, 0x98, 0xB6, 0xC5,
+    0xAA, 0xCC, 0x69, 0x39, 0x4E, 0x9A, 0x5D, 0x33,
+    0xEC, 0x07, 0xCB, 0xC7, 0x9E, 0x01, 0x2C, 0x8E,
+    0x8E, 0x42, 0x6F, 0x54, 0x5F, 0x9B, 0xE2, 0x17
+  },
+  {
+    0xC3, 0x0A, 0x46, 0x4D, 0x70, 0xA7, 0xEE, 0xA0,
+    0x86, 0xCA, 0xA6, 0xB6, 0x0A, 0xC0, 0xB1, 0x12,
+    0xFF, 0xE2, 0x69, 0xA2, 0x1A, 0xDA, 0x66, 0xD1,
+    0x5D, 0xBA, 0xC5, 0xE1, 0xA9, 0x96, 0x2C, 0xEE
+  },
+  {
+    0x6D, 0x23, 0xF2, 0x36, 0x35, 0xD5, 0xDE, 0xF1,
+    0x38, 0x74, 0xA2, 0x8A, 0x85, 0x95, 0xA6, 0xFA,
+    0xE0, 0x3A, 0xB3, 0x39, 0xEC, 0xFE, 0x81, 0x34,
+    0xFC, 0xE0, 0xAA, 0xFF, 0x45, 0x87, 0x4D, 0xDE
+  },
+  {
+    0xCA, 0xD4, 0xDF, 0x6A, 0x41, 0x33, 0x33, 0x2A,
+    0x54, 0xA8, 0xA0, 0x45, 0x31, 0x73, 0xD8, 0x20,
+    0x05, 0xA2, 0xFB, 0x34, 0xB6, 0xE1, 0x8C, 0x89,
+    0x15, 0x9E, 0x44, 0x3A, 0xB6, 0x50, 0x9E, 0x59
+  },
+  {
+    0x1A, 0x45, 0x27, 0xC9, 0x9B, 0x27, 0xC3, 0x26,
+    0x80, 0x1B, 0x34, 0x1A, 0x9E, 0xA0, 0x2C, 0xC3,
+    0x74, 0x8B, 0x53, 0x80, 0x81, 0x96, 0x2A, 0xA4,
+    0x4B, 0x14, 0xD7, 0x34, 0x9F, 0x57, 0x9A, 0xBB
+  },
+  {
+    0x01, 0x34, 0xCE, 0xA7, 0x2E, 0xF7, 0xE4, 0x97,
+    0x46, 0x6D, 0x0B, 0x93, 0x55, 0xB1, 0x65, 0x5F,
+    0x69, 0x9F, 0x28, 0x56, 0x51, 0x67, 0x52, 0xE2,
+    0x13, 0x32, 0xD7, 0xFC, 0x76, 0x98, 0xD6, 0x47
+  },
+  {
+    0xF9, 0xB4, 0xB4, 0xB9, 0xCA, 0x8B, 0xF9, 0x7F,
+    0x1C, 0xA6, 0x83, 0x2C, 0x56, 0xD1, 0xD1, 0xAE,
+    0x2C, 0x6C, 0x9A, 0x05, 0x3B, 0xE4, 0x19, 0xC5,
+    0xDC, 0x00, 0x55, 0x3B, 0x29, 0x93, 0xE8, 0x31
+  },
+  {
+    0xB3, 0x76, 0x6E, 0x71, 0x27, 0x22, 0x57, 0xC2,
+    0x86, 0x35, 0x1C, 0xB9, 0xB6, 0x5F, 0xD4, 0xD1,
+    0xB8, 0xA1, 0xDA, 0x42, 0x05, 0x71, 0x42, 0x24,
+    0x77, 0x7E, 0x3A, 0x04, 0x9D, 0x77, 0xFD, 0xD7
+  },
+  {
+    0x89, 0x31, 0x91, 0x95, 0xA2, 0xA5, 0x5D, 0xC4,
+    0xB7, 0x02, 0x00, 0x41, 0xE5, 0x3A, 0xD9, 0x9F,
+    0x2B, 0xDB, 0xE6, 0xBF, 0xA7, 0xDA, 0xF0, 0xD8,
+    0x3A, 0x15, 0xBB, 0x1C, 0xFA, 0x6B, 0x6B, 0x51
+  },
+  {
+    0xF3, 0x1E, 0xDC, 0xB8, 0x8A, 0x89, 0x08, 0x75,
+    0x87, 0xD9, 0x11, 0x13, 0x83, 0x6F, 0x7B, 0xBB,
+    0xC4, 0x4B, 0x6E, 0x27, 0xF4, 0x21, 0x7F, 0xEB,
+    0x8C, 0xE7, 0x9D, 0x6F, 0xD9, 0xAA, 0x9F, 0x87
+  },
+  {
+    0x9D, 0x90, 0xC7, 0xB8, 0x2C, 0xA7, 0x10, 0x17,
+    0x3C, 0xC1, 0x19, 0x81, 0x43, 0xD1, 0x5F, 0xEC,
+    0x73, 0x4D, 0xBB, 0xE8, 0x72, 0xC1, 0x59, 0x1D,
+    0xAF, 0x05, 0xB9, 0x22, 0x3B, 0xFD, 0x35, 0x62
+  },
+  {
+    0xC2, 0xB9, 0x42, 0xAC, 0x3F, 0x0A, 0xC0, 0xDA,
+    0x97, 0x23, 0xC8, 0xC9, 0x66, 0x7D, 0xD4, 0x8B,
+    0x02, 0x12, 0xAD, 0xC4, 0x65, 0x2D, 0x56, 0x96,
+    0x6D, 0xB1, 0x5C, 0x5F, 0x26, 0x47, 0xA0, 0xF0
+  },
+  {
+    0x4A, 0x42, 0x9A, 0xCA, 0xB7, 0x0A, 0xFB, 0x95,
+    0x6F, 0xD5, 0xB1, 0xDE, 0x0F, 0x07, 0x52, 0x3F,
+    0x9F, 0x82, 0x5E, 0x50, 0x35, 0x84, 0xEC, 0x87,
+    0xDA, 0xEC, 0xA5, 0x3C, 0x36, 0x76, 0xB1, 0xFE
+  },
+  {
+    0xBB, 0xBE, 0x62, 0x61, 0xEB, 0x27, 0xB2, 0x0F,
+    0xF1, 0xA9, 0xAC, 0x84, 0xFF, 0xF6, 0xE3, 0x61,
+    0xCB, 0xAC, 0x72, 0x33, 0xE6, 0xBF, 0x80, 0x51,
+    0x79, 0xFA, 0xE5, 0xA6, 0x5B, 0xAB, 0x84, 0x25
+  },
+  {
+    0x1E, 0x0A, 0x8E, 0x17, 0xAD, 0xA3, 0x0B, 0x7C,
+    0x8F, 0x73, 0x4D, 0xC6, 0x94, 0x9A, 0x39, 0x66,
+    0x6B, 0xF5, 0x48, 0x82, 0xF8, 0xDA, 0xBF, 0x8B,
+    0xCA, 0x38, 0xA6, 0x86, 0x78, 0x74, 0xD9, 0x4D
+  },
+  {
+    0xC4, 0x65, 0x59, 0x6E, 0x2D, 0x4C, 0xB8, 0x00,
+    0xCC, 0xD8, 0x08, 0x81, 0x35, 0x13, 0x10, 0xA9,
+    0xB0, 0x70, 0x47, 0x4B, 0x11, 0xEB, 0xFC, 0xF7,
+    0xB0, 0xEE, 0x2E, 0xA1, 0x05, 0x16, 0x33, 0x0F
+  },
+  {
+    0x79, 0xCB, 0xB4, 0x4F, 0x5C, 0xF2, 0x66, 0xA9,
+    0xDA, 0x44, 0xF7, 0x1F, 0x38, 0xD5, 0x29, 0xB9,
+    0xA0, 0xBE, 0x7E, 0x3F, 0x54, 0x6B, 0x1D, 0x61,
+    0xCE, 0x59, 0x0F, 0xE0, 0x15, 0x79, 0xD5, 0x08
+  },
+  {
+    0xDE, 0xC1, 0x6D, 0xD7, 0x4E, 0xE3, 0xB4, 0x5F,
+    0x57, 0x6A, 0x09, 0x6D, 0x11, 0xE4, 0x52, 0xE5,
+    0xB2, 0x88, 0xA1, 0xC1, 0x1F, 0x9C, 0x56, 0x8B,
+    0x8D, 0xE2, 0xAF, 0x48, 0xF8, 0xCE, 0xBE, 0xCC
+  },
+  {
+    0x84, 0xA1, 0xFC, 0xD4, 0xCE, 0xE5, 0xF9, 0xE9,
+    0x30, 0x1F, 0x53, 0xEC, 0x5A, 0x69, 0xF2, 0xF2,
+    0x2B, 0xAA, 0xE3, 0x3E, 0x58, 0x6A, 0x69, 0x04,
+    0x50, 0x48, 0x57, 0x70, 0x60, 0xFC, 0x8C, 0x65
+  },
+  {
+    0xFF, 0xF2, 0x44, 0xDB, 0xA3, 0xE9, 0x9A, 0xDC,
+    0x0C, 0xD5, 0x73, 0xF5, 0x59, 0x3B, 0xA2, 0x08,
+    0x46, 0x06, 0xDD, 0x39, 0xD6, 0x90, 0x0A, 0x54,
+    0x08, 0xB8, 0x9F, 0xC0, 0x7F, 0x35, 0x30, 0xAC
+  },
+  {
+    0x46, 0x2E, 0xEC, 0xE0, 0x59, 0xBC, 0x71, 0xCA,
+    0xC0, 0x22, 0x6C, 0x22, 0xC8, 0x17, 0x72, 0xEE,
+    0x38, 0xBD, 0x50, 0x6C, 0xCC, 0xBC, 0xE7, 0xEA,
+    0x4D, 0x24, 0x98, 0x04, 0x81, 0xD8, 0xB3, 0x50
+  },
+  {
+    0x59, 0xE2, 0x88, 0x23, 0x79, 0xA0, 0x5A, 0x36,
+    0x8D, 0x04, 0x3D, 0x2E, 0x4F, 0xD4, 0xC4, 0x30,
+    0x49, 0x40, 0xC6, 0xF0, 0xB4, 0x79, 0xE4, 0xD5,
+    0x85, 0xB3, 0x0D, 0xDD, 0x6A, 0xC7, 0x54, 0x3A
+  },
+  {
+    0x30, 0x98, 0xA7, 0xEC, 0x85, 0xB3, 0xD0, 0x31,
+    0x97, 0x2D, 0xBF, 0x19, 0x51, 0x29, 0xC1, 0xCF,
+    0x99, 0xBA, 0x98, 0x73, 0xAE, 0x25, 0x13, 0xF3,
+    0x50, 0xD5, 0x5A, 0xCE, 0x68, 0xF1, 0xE9, 0x1B
+  },
+  {
+    0x18, 0xB2, 0x3B, 0x36, 0x3B, 0xE1, 0x81, 0x94,
+    0x36, 0xCC, 0x9F, 0x06, 0x27, 0xD8, 0x07, 0xE3,
+    0x53, 0x2B, 0xDF, 0x31, 0x52, 0x7D, 0xD4, 0xF5,
+    0x4A, 0x5B, 0xA2, 0xC1, 0x72, 0x71, 0xAD, 0x3B
+  },
+  {
+    0xD0, 0xC4, 0x1C, 0x24, 0x35, 0x1C, 0xCE, 0xAE,
+    0x62, 0xCD, 0x26, 0x31, 0xB3, 0x43, 0xE6, 0x70,
+    0xD5, 0x23, 0x54, 0x07, 0x0E, 0x41, 0x14, 0x07,
+    0x62, 0xA5, 0xBB, 0x4B, 0xF2, 0x9E, 0x6A, 0x73
+  },
+  {
+    0xC8, 0xE5, 0x05, 0x79, 0x1C, 0x48, 0xC0, 0x73,
+    0x65, 0x63, 0x2F, 0xE0, 0xC6, 0x54, 0x56, 0x3F,
+    0xCB, 0x6A, 0xBE, 0x15, 0x29, 0xAD, 0x9A, 0x21,
+    0x72, 0x6B, 0x88, 0x26, 0x13, 0xA6, 0x4D, 0x97
+  },
+  {
+    0xEA, 0xA6, 0xE8, 0x33, 0xD7, 0x27, 0x9B, 0xB2,
+    0x2F, 0x86, 0xE4, 0xA6, 0x37, 0xF6, 0x63, 0x71,
+    0x04, 0x42, 0x37, 0x1B, 0x2B, 0x49, 0x3C, 0x6C,
+    0x32, 0x41, 0xEA, 0xD2, 0x18, 0xFD, 0xFB, 0xF3
+  },
+  {
+    0x32, 0x2F, 0x5B, 0x45, 0xB5, 0x2C, 0x2D, 0xBC,
+    0x93, 0xE8, 0x7F, 0x9E, 0x4F, 0x3D, 0xEA, 0x94,
+    0x94, 0x96, 0x8D, 0xB0, 0x98, 0x1E, 0x45, 0x6F,
+    0xDB, 0xE7, 0x87, 0x32, 0x16, 0x1B, 0x36, 0x72
+  },
+  {
+    0xA1, 0x92, 0x13, 0xAC, 0x37, 0xD5, 0x4A, 0x16,
+    0x17, 0xAF, 0x6A, 0x69, 0x8E, 0x4C, 0x36, 0x6C,
+    0x7D, 0x68, 0x30, 0xF5, 0xD2, 0x20, 0xEA, 0x30,
+    0xD8, 0xDA, 0xA0, 0xC5, 0x65, 0x77, 0xAB, 0xD8
+  },
+  {
+    0xD1, 0x89, 0x61, 0x81, 0x9A, 0xB5, 0xBF, 0xF5,
+    0x2C, 0x32, 0xB5, 0xB7, 0x42, 0xA1, 0x9D, 0xF5,
+    0xF8, 0x38, 0xDA, 0x28, 0x53, 0x7B, 0xB2, 0x95,
+    0x3B, 0xF9, 0xBF, 0x3E, 0x24, 0xDD, 0x79, 0x2D
+  },
+  {
+    0x48, 0xA4, 0x93, 0x6B, 0xAA, 0xF8, 0xBA, 0x30,
+    0xF4, 0x46, 0x4C, 0x2B, 0xB1, 0xBA, 0x2C, 0x41,
+    0x54, 0x53, 0x59, 0x13, 0xD5, 0x58, 0x32, 0xBF,
+    0x5A, 0xF9, 0x2B, 0x20, 0x38, 0x6B, 0x2F, 0x5E
+  },
+  {
+    0x83, 0x4C, 0xAD, 0xBA, 0xC4, 0x92, 0x04, 0x5D,
+    0x75, 0xDF, 0xB5, 0x46, 0x87, 0x09, 0xFF, 0x1D,
+    0xAD, 0xAD, 0x18, 0x3A, 0x9C, 0x3B, 0x42, 0xA5,
+    0xF8, 0x6E, 0x1F, 0x14, 0x3F, 0x1B, 0xB5, 0xD2
+  },
+  {
+    0xF4, 0x0A, 0xAE, 0x59, 0x04, 0xEC, 0x5E, 0x9A,
+    0x40, 0x18, 0x4C, 0xDB, 0xB0, 0x60, 0xB2, 0x15,
+    0x99, 0xE5, 0x41, 0x9B, 0x47, 0x3A, 0x8D, 0xEA,
+    0x6D, 0x09, 0x3D, 0x7A, 0x60, 0x80, 0xDA, 0x00
+  },
+  {
+    0x47, 0x1A, 0xEE, 0x38, 0x97, 0x54, 0xFD, 0x78,
+    0x45, 0x01, 0x7D, 0x0D, 0x10, 0x7C, 0xD2, 0xEC,
+    0xEC, 0x29, 0x4E, 0x1B, 0x70, 0x51, 0x17, 0x0C,
+    0x56, 0x9F, 0x51, 0xE5, 0x6B, 0x1B, 0xC0, 0x56
+  },
+  {
+    0x86, 0x6D, 0xB3, 0x7E, 0x2E, 0xEA, 0xF4, 0xDE,
+    0x05, 0xC9, 0x28, 0x40, 0x04, 0x61, 0x65, 0x8D,
+    0x1D, 0x81, 0xF8, 0xBC, 0x68, 0x94, 0x92, 0xDC,
+    0xEF, 0x80, 0xD3, 0x8C, 0x07, 0xFD, 0x12, 0xF4
+  },
+  {
+    0xD4, 0x2F, 0xA4, 0x0F, 0x1E, 0xE6, 0xF3, 0x28,
+    0x6C, 0x8E, 0x4C, 0x92, 0x70, 0x58, 0x07, 0xE0,
+    0xD4, 0x38, 0x39, 0xCB, 0xA3, 0x0F, 0x8D, 0xBC,
+    0x5F, 0x44, 0x9D, 0x7F, 0x88, 0xE8, 0x3F, 0x95
+  },
+  {
+    0x24, 0xF3, 0x94, 0x93, 0x18, 0x48, 0xC0, 0x9C,
+    0xBF, 0xD5, 0xAA, 0x24, 0xAF, 0x1C, 0x0B, 0x16,
+    0x89, 0x90, 0x9D, 0x17, 0xA0, 0x2C, 0x3F, 0xE3,
+    0x8E, 0x99, 0x62, 0xF0, 0x6A, 0xEE, 0x1E, 0xB2
+  },
+  {
+    0x56, 0xED, 0xF8, 0xB9, 0x9E, 0xFC, 0xE7, 0x8C,
+    0x81, 0x98, 0xD7, 0xA0, 0xCF, 0x11, 0x88, 0x3B,
+    0x39, 0x6F, 0xC7, 0x11, 0x09, 0xFB, 0x10, 0x4A,
+    0x65, 0xA6, 0x59, 0xDE, 0xD8, 0x41, 0xD2, 0xF0
+  },
+  {
+    0xB1, 0xCC, 0xB9, 0x28, 0xF0, 0x33, 0x9E, 0x45,
+    0x9F, 0x1F, 0x01, 0x57, 0x88, 0x60, 0x06, 0xF9,
+    0x4E, 0xCB, 0x95, 0xFE, 0x67, 0x28, 0x51, 0x42,
+    0x61, 0x76, 0x17, 0x8E, 0x33, 0x3A, 0x52, 0x51
+  },
+  {
+    0x86, 0xAF, 0x5B, 0x02, 0x0E, 0x08, 0xAC, 0x3C,
+    0xF1, 0x54, 0xF1, 0x3F, 0x3E, 0x7B, 0x28, 0x5B,
+    0x4E, 0x80, 0x75, 0x6C, 0xBE, 0x32, 0xBA, 0x3A,
+    0x8F, 0xAC, 0x81, 0xB2, 0xDE, 0xE8, 0x7B, 0x20
+  },
+  {
+    0x45, 0x5C, 0x44, 0x95, 0xAC, 0xD4, 0x5A, 0x3F,
+    0xAC, 0xC4, 0x46, 0x11, 0xAC, 0x4A, 0x86, 0x79,
+    0x36, 0x56, 0x32, 0x7A, 0xD5, 0x96, 0x26, 0xD4,
+    0xFB, 0x94, 0x08, 0x26, 0x73, 0x40, 0xC5, 0x59
+  },
+  {
+    0x65, 0x93, 0x81, 0x47, 0x29, 0x77, 0x29, 0x39,
+    0x1F, 0xF7, 0x58, 0xDB, 0x38, 0x40, 0x8E, 0xC9,
+    0xED, 0x5D, 0xA9, 0x1E, 0x74, 0xBD, 0x26, 0x65,
+    0xAD, 0x12, 0x90, 0xF1, 0x1A, 0x39, 0xE2, 0x2A
+  },
+  {
+    0xE0, 0x9B, 0x9C, 0x55, 0x5A, 0x36, 0xB0, 0x9A,
+    0xD2, 0x96, 0x89, 0xE4, 0x1B, 0x4E, 0xBF, 0x72,
+    0x4D, 0x25, 0x46, 0x8F, 0xD0, 0x9D, 0xAC, 0x65,
+    0x79, 0xF1, 0xF9, 0x32, 0x11, 0x80, 0x74, 0x7C
+  },
+  {
+    0x04, 0xBE, 0xDC, 0x53, 0x01, 0xB0, 0x27, 0x91,
+    0x05, 0x71, 0xF4, 0xC6, 0x33, 0x12, 0x8A, 0x34,
+    0x49, 0xEA, 0x0A, 0xA4, 0x54, 0xDE, 0x21, 0x31,
+    0x89, 0x91, 0x36, 0x57, 0x6A, 0x56, 0x28, 0xC3
+  },
+  {
+    0xF6, 0x1F, 0x5B, 0xE8, 0x8E, 0x3D, 0xFE, 0xCB,
+    0xB4, 0x88, 0x8A, 0x2B, 0xD1, 0x3D, 0x39, 0x93,
+    0xAA, 0x4F, 0xFF, 0xD2, 0x0B, 0xFD, 0xC7, 0x89,
+    0xB1, 0x4E, 0x48, 0x47, 0x66, 0x3D, 0xC3, 0xDC
+  },
+  {
+    0x84, 0x98, 0xA0, 0x73, 0x31, 0xA1, 0xE6, 0x0E,
+    0x9D, 0x43, 0xA3, 0x22, 0xCE, 0xD4, 0xB9, 0x6A,
+    0x26, 0x85, 0xF8, 0x06, 0xF5, 0xA3, 0x79, 0xDA,
+    0x95, 0xD6, 0x3F, 0x2F, 0x2A, 0x79, 0x42, 0xD3
+  },
+  {
+    0x88, 0x4B, 0x7E, 0xF0, 0x45, 0xD4, 0x30, 0x0D,
+    0xC2, 0x7A, 0xA1, 0x2B, 0x2B, 0x17, 0xCF, 0xF7,
+    0xED, 0x1D, 0xF9, 0x45, 0x72, 0xC7, 0xB5, 0x6E,
+    0xAD, 0x4C, 0x08, 0x79, 0x67, 0x7D, 0xE6, 0xB0
+  },
+  {
+    0x9B, 0x92, 0x5C, 0xD8, 0x09, 0x45, 0xB2, 0x19,
+    0x94, 0x6E, 0x4A, 0x6C, 0xF1, 0xE4, 0xA3, 0x8C,
+    0x5A, 0x9A, 0xCE, 0x05, 0xF0, 0xE8, 0x27, 0x7D,
+    0xB4, 0xC1, 0xA3, 0xD3, 0xAC, 0x1D, 0xA6, 0x7E
+  },
+  {
+    0x06, 0x05, 0x2E, 0x95, 0x97, 0x5F, 0xC1, 0xA9,
+    0x2F, 0x0D, 0xA2, 0xB7, 0x8A, 0x04, 0xC8, 0xEB,
+    0xFF, 0xFC, 0x8F, 0x3C, 0xAB, 0x64, 0x94, 0x79,
+    0x91, 0x31, 0xAC, 0x53, 0x10, 0x43, 0xE5, 0x16
+  },
+  {
+    0x17, 0xC0, 0x1F, 0xFB, 0xE1, 0x88, 0x68, 0x08,
+    0x80, 0x4E, 0x93, 0x61, 0xF4, 0xE8, 0xD2, 0x75,
+    0xA4, 0x19, 0xC3, 0x68, 0x9C, 0xAC, 0x17, 0xBD,
+    0x78, 0x8F, 0x05, 0x4B, 0xC1, 0x0B, 0x5A, 0xD2
+  },
+  {
+    0xDA, 0x97, 0xF9, 0xA4, 0x51, 0x7A, 0x91, 0x04,
+    0x8B, 0x63, 0x72, 0xA2, 0x3C, 0x36, 0xFB, 0xFE,
+    0xAC, 0xEB, 0xEB, 0xB1, 0xEA, 0x8E, 0xC0, 0xE9,
+    0xCD, 0x42, 0x79, 0x74, 0xCE, 0x8D, 0x4E, 0xBA
+  },
+  {
+    0x59, 0x1D, 0x0A, 0xEB, 0xEC, 0x1E, 0x3D, 0x61,
+    0x4C, 0x16, 0x5B, 0x95, 0xC6, 0x8A, 0x21, 0x38,
+    0x72, 0x98, 0x39, 0x68, 0x12, 0x92, 0x0E, 0xA1,
+    0x4C, 0x35, 0x83, 0xFC, 0x15, 0x00, 0xEE, 0x34
+  },
+  {
+    0xC7, 0x6D, 0x5E, 0x57, 0x55, 0x76, 0x06, 0x97,
+    0xD2, 0xE9, 0x73, 0x66, 0x38, 0xEE, 0xC1, 0xD5,
+    0x9E, 0x95, 0x88, 0x51, 0x69, 0x8F, 0xE0, 0x2D,
+    0xC4, 0xF6, 0xEB, 0x5C, 0xA8, 0xC0, 0xC2, 0xC5
+  },
+  {
+    0xDA, 0xA3, 0x76, 0xD7, 0x9F, 0x2A, 0xEF, 0x77,
+    0x03, 0xF9, 0xBE, 0x72, 0x17, 0x3F, 0x4E, 0xDD,
+    0xF5, 0xA6, 0x6E, 0x87, 0xBD, 0x28, 0xAB, 0x67,
+    0x3F, 0x25, 0x3A, 0x4D, 0xC5, 0xB4, 0x91, 0x19
+  },
+  {
+    0x25, 0x7A, 0x75, 0x94, 0x30, 0xF8, 0x95, 0x38,
+    0x53, 0x26, 0x0A, 0xD2, 0xDD, 0x17, 0x5A, 0xCD,
+    0xFB, 0x8F, 0x28, 0x7F, 0x80, 0xC1, 0x19, 0x92,
+    0xCD, 0xE4, 0xBC, 0xC9, 0xA5, 0x4C, 0xE8, 0x59
+  },
+  {
+    0x82, 0x33, 0x31, 0xB5, 0xF6, 0xAB, 0x7F, 0x85,
+    0xAB, 0x33, 0x27, 0x76, 0x1C, 0x2E, 0xBB, 0x0D,
+    0x85, 0x04, 0x8A, 0x05, 0x53, 0x4F, 0x56, 0x89,
+    0x65, 0x70, 0xD9, 0x63, 0x85, 0xF7, 0xB2, 0x18
+  },
+  {
+    0x54, 0x1E, 0x0D, 0xFB, 0xA5, 0xD5, 0x4B, 0x64,
+    0x2B, 0x00, 0x12, 0xB0, 0xA0, 0xDC, 0x1C, 0x75,
+    0x0C, 0x3B, 0x85, 0x00, 0xA1, 0x85, 0xEE, 0x17,
+    0x5D, 0x08, 0x88, 0x01, 0x5C, 0x2D, 0x98, 0x62
+  },
+  {
+    0x9B, 0x80, 0x71, 0xAD, 0xC5, 0x71, 0x6D, 0xF6,
+    0x1C, 0x2A, 0x7B, 0x79, 0x1D, 0x24, 0x6A, 0x12,
+    0xDC, 0xE7, 0x6F, 0x9B, 0x9B, 0x39, 0x5E, 0xF7,
+    0x77, 0x93, 0x97, 0xB1, 0x85, 0xE4, 0xF4, 0x69
+  },
+  {
+    0x55, 0x2E, 0x1D, 0xAD, 0x50, 0x59, 0xFF, 0xFB,
+    0x35, 0x2F, 0xF7, 0xE3, 0xC8, 0x02, 0xB8, 0xEE,
+    0x68, 0x12, 0xA3, 0xAD, 0x48, 0x73, 0xAA, 0x7B,
+    0x31, 0x2B, 0xA4, 0x22, 0x56, 0x5C, 0x4B, 0x1D
+  },
+  {
+    0x6A, 0x40, 0x5E, 0x55, 0x87, 0xBD, 0x09, 0xFB,
+    0xD0, 0x59, 0x81, 0xF4, 0x95, 0x16, 0x1D, 0x46,
+    0x03, 0xCA, 0x1B, 0x16, 0x20, 0x32, 0xC8, 0xC0,
+    0xD8, 0xC9, 0x9C, 0x7F, 0xC8, 0x00, 0x89, 0xA2
+  },
+  {
+    0x9E, 0x50, 0xFA, 0xD6, 0x23, 0x83, 0x5C, 0x7C,
+    0x3B, 0x5C, 0x59, 0xD8, 0x21, 0x6E, 0x29, 0x6F,
+    0xCF, 0x55, 0xFD, 0x1E, 0xE5, 0xCF, 0x59, 0x77,
+    0x10, 0x0C, 0xAF, 0x96, 0x83, 0xBF, 0x78, 0x8E
+  }
+};
+
+#endif /* BLAKE2_KAT_H */
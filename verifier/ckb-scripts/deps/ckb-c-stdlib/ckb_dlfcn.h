@@ -28,7 +28,9 @@ typedef struct {
 
 #define SHT_STRTAB 3
 #define SHT_RELA 4
+#define SHT_HASH 5
 #define SHT_DYNSYM 11
+#define SHT_GNU_HASH 0x6ffffff6
 
 typedef struct {
   uint32_t sh_name;
@@ -83,12 +85,16 @@ typedef struct {
 #define ERROR_CONTEXT_FAILURE -21
 #define ERROR_INVALID_ELF -22
 #define ERROR_MEMORY_NOT_ENOUGH -23
+#define ERROR_SYMBOL_NOT_FOUND -24
 
 typedef struct {
   Elf64_Sym *dynsyms;
   const char *dynstr;
   size_t dynsym_size;
   uint8_t *base_addr;
+  /* Symbol hash tables, NULL when the library has none */
+  const uint32_t *hash;
+  const uint32_t *gnu_hash;
 } CkbDlfcnContext;
 
 int ckb_dlopen(const uint8_t *dep_cell_data_hash, uint8_t *aligned_addr,
@@ -155,7 +161,15 @@ int ckb_dlopen(const uint8_t *dep_cell_data_hash, uint8_t *aligned_addr,
         max_consumed_size = MAX(max_consumed_size, vaddr + memsz);
       } else {
         uint64_t filesz = ph->p_filesz;
-        uint64_t consumed_end = ROUNDUP(ph->p_vaddr + filesz, RISCV_PGSIZE);
+        /*
+         * Memory past filesz is .bss, it is part of the library's footprint
+         * and must be zero even when the region was used before.
+         */
+        if (ph->p_memsz < filesz) {
+          return ERROR_INVALID_ELF;
+        }
+        uint64_t consumed_end =
+            ROUNDUP(ph->p_vaddr + ph->p_memsz, RISCV_PGSIZE);
         if (consumed_end > aligned_size) {
           return ERROR_MEMORY_NOT_ENOUGH;
         }
@@ -167,6 +181,8 @@ int ckb_dlopen(const uint8_t *dep_cell_data_hash, uint8_t *aligned_addr,
         if (filesz < ph->p_filesz) {
           return ERROR_INVALID_ELF;
         }
+        memset(aligned_addr + ph->p_vaddr + ph->p_filesz, 0,
+               ph->p_memsz - ph->p_filesz);
         max_consumed_size = MAX(max_consumed_size, consumed_end);
       }
     }
@@ -220,11 +236,11 @@ int ckb_dlopen(const uint8_t *dep_cell_data_hash, uint8_t *aligned_addr,
         if (ret != CKB_SUCCESS) {
           return ret;
         }
-        if (len < load_size * sizeof(Elf64_Rela)) {
+        if (load_length < load_size * sizeof(Elf64_Rela)) {
           return ERROR_INVALID_ELF;
         }
         relocation_size -= load_size;
-        current_offset += len;
+        current_offset += load_size * sizeof(Elf64_Rela);
         for (int j = 0; j < load_size; j++) {
           Elf64_Rela *r = &relocations[j];
           if (r->r_info != R_RISCV_RELATIVE) {
@@ -243,6 +259,10 @@ int ckb_dlopen(const uint8_t *dep_cell_data_hash, uint8_t *aligned_addr,
       }
       context->dynsyms = (Elf64_Sym *)(aligned_addr + sh->sh_offset);
       context->dynsym_size = sh->sh_size / sh->sh_entsize;
+    } else if (sh->sh_type == SHT_HASH) {
+      context->hash = (const uint32_t *)(aligned_addr + sh->sh_offset);
+    } else if (sh->sh_type == SHT_GNU_HASH) {
+      context->gnu_hash = (const uint32_t *)(aligned_addr + sh->sh_offset);
     } else if (sh->sh_type == SHT_STRTAB) {
       const char *current_str = shrtab + sh->sh_name;
       if (strcmp(".dynstr", current_str) == 0) {
@@ -258,9 +278,105 @@ int ckb_dlopen(const uint8_t *dep_cell_data_hash, uint8_t *aligned_addr,
   return CKB_SUCCESS;
 }
 
+static void *ckb_dlsym_match(CkbDlfcnContext *context, uint64_t i,
+                             const char *symbol) {
+  if (i >= context->dynsym_size) {
+    return NULL;
+  }
+  Elf64_Sym *sym = &context->dynsyms[i];
+  if (sym->st_shndx == 0 || strcmp(context->dynstr + sym->st_name, symbol) != 0) {
+    return NULL;
+  }
+  return (void *)(context->base_addr + sym->st_value);
+}
+
+/* DT_GNU_HASH lookup, the bloom filter rejects most missing symbols */
+static void *ckb_dlsym_gnu_hash(CkbDlfcnContext *context, const char *symbol) {
+  const uint32_t *table = context->gnu_hash;
+  uint32_t nbuckets = table[0];
+  uint32_t symoffset = table[1];
+  uint32_t bloom_size = table[2];
+  uint32_t bloom_shift = table[3];
+  const uint64_t *bloom = (const uint64_t *)&table[4];
+  const uint32_t *buckets = (const uint32_t *)&bloom[bloom_size];
+  const uint32_t *chain = &buckets[nbuckets];
+  if (nbuckets == 0 || bloom_size == 0) {
+    return NULL;
+  }
+
+  uint32_t h = 5381;
+  for (const unsigned char *c = (const unsigned char *)symbol; *c; c++) {
+    h = (h << 5) + h + *c;
+  }
+  uint64_t word = bloom[(h / 64) % bloom_size];
+  uint64_t mask = ((uint64_t)1 << (h % 64)) |
+                  ((uint64_t)1 << ((h >> bloom_shift) % 64));
+  if ((word & mask) != mask) {
+    return NULL;
+  }
+
+  uint32_t i = buckets[h % nbuckets];
+  if (i < symoffset) {
+    return NULL;
+  }
+  while (i < context->dynsym_size) {
+    uint32_t h2 = chain[i - symoffset];
+    if ((h | 1) == (h2 | 1)) {
+      void *addr = ckb_dlsym_match(context, i, symbol);
+      if (addr != NULL) {
+        return addr;
+      }
+    }
+    if (h2 & 1) {
+      break;
+    }
+    i++;
+  }
+  return NULL;
+}
+
+/* DT_HASH lookup */
+static void *ckb_dlsym_sysv_hash(CkbDlfcnContext *context, const char *symbol) {
+  const uint32_t *table = context->hash;
+  uint32_t nbucket = table[0];
+  uint32_t nchain = table[1];
+  const uint32_t *buckets = &table[2];
+  const uint32_t *chain = &buckets[nbucket];
+  if (nbucket == 0) {
+    return NULL;
+  }
+
+  uint32_t h = 0;
+  for (const unsigned char *c = (const unsigned char *)symbol; *c; c++) {
+    h = (h << 4) + *c;
+    uint32_t g = h & 0xf0000000;
+    if (g != 0) {
+      h ^= g >> 24;
+    }
+    h &= ~g;
+  }
+  /* Bounded by nchain so that a malformed table cannot loop forever */
+  uint32_t steps = 0;
+  for (uint32_t i = buckets[h % nbucket]; i != 0 && i < nchain && steps < nchain;
+       i = chain[i], steps++) {
+    void *addr = ckb_dlsym_match(context, i, symbol);
+    if (addr != NULL) {
+      return addr;
+    }
+  }
+  return NULL;
+}
+
 void *ckb_dlsym(void *handle, const char *symbol) {
   CkbDlfcnContext *context = (CkbDlfcnContext *)handle;
 
+  if (context->gnu_hash != NULL) {
+    return ckb_dlsym_gnu_hash(context, symbol);
+  }
+  if (context->hash != NULL) {
+    return ckb_dlsym_sysv_hash(context, symbol);
+  }
+
   for (uint64_t i = 0; i < context->dynsym_size; i++) {
     Elf64_Sym *sym = &context->dynsyms[i];
     const char *str = context->dynstr + sym->st_name;
@@ -272,4 +388,52 @@ void *ckb_dlsym(void *handle, const char *symbol) {
   return NULL;
 }
 
+typedef struct {
+  const char *name;
+  void **addr;
+} CkbDlsymEntry;
+
+/*
+ * Resolves every entry of a table of symbols, stopping at the first one the
+ * library does not export.
+ */
+int ckb_dlsym_all(void *handle, CkbDlsymEntry *entries, size_t count) {
+  for (size_t i = 0; i < count; i++) {
+    *entries[i].addr = ckb_dlsym(handle, entries[i].name);
+    if (*entries[i].addr == NULL) {
+      return ERROR_SYMBOL_NOT_FOUND;
+    }
+  }
+  return CKB_SUCCESS;
+}
+
+/*
+ * Packs several libraries into one page aligned region. Each ckb_dlopen_arena
+ * call loads a library right after the previous one.
+ */
+typedef struct {
+  uint8_t *base_addr;
+  size_t size;
+  size_t used;
+} CkbDlfcnArena;
+
+void ckb_dlfcn_arena_init(CkbDlfcnArena *arena, uint8_t *aligned_addr,
+                          size_t aligned_size) {
+  arena->base_addr = aligned_addr;
+  arena->size = ROUNDDOWN(aligned_size, RISCV_PGSIZE);
+  arena->used = 0;
+}
+
+int ckb_dlopen_arena(CkbDlfcnArena *arena, const uint8_t *dep_cell_data_hash,
+                     void **handle) {
+  size_t consumed_size = 0;
+  int ret = ckb_dlopen(dep_cell_data_hash, arena->base_addr + arena->used,
+                       arena->size - arena->used, handle, &consumed_size);
+  if (ret != CKB_SUCCESS) {
+    return ret;
+  }
+  arena->used += ROUNDUP(consumed_size, RISCV_PGSIZE);
+  return CKB_SUCCESS;
+}
+
 #endif /* CKB_C_STDLIB_CKB_DLFCN_H_ */
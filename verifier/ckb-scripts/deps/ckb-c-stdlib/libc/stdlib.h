@@ -4,13 +4,126 @@
 #include <entry.h>
 
 #include <stddef.h>
+#include <stdint.h>
+#include <string.h>
 
-void *malloc(size_t size) { return NULL; }
+/*
+ * Bump allocator over a static heap.
+ *
+ * Scripts run once and exit, so memory is never handed back to a general
+ * pool. malloc carves blocks off the top of the heap, free only rolls the
+ * top back when it is given the most recent block, and realloc grows the
+ * most recent block in place. Code that needs scratch memory for a bounded
+ * step can take a mark with ckb_heap_mark and release everything allocated
+ * after it with ckb_heap_reset.
+ *
+ * The heap size can be changed by defining CKB_HEAP_SIZE before including
+ * this file. Scripts that never call malloc keep the heap out of the binary
+ * when linked with --gc-sections.
+ */
+#ifndef CKB_HEAP_SIZE
+#define CKB_HEAP_SIZE (128 * 1024)
+#endif
 
-void free(void *ptr) {}
+#define CKB_HEAP_ALIGN 16
 
-void *calloc(size_t nmemb, size_t size) { return NULL; }
+/* Every block is preceded by its size, padded to keep blocks aligned */
+#define CKB_HEAP_HEADER_SIZE CKB_HEAP_ALIGN
 
-void *realloc(void *ptr, size_t size) { return NULL; }
+static uint8_t ckb_heap[CKB_HEAP_SIZE]
+    __attribute__((aligned(CKB_HEAP_ALIGN)));
+static size_t ckb_heap_top = 0;
+/* Offset of the most recent block's header, SIZE_MAX when there is none */
+static size_t ckb_heap_last = SIZE_MAX;
+
+typedef struct {
+  size_t top;
+  size_t last;
+} ckb_heap_mark_t;
+
+size_t ckb_heap_used() { return ckb_heap_top; }
+
+ckb_heap_mark_t ckb_heap_mark() {
+  ckb_heap_mark_t mark;
+  mark.top = ckb_heap_top;
+  mark.last = ckb_heap_last;
+  return mark;
+}
+
+/*
+ * Frees every block allocated after mark was taken. A free that already
+ * dropped the top below the mark is kept, and a block that reused such
+ * memory is only released down to the mark.
+ */
+void ckb_heap_reset(ckb_heap_mark_t mark) {
+  if (mark.top <= ckb_heap_top) {
+    ckb_heap_top = mark.top;
+    ckb_heap_last = mark.last;
+  }
+}
+
+static size_t *ckb_heap_header(void *ptr) {
+  return (size_t *)((uint8_t *)ptr - CKB_HEAP_HEADER_SIZE);
+}
+
+void *malloc(size_t size) {
+  size_t padded = (size + (CKB_HEAP_ALIGN - 1)) & ~(size_t)(CKB_HEAP_ALIGN - 1);
+  if (padded < size || CKB_HEAP_SIZE - ckb_heap_top < CKB_HEAP_HEADER_SIZE ||
+      padded > CKB_HEAP_SIZE - ckb_heap_top - CKB_HEAP_HEADER_SIZE) {
+    return NULL;
+  }
+  uint8_t *block = &ckb_heap[ckb_heap_top];
+  *(size_t *)block = size;
+  ckb_heap_last = ckb_heap_top;
+  ckb_heap_top += CKB_HEAP_HEADER_SIZE + padded;
+  return block + CKB_HEAP_HEADER_SIZE;
+}
+
+void free(void *ptr) {
+  if (ptr == NULL) {
+    return;
+  }
+  size_t offset = (uint8_t *)ckb_heap_header(ptr) - ckb_heap;
+  if (offset == ckb_heap_last) {
+    ckb_heap_top = offset;
+    ckb_heap_last = SIZE_MAX;
+  }
+}
+
+void *calloc(size_t nmemb, size_t size) {
+  if (size != 0 && nmemb > SIZE_MAX / size) {
+    return NULL;
+  }
+  void *ptr = malloc(nmemb * size);
+  if (ptr != NULL) {
+    memset(ptr, 0, nmemb * size);
+  }
+  return ptr;
+}
+
+void *realloc(void *ptr, size_t size) {
+  if (ptr == NULL) {
+    return malloc(size);
+  }
+  size_t *header = ckb_heap_header(ptr);
+  size_t offset = (uint8_t *)header - ckb_heap;
+  if (offset == ckb_heap_last) {
+    size_t padded =
+        (size + (CKB_HEAP_ALIGN - 1)) & ~(size_t)(CKB_HEAP_ALIGN - 1);
+    if (padded >= size &&
+        padded <= CKB_HEAP_SIZE - CKB_HEAP_HEADER_SIZE - offset) {
+      *header = size;
+      ckb_heap_top = offset + CKB_HEAP_HEADER_SIZE + padded;
+      return ptr;
+    }
+    return NULL;
+  }
+  size_t old_size = *header;
+  void *new_ptr = malloc(size);
+  if (new_ptr != NULL) {
+    memcpy(new_ptr, ptr, old_size < size ? old_size : size);
+  }
+  return new_ptr;
+}
 
 #endif /* CKB_C_STDLIB_STDLIB_H_ */
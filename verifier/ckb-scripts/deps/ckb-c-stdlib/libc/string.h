@@ -251,11 +251,39 @@ void *memcpy(void *restrict dest, const void *restrict src, size_t n) {
 
 int memcmp(const void *vl, const void *vr, size_t n) {
   const unsigned char *l = vl, *r = vr;
+#ifdef __GNUC__
+  typedef uint64_t __attribute__((__may_alias__)) u64;
+
+  /* When both sides share an alignment, skip equal 8-byte words and leave
+   * the first differing word, if any, to the byte loop for the ordering. */
+  if ((uintptr_t)l % 8 == (uintptr_t)r % 8) {
+    for (; n && (uintptr_t)l % 8; n--, l++, r++) {
+      if (*l != *r) return *l - *r;
+    }
+    for (; n >= 8 && *(const u64 *)l == *(const u64 *)r; n -= 8, l += 8, r += 8)
+      ;
+  }
+#endif
   for (; n && *l == *r; n--, l++, r++)
     ;
   return n ? *l - *r : 0;
 }
 
+/*
+ * Equality of two 32 byte hashes. Compares four 64-bit words when both
+ * hashes are 8-byte aligned, which is the case for hashes in local arrays.
+ */
+static inline int hash32_eq(const void *a, const void *b) {
+#ifdef __GNUC__
+  typedef uint64_t __attribute__((__may_alias__)) u64;
+  if ((((uintptr_t)a | (uintptr_t)b) & 7) == 0) {
+    const u64 *x = a, *y = b;
+    return ((x[0] ^ y[0]) | (x[1] ^ y[1]) | (x[2] ^ y[2]) | (x[3] ^ y[3])) == 0;
+  }
+#endif
+  return memcmp(a, b, 32) == 0;
+}
+
 #ifdef __GNUC__
 typedef __attribute__((__may_alias__)) size_t WT;
 #define WS (sizeof(WT))
@@ -11,6 +11,11 @@
 
 #define ERROR_IO -1
 
+/* The window recorded below must be the one the tables were generated for */
+_Static_assert(sizeof(secp256k1_ecmult_static_pre_context) ==
+                   ECMULT_TABLE_SIZE(WINDOW_G) * sizeof(secp256k1_ge_storage),
+               "ecmult_static_pre_context.h was not generated for ECMULT_WINDOW_SIZE");
+
 int main(int argc, char* argv[]) {
   size_t pre_size = sizeof(secp256k1_ecmult_static_pre_context);
   size_t pre128_size = sizeof(secp256k1_ecmult_static_pre128_context);
@@ -33,6 +38,7 @@ int main(int argc, char* argv[]) {
   fprintf(fp, "#define CKB_SECP256K1_DATA_SIZE %ld\n", pre_size + pre128_size);
   fprintf(fp, "#define CKB_SECP256K1_DATA_PRE_SIZE %ld\n", pre_size);
   fprintf(fp, "#define CKB_SECP256K1_DATA_PRE128_SIZE %ld\n", pre128_size);
+  fprintf(fp, "#define CKB_SECP256K1_DATA_WINDOW %d\n", ECMULT_WINDOW_SIZE);
 
   blake2b_state blake2b_ctx;
   uint8_t hash[32];
@@ -53,5 +59,9 @@ int main(int argc, char* argv[]) {
   fprintf(fp, "#endif\n");
   fclose(fp);
 
+  /* Memory footprint of this variant, collected by make secp256k1-variants */
+  printf("window %d: pre_g %ld bytes, pre_g_128 %ld bytes, total %ld bytes\n",
+         ECMULT_WINDOW_SIZE, pre_size, pre128_size, pre_size + pre128_size);
+
   return 0;
 }
@@ -10,6 +10,7 @@
 #ifdef USE_BASIC_CONFIG
 
 #undef USE_ASM_X86_64
+#undef USE_ASM_RISCV64
 #undef USE_ECMULT_STATIC_PRECOMPUTATION
 #undef USE_ENDOMORPHISM
 #undef USE_EXTERNAL_ASM
@@ -30,7 +31,10 @@
 #define USE_SCALAR_INV_BUILTIN 1
 #define USE_FIELD_10X26 1
 #define USE_SCALAR_8X32 1
+/* Table generators are built with -DECMULT_WINDOW_SIZE to match configure */
+#ifndef ECMULT_WINDOW_SIZE
 #define ECMULT_WINDOW_SIZE 15
+#endif
 
 #endif /* USE_BASIC_CONFIG */
 
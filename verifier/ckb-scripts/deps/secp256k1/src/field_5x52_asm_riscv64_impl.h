@@ -0,0 +1,568 @@
+/**********************************************************************
+ * Copyright (c) 2013-2014 Diederik Huys, Pieter Wuille               *
+ * Distributed under the MIT software license, see the accompanying   *
+ * file COPYING or http://www.opensource.org/licenses/mit-license.php.*
+ **********************************************************************/
+
+/**
+ * RV64IM version of Peter Dettman's parallel multiplication algorithm, as
+ * used by field_5x52_int128_impl.h, for running under CKB-VM.
+ *
+ * The portable code keeps c and d as full 128 bit values, so every ">>= 52"
+ * becomes a double word shift and every "+=" a 128 bit add. The bounds in the
+ * portable code show that c and d always fit in 64 bits after being shifted
+ * by 52, so the high word is dropped at that point and the following
+ * accumulation restarts it from the high half of the next product.
+ */
+
+#ifndef SECP256K1_FIELD_INNER5X52_IMPL_H
+#define SECP256K1_FIELD_INNER5X52_IMPL_H
+
+SECP256K1_INLINE static void secp256k1_fe_mul_inner(uint64_t *r, const uint64_t *a, const uint64_t * SECP256K1_RESTRICT b) {
+/**
+ * Registers: t5:t4 = multiplication accumulator
+ *            t1:t0 = c
+ *            t3:t2 = d
+ *            t6    = carry
+ *            a0-a4 = a0-a4
+ *            a5    = b[i]
+ *            a6    = M
+ *            a7    = R
+ *            s1    = t3
+ *            s2    = t4
+ *            s3    = tx
+ */
+__asm__ __volatile__(
+    "ld a0,0(%[a])\n"
+    "ld a1,8(%[a])\n"
+    "ld a2,16(%[a])\n"
+    "ld a3,24(%[a])\n"
+    "ld a4,32(%[a])\n"
+    /* M = 0xfffffffffffff, R = 0x1000003d10 */
+    "li a6,-1\n"
+    "srli a6,a6,12\n"
+    "li a7,0x1000003d10\n"
+    /* d = a0 * b3 + a1 * b2 + a2 * b1 + a3 * b0 */
+    "ld a5,24(%[b])\n"
+    "mul t2,a0,a5\n"
+    "mulhu t3,a0,a5\n"
+    "ld a5,16(%[b])\n"
+    "mul t4,a1,a5\n"
+    "mulhu t5,a1,a5\n"
+    "add t2,t2,t4\n"
+    "sltu t6,t2,t4\n"
+    "add t3,t3,t5\n"
+    "add t3,t3,t6\n"
+    "ld a5,8(%[b])\n"
+    "mul t4,a2,a5\n"
+    "mulhu t5,a2,a5\n"
+    "add t2,t2,t4\n"
+    "sltu t6,t2,t4\n"
+    "add t3,t3,t5\n"
+    "add t3,t3,t6\n"
+    "ld a5,0(%[b])\n"
+    "mul t4,a3,a5\n"
+    "mulhu t5,a3,a5\n"
+    "add t2,t2,t4\n"
+    "sltu t6,t2,t4\n"
+    "add t3,t3,t5\n"
+    "add t3,t3,t6\n"
+    /* c = a4 * b4 */
+    "ld a5,32(%[b])\n"
+    "mul t0,a4,a5\n"
+    "mulhu t1,a4,a5\n"
+    /* d += (c & M) * R */
+    "and t6,t0,a6\n"
+    "mul t4,t6,a7\n"
+    "mulhu t5,t6,a7\n"
+    "add t2,t2,t4\n"
+    "sltu t6,t2,t4\n"
+    "add t3,t3,t5\n"
+    "add t3,t3,t6\n"
+    /* c >>= 52 (t0 only) */
+    "srli t0,t0,52\n"
+    "slli t1,t1,12\n"
+    "or t0,t0,t1\n"
+    /* t3 = d & M */
+    "and s1,t2,a6\n"
+    /* d >>= 52 (t2 only) */
+    "srli t2,t2,52\n"
+    "slli t3,t3,12\n"
+    "or t2,t2,t3\n"
+    /* d += a0 * b4 + a1 * b3 + a2 * b2 + a3 * b1 + a4 * b0 */
+    "ld a5,32(%[b])\n"
+    "mul t4,a0,a5\n"
+    "mulhu t3,a0,a5\n"
+    "add t2,t2,t4\n"
+    "sltu t6,t2,t4\n"
+    "add t3,t3,t6\n"
+    "ld a5,24(%[b])\n"
+    "mul t4,a1,a5\n"
+    "mulhu t5,a1,a5\n"
+    "add t2,t2,t4\n"
+    "sltu t6,t2,t4\n"
+    "add t3,t3,t5\n"
+    "add t3,t3,t6\n"
+    "ld a5,16(%[b])\n"
+    "mul t4,a2,a5\n"
+    "mulhu t5,a2,a5\n"
+    "add t2,t2,t4\n"
+    "sltu t6,t2,t4\n"
+    "add t3,t3,t5\n"
+    "add t3,t3,t6\n"
+    "ld a5,8(%[b])\n"
+    "mul t4,a3,a5\n"
+    "mulhu t5,a3,a5\n"
+    "add t2,t2,t4\n"
+    "sltu t6,t2,t4\n"
+    "add t3,t3,t5\n"
+    "add t3,t3,t6\n"
+    "ld a5,0(%[b])\n"
+    "mul t4,a4,a5\n"
+    "mulhu t5,a4,a5\n"
+    "add t2,t2,t4\n"
+    "sltu t6,t2,t4\n"
+    "add t3,t3,t5\n"
+    "add t3,t3,t6\n"
+    /* d += c * R */
+    "mul t4,t0,a7\n"
+    "mulhu t5,t0,a7\n"
+    "add t2,t2,t4\n"
+    "sltu t6,t2,t4\n"
+    "add t3,t3,t5\n"
+    "add t3,t3,t6\n"
+    /* t4 = d & M */
+    "and s2,t2,a6\n"
+    /* d >>= 52 (t2 only) */
+    "srli t2,t2,52\n"
+    "slli t3,t3,12\n"
+    "or t2,t2,t3\n"
+    /* tx = t4 >> 48, t4 &= (M >> 4) */
+    "srli s3,s2,48\n"
+    "slli s2,s2,16\n"
+    "srli s2,s2,16\n"
+    /* c = a0 * b0 */
+    "ld a5,0(%[b])\n"
+    "mul t0,a0,a5\n"
+    "mulhu t1,a0,a5\n"
+    /* d += a1 * b4 + a2 * b3 + a3 * b2 + a4 * b1 */
+    "ld a5,32(%[b])\n"
+    "mul t4,a1,a5\n"
+    "mulhu t3,a1,a5\n"
+    "add t2,t2,t4\n"
+    "sltu t6,t2,t4\n"
+    "add t3,t3,t6\n"
+    "ld a5,24(%[b])\n"
+    "mul t4,a2,a5\n"
+    "mulhu t5,a2,a5\n"
+    "add t2,t2,t4\n"
+    "sltu t6,t2,t4\n"
+    "add t3,t3,t5\n"
+    "add t3,t3,t6\n"
+    "ld a5,16(%[b])\n"
+    "mul t4,a3,a5\n"
+    "mulhu t5,a3,a5\n"
+    "add t2,t2,t4\n"
+    "sltu t6,t2,t4\n"
+    "add t3,t3,t5\n"
+    "add t3,t3,t6\n"
+    "ld a5,8(%[b])\n"
+    "mul t4,a4,a5\n"
+    "mulhu t5,a4,a5\n"
+    "add t2,t2,t4\n"
+    "sltu t6,t2,t4\n"
+    "add t3,t3,t5\n"
+    "add t3,t3,t6\n"
+    /* u0 = d & M */
+    "and t6,t2,a6\n"
+    /* d >>= 52 (t2 only) */
+    "srli t2,t2,52\n"
+    "slli t3,t3,12\n"
+    "or t2,t2,t3\n"
+    /* u0 = (u0 << 4) | tx */
+    "slli t6,t6,4\n"
+    "or t6,t6,s3\n"
+    /* c += u0 * (R >> 4) */
+    "srli a5,a7,4\n"
+    "mul t4,t6,a5\n"
+    "mulhu t5,t6,a5\n"
+    "add t0,t0,t4\n"
+    "sltu t6,t0,t4\n"
+    "add t1,t1,t5\n"
+    "add t1,t1,t6\n"
+    /* r[0] = c & M */
+    "and t6,t0,a6\n"
+    "sd t6,0(%[r])\n"
+    /* c >>= 52 (t0 only) */
+    "srli t0,t0,52\n"
+    "slli t1,t1,12\n"
+    "or t0,t0,t1\n"
+    /* c += a0 * b1 + a1 * b0 */
+    "ld a5,8(%[b])\n"
+    "mul t4,a0,a5\n"
+    "mulhu t1,a0,a5\n"
+    "add t0,t0,t4\n"
+    "sltu t6,t0,t4\n"
+    "add t1,t1,t6\n"
+    "ld a5,0(%[b])\n"
+    "mul t4,a1,a5\n"
+    "mulhu t5,a1,a5\n"
+    "add t0,t0,t4\n"
+    "sltu t6,t0,t4\n"
+    "add t1,t1,t5\n"
+    "add t1,t1,t6\n"
+    /* d += a2 * b4 + a3 * b3 + a4 * b2 */
+    "ld a5,32(%[b])\n"
+    "mul t4,a2,a5\n"
+    "mulhu t3,a2,a5\n"
+    "add t2,t2,t4\n"
+    "sltu t6,t2,t4\n"
+    "add t3,t3,t6\n"
+    "ld a5,24(%[b])\n"
+    "mul t4,a3,a5\n"
+    "mulhu t5,a3,a5\n"
+    "add t2,t2,t4\n"
+    "sltu t6,t2,t4\n"
+    "add t3,t3,t5\n"
+    "add t3,t3,t6\n"
+    "ld a5,16(%[b])\n"
+    "mul t4,a4,a5\n"
+    "mulhu t5,a4,a5\n"
+    "add t2,t2,t4\n"
+    "sltu t6,t2,t4\n"
+    "add t3,t3,t5\n"
+    "add t3,t3,t6\n"
+    /* c += (d & M) * R */
+    "and t6,t2,a6\n"
+    "mul t4,t6,a7\n"
+    "mulhu t5,t6,a7\n"
+    "add t0,t0,t4\n"
+    "sltu t6,t0,t4\n"
+    "add t1,t1,t5\n"
+    "add t1,t1,t6\n"
+    /* d >>= 52 (t2 only) */
+    "srli t2,t2,52\n"
+    "slli t3,t3,12\n"
+    "or t2,t2,t3\n"
+    /* r[1] = c & M */
+    "and t6,t0,a6\n"
+    "sd t6,8(%[r])\n"
+    /* c >>= 52 (t0 only) */
+    "srli t0,t0,52\n"
+    "slli t1,t1,12\n"
+    "or t0,t0,t1\n"
+    /* c += a0 * b2 + a1 * b1 + a2 * b0 */
+    "ld a5,16(%[b])\n"
+    "mul t4,a0,a5\n"
+    "mulhu t1,a0,a5\n"
+    "add t0,t0,t4\n"
+    "sltu t6,t0,t4\n"
+    "add t1,t1,t6\n"
+    "ld a5,8(%[b])\n"
+    "mul t4,a1,a5\n"
+    "mulhu t5,a1,a5\n"
+    "add t0,t0,t4\n"
+    "sltu t6,t0,t4\n"
+    "add t1,t1,t5\n"
+    "add t1,t1,t6\n"
+    "ld a5,0(%[b])\n"
+    "mul t4,a2,a5\n"
+    "mulhu t5,a2,a5\n"
+    "add t0,t0,t4\n"
+    "sltu t6,t0,t4\n"
+    "add t1,t1,t5\n"
+    "add t1,t1,t6\n"
+    /* d += a3 * b4 + a4 * b3 */
+    "ld a5,32(%[b])\n"
+    "mul t4,a3,a5\n"
+    "mulhu t3,a3,a5\n"
+    "add t2,t2,t4\n"
+    "sltu t6,t2,t4\n"
+    "add t3,t3,t6\n"
+    "ld a5,24(%[b])\n"
+    "mul t4,a4,a5\n"
+    "mulhu t5,a4,a5\n"
+    "add t2,t2,t4\n"
+    "sltu t6,t2,t4\n"
+    "add t3,t3,t5\n"
+    "add t3,t3,t6\n"
+    /* c += (d & M) * R */
+    "and t6,t2,a6\n"
+    "mul t4,t6,a7\n"
+    "mulhu t5,t6,a7\n"
+    "add t0,t0,t4\n"
+    "sltu t6,t0,t4\n"
+    "add t1,t1,t5\n"
+    "add t1,t1,t6\n"
+    /* d >>= 52 (t2 only) */
+    "srli t2,t2,52\n"
+    "slli t3,t3,12\n"
+    "or t2,t2,t3\n"
+    /* r[2] = c & M */
+    "and t6,t0,a6\n"
+    "sd t6,16(%[r])\n"
+    /* c >>= 52 (t0 only) */
+    "srli t0,t0,52\n"
+    "slli t1,t1,12\n"
+    "or t0,t0,t1\n"
+    /* c += d * R + t3 */
+    "mul t4,t2,a7\n"
+    "mulhu t1,t2,a7\n"
+    "add t0,t0,t4\n"
+    "sltu t6,t0,t4\n"
+    "add t1,t1,t6\n"
+    "add t0,t0,s1\n"
+    "sltu t6,t0,s1\n"
+    "add t1,t1,t6\n"
+    /* r[3] = c & M */
+    "and t6,t0,a6\n"
+    "sd t6,24(%[r])\n"
+    /* c >>= 52 (t0 only) */
+    "srli t0,t0,52\n"
+    "slli t1,t1,12\n"
+    "or t0,t0,t1\n"
+    /* c += t4, r[4] = c */
+    "add t0,t0,s2\n"
+    "sd t0,32(%[r])\n"
+:
+: [r]"r"(r), [a]"r"(a), [b]"r"(b)
+: "t0", "t1", "t2", "t3", "t4", "t5", "t6", "a0", "a1", "a2", "a3", "a4", "a5", "a6", "a7", "s1", "s2", "s3", "memory"
+);
+}
+
+SECP256K1_INLINE static void secp256k1_fe_sqr_inner(uint64_t *r, const uint64_t *a) {
+/**
+ * Registers: t5:t4 = multiplication accumulator
+ *            t1:t0 = c
+ *            t3:t2 = d
+ *            t6    = carry
+ *            a0-a4 = a0-a4
+ *            a5    = a[i]*2
+ *            a6    = M
+ *            a7    = R
+ *            s1    = t3
+ *            s2    = t4
+ *            s3    = tx
+ */
+__asm__ __volatile__(
+    "ld a0,0(%[a])\n"
+    "ld a1,8(%[a])\n"
+    "ld a2,16(%[a])\n"
+    "ld a3,24(%[a])\n"
+    "ld a4,32(%[a])\n"
+    /* M = 0xfffffffffffff, R = 0x1000003d10 */
+    "li a6,-1\n"
+    "srli a6,a6,12\n"
+    "li a7,0x1000003d10\n"
+    /* d = (a0*2) * a3 + (a1*2) * a2 */
+    "slli a5,a0,1\n"
+    "mul t2,a5,a3\n"
+    "mulhu t3,a5,a3\n"
+    "slli a5,a1,1\n"
+    "mul t4,a5,a2\n"
+    "mulhu t5,a5,a2\n"
+    "add t2,t2,t4\n"
+    "sltu t6,t2,t4\n"
+    "add t3,t3,t5\n"
+    "add t3,t3,t6\n"
+    /* c = a4 * a4 */
+    "mul t0,a4,a4\n"
+    "mulhu t1,a4,a4\n"
+    /* d += (c & M) * R */
+    "and t6,t0,a6\n"
+    "mul t4,t6,a7\n"
+    "mulhu t5,t6,a7\n"
+    "add t2,t2,t4\n"
+    "sltu t6,t2,t4\n"
+    "add t3,t3,t5\n"
+    "add t3,t3,t6\n"
+    /* c >>= 52 (t0 only) */
+    "srli t0,t0,52\n"
+    "slli t1,t1,12\n"
+    "or t0,t0,t1\n"
+    /* t3 = d & M */
+    "and s1,t2,a6\n"
+    /* d >>= 52 (t2 only) */
+    "srli t2,t2,52\n"
+    "slli t3,t3,12\n"
+    "or t2,t2,t3\n"
+    /* a4 *= 2 */
+    "slli a4,a4,1\n"
+    /* d += a0 * a4 + (a1*2) * a3 + a2 * a2 */
+    "mul t4,a0,a4\n"
+    "mulhu t3,a0,a4\n"
+    "add t2,t2,t4\n"
+    "sltu t6,t2,t4\n"
+    "add t3,t3,t6\n"
+    "slli a5,a1,1\n"
+    "mul t4,a5,a3\n"
+    "mulhu t5,a5,a3\n"
+    "add t2,t2,t4\n"
+    "sltu t6,t2,t4\n"
+    "add t3,t3,t5\n"
+    "add t3,t3,t6\n"
+    "mul t4,a2,a2\n"
+    "mulhu t5,a2,a2\n"
+    "add t2,t2,t4\n"
+    "sltu t6,t2,t4\n"
+    "add t3,t3,t5\n"
+    "add t3,t3,t6\n"
+    /* d += c * R */
+    "mul t4,t0,a7\n"
+    "mulhu t5,t0,a7\n"
+    "add t2,t2,t4\n"
+    "sltu t6,t2,t4\n"
+    "add t3,t3,t5\n"
+    "add t3,t3,t6\n"
+    /* t4 = d & M */
+    "and s2,t2,a6\n"
+    /* d >>= 52 (t2 only) */
+    "srli t2,t2,52\n"
+    "slli t3,t3,12\n"
+    "or t2,t2,t3\n"
+    /* tx = t4 >> 48, t4 &= (M >> 4) */
+    "srli s3,s2,48\n"
+    "slli s2,s2,16\n"
+    "srli s2,s2,16\n"
+    /* c = a0 * a0 */
+    "mul t0,a0,a0\n"
+    "mulhu t1,a0,a0\n"
+    /* d += a1 * a4 + (a2*2) * a3 */
+    "mul t4,a1,a4\n"
+    "mulhu t3,a1,a4\n"
+    "add t2,t2,t4\n"
+    "sltu t6,t2,t4\n"
+    "add t3,t3,t6\n"
+    "slli a5,a2,1\n"
+    "mul t4,a5,a3\n"
+    "mulhu t5,a5,a3\n"
+    "add t2,t2,t4\n"
+    "sltu t6,t2,t4\n"
+    "add t3,t3,t5\n"
+    "add t3,t3,t6\n"
+    /* u0 = d & M */
+    "and t6,t2,a6\n"
+    /* d >>= 52 (t2 only) */
+    "srli t2,t2,52\n"
+    "slli t3,t3,12\n"
+    "or t2,t2,t3\n"
+    /* u0 = (u0 << 4) | tx */
+    "slli t6,t6,4\n"
+    "or t6,t6,s3\n"
+    /* c += u0 * (R >> 4) */
+    "srli a5,a7,4\n"
+    "mul t4,t6,a5\n"
+    "mulhu t5,t6,a5\n"
+    "add t0,t0,t4\n"
+    "sltu t6,t0,t4\n"
+    "add t1,t1,t5\n"
+    "add t1,t1,t6\n"
+    /* r[0] = c & M */
+    "and t6,t0,a6\n"
+    "sd t6,0(%[r])\n"
+    /* c >>= 52 (t0 only) */
+    "srli t0,t0,52\n"
+    "slli t1,t1,12\n"
+    "or t0,t0,t1\n"
+    /* a0 *= 2 */
+    "slli a0,a0,1\n"
+    /* c += a0 * a1 */
+    "mul t4,a0,a1\n"
+    "mulhu t1,a0,a1\n"
+    "add t0,t0,t4\n"
+    "sltu t6,t0,t4\n"
+    "add t1,t1,t6\n"
+    /* d += a2 * a4 + a3 * a3 */
+    "mul t4,a2,a4\n"
+    "mulhu t3,a2,a4\n"
+    "add t2,t2,t4\n"
+    "sltu t6,t2,t4\n"
+    "add t3,t3,t6\n"
+    "mul t4,a3,a3\n"
+    "mulhu t5,a3,a3\n"
+    "add t2,t2,t4\n"
+    "sltu t6,t2,t4\n"
+    "add t3,t3,t5\n"
+    "add t3,t3,t6\n"
+    /* c += (d & M) * R */
+    "and t6,t2,a6\n"
+    "mul t4,t6,a7\n"
+    "mulhu t5,t6,a7\n"
+    "add t0,t0,t4\n"
+    "sltu t6,t0,t4\n"
+    "add t1,t1,t5\n"
+    "add t1,t1,t6\n"
+    /* d >>= 52 (t2 only) */
+    "srli t2,t2,52\n"
+    "slli t3,t3,12\n"
+    "or t2,t2,t3\n"
+    /* r[1] = c & M */
+    "and t6,t0,a6\n"
+    "sd t6,8(%[r])\n"
+    /* c >>= 52 (t0 only) */
+    "srli t0,t0,52\n"
+    "slli t1,t1,12\n"
+    "or t0,t0,t1\n"
+    /* c += a0 * a2 + a1 * a1 */
+    "mul t4,a0,a2\n"
+    "mulhu t1,a0,a2\n"
+    "add t0,t0,t4\n"
+    "sltu t6,t0,t4\n"
+    "add t1,t1,t6\n"
+    "mul t4,a1,a1\n"
+    "mulhu t5,a1,a1\n"
+    "add t0,t0,t4\n"
+    "sltu t6,t0,t4\n"
+    "add t1,t1,t5\n"
+    "add t1,t1,t6\n"
+    /* d += a3 * a4 */
+    "mul t4,a3,a4\n"
+    "mulhu t3,a3,a4\n"
+    "add t2,t2,t4\n"
+    "sltu t6,t2,t4\n"
+    "add t3,t3,t6\n"
+    /* c += (d & M) * R */
+    "and t6,t2,a6\n"
+    "mul t4,t6,a7\n"
+    "mulhu t5,t6,a7\n"
+    "add t0,t0,t4\n"
+    "sltu t6,t0,t4\n"
+    "add t1,t1,t5\n"
+    "add t1,t1,t6\n"
+    /* d >>= 52 (t2 only) */
+    "srli t2,t2,52\n"
+    "slli t3,t3,12\n"
+    "or t2,t2,t3\n"
+    /* r[2] = c & M */
+    "and t6,t0,a6\n"
+    "sd t6,16(%[r])\n"
+    /* c >>= 52 (t0 only) */
+    "srli t0,t0,52\n"
+    "slli t1,t1,12\n"
+    "or t0,t0,t1\n"
+    /* c += d * R + t3 */
+    "mul t4,t2,a7\n"
+    "mulhu t1,t2,a7\n"
+    "add t0,t0,t4\n"
+    "sltu t6,t0,t4\n"
+    "add t1,t1,t6\n"
+    "add t0,t0,s1\n"
+    "sltu t6,t0,s1\n"
+    "add t1,t1,t6\n"
+    /* r[3] = c & M */
+    "and t6,t0,a6\n"
+    "sd t6,24(%[r])\n"
+    /* c >>= 52 (t0 only) */
+    "srli t0,t0,52\n"
+    "slli t1,t1,12\n"
+    "or t0,t0,t1\n"
+    /* c += t4, r[4] = c */
+    "add t0,t0,s2\n"
+    "sd t0,32(%[r])\n"
+:
+: [r]"r"(r), [a]"r"(a)
+: "t0", "t1", "t2", "t3", "t4", "t5", "t6", "a0", "a1", "a2", "a3", "a4", "a5", "a6", "a7", "s1", "s2", "s3", "memory"
+);
+}
+
+#endif /* SECP256K1_FIELD_INNER5X52_IMPL_H */
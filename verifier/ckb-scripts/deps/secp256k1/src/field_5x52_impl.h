@@ -16,6 +16,8 @@
 
 #if defined(USE_ASM_X86_64)
 #include "field_5x52_asm_impl.h"
+#elif defined(USE_ASM_RISCV64)
+#include "field_5x52_asm_riscv64_impl.h"
 #else
 #include "field_5x52_int128_impl.h"
 #endif
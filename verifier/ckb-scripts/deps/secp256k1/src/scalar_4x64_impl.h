@@ -503,6 +503,239 @@ static void secp256k1_scalar_reduce_512(secp256k1_scalar *r, const uint64_t *l)
     : "=g"(c)
     : "g"(p0), "g"(p1), "g"(p2), "g"(p3), "g"(p4), "D"(r), "i"(SECP256K1_N_C_0), "i"(SECP256K1_N_C_1)
     : "rax", "rdx", "r8", "r9", "r10", "cc", "memory");
+#elif defined(USE_ASM_RISCV64)
+    /* RV64IM version of the portable code below. The (c0,c1,c2) accumulator
+     * rotates through registers instead of being moved on every extract, and
+     * every carry is recovered with sltu. */
+    uint64_t c;
+
+    __asm__ __volatile__(
+    /* Preload n0..n3 and the limbs of SECP256K1_N_C */
+    "ld t4,32(%[l])\n"
+    "ld t5,40(%[l])\n"
+    "ld t6,48(%[l])\n"
+    "ld a2,56(%[l])\n"
+    "li t2,0x402DA1732FC9BEBF\n"
+    "li t3,0x4551231950B75FC4\n"
+    /* Reduce 512 bits into 385. m[0..6] = l[0..3] + n[0..3] * SECP256K1_N_C */
+    "ld a3,0(%[l])\n"
+    "li a4,0\n"
+    /* (c0,c1) += n0 * c0 */
+    "mul t0,t4,t2\n"
+    "mulhu t1,t4,t2\n"
+    "add a3,a3,t0\n"
+    "sltu t0,a3,t0\n"
+    "add t1,t1,t0\n"
+    "add a4,a4,t1\n"
+    "li a5,0\n"
+    /* (c0,c1,c2) += l1 + n1 * c0 + n0 * c1 */
+    "li a6,0\n"
+    "ld a7,8(%[l])\n"
+    "add a4,a4,a7\n"
+    "sltu t0,a4,a7\n"
+    "add a5,a5,t0\n"
+    "mul t0,t5,t2\n"
+    "mulhu t1,t5,t2\n"
+    "add a4,a4,t0\n"
+    "sltu t0,a4,t0\n"
+    "add t1,t1,t0\n"
+    "add a5,a5,t1\n"
+    "sltu t1,a5,t1\n"
+    "add a6,a6,t1\n"
+    "mul t0,t4,t3\n"
+    "mulhu t1,t4,t3\n"
+    "add a4,a4,t0\n"
+    "sltu t0,a4,t0\n"
+    "add t1,t1,t0\n"
+    "add a5,a5,t1\n"
+    "sltu t1,a5,t1\n"
+    "add a6,a6,t1\n"
+    "li a7,0\n"
+    /* (c0,c1,c2) += l2 + n2 * c0 + n1 * c1 + n0 */
+    "ld s2,16(%[l])\n"
+    "add a5,a5,s2\n"
+    "sltu t0,a5,s2\n"
+    "add a6,a6,t0\n"
+    "sltu t0,a6,t0\n"
+    "add a7,a7,t0\n"
+    "mul t0,t6,t2\n"
+    "mulhu t1,t6,t2\n"
+    "add a5,a5,t0\n"
+    "sltu t0,a5,t0\n"
+    "add t1,t1,t0\n"
+    "add a6,a6,t1\n"
+    "sltu t1,a6,t1\n"
+    "add a7,a7,t1\n"
+    "mul t0,t5,t3\n"
+    "mulhu t1,t5,t3\n"
+    "add a5,a5,t0\n"
+    "sltu t0,a5,t0\n"
+    "add t1,t1,t0\n"
+    "add a6,a6,t1\n"
+    "sltu t1,a6,t1\n"
+    "add a7,a7,t1\n"
+    "add a5,a5,t4\n"
+    "sltu t0,a5,t4\n"
+    "add a6,a6,t0\n"
+    "sltu t0,a6,t0\n"
+    "add a7,a7,t0\n"
+    "li t4,0\n"
+    /* (c0,c1,c2) += l3 + n3 * c0 + n2 * c1 + n1 */
+    "ld s2,24(%[l])\n"
+    "add a6,a6,s2\n"
+    "sltu t0,a6,s2\n"
+    "add a7,a7,t0\n"
+    "sltu t0,a7,t0\n"
+    "add t4,t4,t0\n"
+    "mul t0,a2,t2\n"
+    "mulhu t1,a2,t2\n"
+    "add a6,a6,t0\n"
+    "sltu t0,a6,t0\n"
+    "add t1,t1,t0\n"
+    "add a7,a7,t1\n"
+    "sltu t1,a7,t1\n"
+    "add t4,t4,t1\n"
+    "mul t0,t6,t3\n"
+    "mulhu t1,t6,t3\n"
+    "add a6,a6,t0\n"
+    "sltu t0,a6,t0\n"
+    "add t1,t1,t0\n"
+    "add a7,a7,t1\n"
+    "sltu t1,a7,t1\n"
+    "add t4,t4,t1\n"
+    "add a6,a6,t5\n"
+    "sltu t0,a6,t5\n"
+    "add a7,a7,t0\n"
+    "sltu t0,a7,t0\n"
+    "add t4,t4,t0\n"
+    "li t5,0\n"
+    /* (c0,c1,c2) += n3 * c1 + n2 */
+    "mul t0,a2,t3\n"
+    "mulhu t1,a2,t3\n"
+    "add a7,a7,t0\n"
+    "sltu t0,a7,t0\n"
+    "add t1,t1,t0\n"
+    "add t4,t4,t1\n"
+    "sltu t1,t4,t1\n"
+    "add t5,t5,t1\n"
+    "add a7,a7,t6\n"
+    "sltu t0,a7,t6\n"
+    "add t4,t4,t0\n"
+    "sltu t0,t4,t0\n"
+    "add t5,t5,t0\n"
+    "li t6,0\n"
+    /* (c0,c1) += n3 */
+    "add t4,t4,a2\n"
+    "sltu t0,t4,a2\n"
+    "add t5,t5,t0\n"
+    /* Reduce 385 bits into 258. p[0..4] = m[0..3] + m[4..6] * SECP256K1_N_C */
+    "li t6,0\n"
+    /* (c0,c1) += m4 * c0 */
+    "mul t0,a7,t2\n"
+    "mulhu t1,a7,t2\n"
+    "add a3,a3,t0\n"
+    "sltu t0,a3,t0\n"
+    "add t1,t1,t0\n"
+    "add t6,t6,t1\n"
+    "li a2,0\n"
+    /* (c0,c1,c2) += m1 + m5 * c0 + m4 * c1 */
+    "li s2,0\n"
+    "add t6,t6,a4\n"
+    "sltu t0,t6,a4\n"
+    "add a2,a2,t0\n"
+    "mul t0,t4,t2\n"
+    "mulhu t1,t4,t2\n"
+    "add t6,t6,t0\n"
+    "sltu t0,t6,t0\n"
+    "add t1,t1,t0\n"
+    "add a2,a2,t1\n"
+    "sltu t1,a2,t1\n"
+    "add s2,s2,t1\n"
+    "mul t0,a7,t3\n"
+    "mulhu t1,a7,t3\n"
+    "add t6,t6,t0\n"
+    "sltu t0,t6,t0\n"
+    "add t1,t1,t0\n"
+    "add a2,a2,t1\n"
+    "sltu t1,a2,t1\n"
+    "add s2,s2,t1\n"
+    "li a4,0\n"
+    /* (c0,c1,c2) += m2 + m6 * c0 + m5 * c1 + m4 */
+    "add a2,a2,a5\n"
+    "sltu t0,a2,a5\n"
+    "add s2,s2,t0\n"
+    "sltu t0,s2,t0\n"
+    "add a4,a4,t0\n"
+    "mul t0,t5,t2\n"
+    "mulhu t1,t5,t2\n"
+    "add a2,a2,t0\n"
+    "sltu t0,a2,t0\n"
+    "add t1,t1,t0\n"
+    "add s2,s2,t1\n"
+    "sltu t1,s2,t1\n"
+    "add a4,a4,t1\n"
+    "mul t0,t4,t3\n"
+    "mulhu t1,t4,t3\n"
+    "add a2,a2,t0\n"
+    "sltu t0,a2,t0\n"
+    "add t1,t1,t0\n"
+    "add s2,s2,t1\n"
+    "sltu t1,s2,t1\n"
+    "add a4,a4,t1\n"
+    "add a2,a2,a7\n"
+    "sltu t0,a2,a7\n"
+    "add s2,s2,t0\n"
+    "sltu t0,s2,t0\n"
+    "add a4,a4,t0\n"
+    "li a7,0\n"
+    /* (c0,c1) += m3 + m6 * c1 + m5 */
+    "add s2,s2,a6\n"
+    "sltu t0,s2,a6\n"
+    "add a4,a4,t0\n"
+    "mul t0,t5,t3\n"
+    "mulhu t1,t5,t3\n"
+    "add s2,s2,t0\n"
+    "sltu t0,s2,t0\n"
+    "add t1,t1,t0\n"
+    "add a4,a4,t1\n"
+    "add s2,s2,t4\n"
+    "sltu t0,s2,t4\n"
+    "add a4,a4,t0\n"
+    /* p4 = c0 + m6 */
+    "add a4,a4,t5\n"
+    /* Reduce 258 bits into 256. r[0..3] = p[0..3] + p4 * SECP256K1_N_C */
+    /* (c0,c1) = p0 + p4 * c0 */
+    "mul t0,a4,t2\n"
+    "mulhu t1,a4,t2\n"
+    "add t0,t0,a3\n"
+    "sltu a3,t0,a3\n"
+    "add t1,t1,a3\n"
+    "sd t0,0(%[r])\n"
+    /* (c0,c1) += p1 + p4 * c1 */
+    "add t1,t1,t6\n"
+    "sltu t6,t1,t6\n"
+    "mul t0,a4,t3\n"
+    "mulhu a3,a4,t3\n"
+    "add t1,t1,t0\n"
+    "sltu t0,t1,t0\n"
+    "add t6,t6,a3\n"
+    "add t6,t6,t0\n"
+    "sd t1,8(%[r])\n"
+    /* (c0,c1) += p2 + p4 */
+    "add a2,a2,t6\n"
+    "sltu t6,a2,t6\n"
+    "add a2,a2,a4\n"
+    "sltu t0,a2,a4\n"
+    "add t6,t6,t0\n"
+    "sd a2,16(%[r])\n"
+    /* (c0,c1) += p3 */
+    "add s2,s2,t6\n"
+    "sltu t6,s2,t6\n"
+    "sd s2,24(%[r])\n"
+    "mv %[c],t6\n"
+    : [c] "=&r"(c)
+    : [l] "r"(l), [r] "r"(r->d)
+    : "t0", "t1", "t2", "t3", "t4", "t5", "t6", "a2", "a3", "a4", "a5", "a6", "a7", "s2", "memory");
 #else
     uint128_t c;
     uint64_t c0, c1, c2;
@@ -17,6 +17,19 @@
 #define USE_EXTERNAL_DEFAULT_CALLBACKS
 #include <secp256k1.c>
 
+/*
+ * The data cell holds tables for a single window size, scripts must be built
+ * against the secp256k1_data_info.h generated for the same window. The sizes
+ * in it are those of the tables the generator actually produced, so they are
+ * checked against the size pre_g is indexed with as well.
+ */
+#if CKB_SECP256K1_DATA_WINDOW != ECMULT_WINDOW_SIZE
+#error "secp256k1_data_info.h does not match ECMULT_WINDOW_SIZE"
+#endif
+_Static_assert(CKB_SECP256K1_DATA_PRE_SIZE ==
+                   ECMULT_TABLE_SIZE(WINDOW_G) * sizeof(secp256k1_ge_storage),
+               "secp256k1 data tables were not generated for ECMULT_WINDOW_SIZE");
+
 void secp256k1_default_illegal_callback_fn(const char* str, void* data) {
   (void)str;
   (void)data;
@@ -0,0 +1,274 @@
+#ifndef CKB_HOST_H_
+#define CKB_HOST_H_
+
+// In-memory transaction for running the scripts on the host.
+//
+// Tests build with -DCKB_HOST_SYSCALLS, which makes ckb_syscalls.h send every
+// syscall to ckb_host_syscall below. A test fills ckb_host_tx with cells,
+// witnesses and the script being run, then calls the script's main, renamed
+// with a define before the script is included.
+//
+// Only the syscalls the scripts use are answered, anything else aborts. Group
+// sources are the cells whose lock, or type when script_is_type is set, is
+// the running script.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// The system string.h lacks the hash32_eq of the vendored libc
+static inline int hash32_eq(const void *a, const void *b) {
+  return memcmp(a, b, 32) == 0;
+}
+
+#include "blake2b.h"
+#include "ckb_syscalls.h"
+
+#define CKB_HOST_MAX_CELLS 16
+#define CKB_HOST_MAX_SCRIPT_SIZE 256
+#define CKB_HOST_MAX_DATA_SIZE 1024
+#define CKB_HOST_MAX_WITNESS_SIZE 1024
+#define CKB_HOST_HASH_SIZE 32
+
+typedef struct {
+  uint64_t capacity;
+  uint8_t lock[CKB_HOST_MAX_SCRIPT_SIZE];
+  size_t lock_len;
+  // A cell without a type script has type_len 0
+  uint8_t type[CKB_HOST_MAX_SCRIPT_SIZE];
+  size_t type_len;
+  uint8_t data[CKB_HOST_MAX_DATA_SIZE];
+  size_t data_len;
+} CkbHostCell;
+
+typedef struct {
+  CkbHostCell cells[CKB_HOST_MAX_CELLS];
+  size_t count;
+} CkbHostCells;
+
+typedef struct {
+  CkbHostCells inputs;
+  CkbHostCells outputs;
+  CkbHostCells deps;
+  uint8_t witnesses[CKB_HOST_MAX_CELLS][CKB_HOST_MAX_WITNESS_SIZE];
+  size_t witness_lens[CKB_HOST_MAX_CELLS];
+  size_t witness_count;
+  uint8_t script[CKB_HOST_MAX_SCRIPT_SIZE];
+  size_t script_len;
+  int script_is_type;
+} CkbHostTx;
+
+CkbHostTx ckb_host_tx;
+
+void ckb_host_reset() { memset(&ckb_host_tx, 0, sizeof(ckb_host_tx)); }
+
+void ckb_host_hash(const uint8_t *buf, size_t len, uint8_t *hash) {
+  blake2b_state ctx;
+  blake2b_init(&ctx, CKB_HOST_HASH_SIZE);
+  blake2b_update(&ctx, buf, len);
+  blake2b_final(&ctx, hash, CKB_HOST_HASH_SIZE);
+}
+
+static void ckb_host_pack(uint8_t *dst, uint32_t value) {
+  memcpy(dst, &value, sizeof(value));
+}
+
+// Serializes a Script into script, returning its length
+size_t ckb_host_script(uint8_t *script, const uint8_t *code_hash,
+                       uint8_t hash_type, const uint8_t *args,
+                       size_t args_len) {
+  uint32_t header = 4 * 4;
+  uint32_t args_offset = header + CKB_HOST_HASH_SIZE + 1;
+  uint32_t total = args_offset + 4 + args_len;
+  if (total > CKB_HOST_MAX_SCRIPT_SIZE) {
+    fprintf(stderr, "host script too large\n");
+    abort();
+  }
+  ckb_host_pack(script, total);
+  ckb_host_pack(script + 4, header);
+  ckb_host_pack(script + 8, header + CKB_HOST_HASH_SIZE);
+  ckb_host_pack(script + 12, args_offset);
+  memcpy(script + header, code_hash, CKB_HOST_HASH_SIZE);
+  script[header + CKB_HOST_HASH_SIZE] = hash_type;
+  ckb_host_pack(script + args_offset, args_len);
+  memcpy(script + args_offset + 4, args, args_len);
+  return total;
+}
+
+// Appends an empty cell to source
+CkbHostCell *ckb_host_add_cell(size_t source) {
+  CkbHostCells *cells = source == CKB_SOURCE_INPUT    ? &ckb_host_tx.inputs
+                        : source == CKB_SOURCE_OUTPUT ? &ckb_host_tx.outputs
+                                                      : &ckb_host_tx.deps;
+  if (cells->count == CKB_HOST_MAX_CELLS) {
+    fprintf(stderr, "too many host cells\n");
+    abort();
+  }
+  return &cells->cells[cells->count++];
+}
+
+static int ckb_host_in_group(CkbHostCell *cell) {
+  if (ckb_host_tx.script_is_type) {
+    return cell->type_len == ckb_host_tx.script_len &&
+           memcmp(cell->type, ckb_host_tx.script, cell->type_len) == 0;
+  }
+  return cell->lock_len == ckb_host_tx.script_len &&
+         memcmp(cell->lock, ckb_host_tx.script, cell->lock_len) == 0;
+}
+
+// Resolves index in source to a cell and its index among the inputs or
+// outputs. Returns NULL past the last cell.
+static CkbHostCell *ckb_host_cell(size_t index, size_t source,
+                                  size_t *tx_index) {
+  CkbHostCells *cells;
+  int group = 0;
+  switch (source) {
+    case CKB_SOURCE_INPUT:
+      cells = &ckb_host_tx.inputs;
+      break;
+    case CKB_SOURCE_OUTPUT:
+      cells = &ckb_host_tx.outputs;
+      break;
+    case CKB_SOURCE_CELL_DEP:
+      cells = &ckb_host_tx.deps;
+      break;
+    case CKB_SOURCE_GROUP_INPUT:
+      cells = &ckb_host_tx.inputs;
+      group = 1;
+      break;
+    case CKB_SOURCE_GROUP_OUTPUT:
+      cells = &ckb_host_tx.outputs;
+      group = 1;
+      break;
+    default:
+      fprintf(stderr, "unsupported host source %zx\n", source);
+      abort();
+  }
+  for (size_t i = 0; i < cells->count; i++) {
+    if (group && !ckb_host_in_group(&cells->cells[i])) {
+      continue;
+    }
+    if (index == 0) {
+      *tx_index = i;
+      return &cells->cells[i];
+    }
+    index--;
+  }
+  return NULL;
+}
+
+// Partial loading: copies what fits in *len from offset, and reports the full
+// remaining length
+static long ckb_host_copy(void *addr, volatile uint64_t *len, size_t offset,
+                          const void *src, size_t size) {
+  if (offset > size) {
+    offset = size;
+  }
+  size_t remaining = size - offset;
+  memcpy(addr, (const uint8_t *)src + offset,
+         *len < remaining ? *len : remaining);
+  *len = remaining;
+  return CKB_SUCCESS;
+}
+
+static long ckb_host_load_cell_by_field(void *addr, volatile uint64_t *len,
+                                        size_t offset, size_t index,
+                                        size_t source, size_t field) {
+  size_t tx_index;
+  CkbHostCell *cell = ckb_host_cell(index, source, &tx_index);
+  if (cell == NULL) {
+    return CKB_INDEX_OUT_OF_BOUND;
+  }
+  uint8_t hash[CKB_HOST_HASH_SIZE];
+  switch (field) {
+    case CKB_CELL_FIELD_CAPACITY:
+      return ckb_host_copy(addr, len, offset, &cell->capacity,
+                           sizeof(cell->capacity));
+    case CKB_CELL_FIELD_DATA_HASH:
+      ckb_host_hash(cell->data, cell->data_len, hash);
+      return ckb_host_copy(addr, len, offset, hash, sizeof(hash));
+    case CKB_CELL_FIELD_LOCK:
+      return ckb_host_copy(addr, len, offset, cell->lock, cell->lock_len);
+    case CKB_CELL_FIELD_LOCK_HASH:
+      ckb_host_hash(cell->lock, cell->lock_len, hash);
+      return ckb_host_copy(addr, len, offset, hash, sizeof(hash));
+    case CKB_CELL_FIELD_TYPE:
+      if (cell->type_len == 0) {
+        return CKB_ITEM_MISSING;
+      }
+      return ckb_host_copy(addr, len, offset, cell->type, cell->type_len);
+    case CKB_CELL_FIELD_TYPE_HASH:
+      if (cell->type_len == 0) {
+        return CKB_ITEM_MISSING;
+      }
+      ckb_host_hash(cell->type, cell->type_len, hash);
+      return ckb_host_copy(addr, len, offset, hash, sizeof(hash));
+    default:
+      fprintf(stderr, "unsupported host cell field %zu\n", field);
+      abort();
+  }
+}
+
+static long ckb_host_load_witness(void *addr, volatile uint64_t *len,
+                                  size_t offset, size_t index, size_t source) {
+  // Witnesses line up with inputs, so a group index maps to its input index
+  if (source == CKB_SOURCE_GROUP_INPUT) {
+    if (ckb_host_cell(index, source, &index) == NULL) {
+      return CKB_INDEX_OUT_OF_BOUND;
+    }
+  }
+  if (index >= ckb_host_tx.witness_count) {
+    return CKB_INDEX_OUT_OF_BOUND;
+  }
+  return ckb_host_copy(addr, len, offset, ckb_host_tx.witnesses[index],
+                       ckb_host_tx.witness_lens[index]);
+}
+
+long ckb_host_syscall(long n, long a0, long a1, long a2, long a3, long a4,
+                      long a5) {
+  void *addr = (void *)a0;
+  volatile uint64_t *len = (volatile uint64_t *)a1;
+  size_t tx_index;
+  CkbHostCell *cell;
+  uint8_t hash[CKB_HOST_HASH_SIZE];
+
+  switch (n) {
+    case SYS_ckb_load_script:
+      return ckb_host_copy(addr, len, a2, ckb_host_tx.script,
+                           ckb_host_tx.script_len);
+    case SYS_ckb_load_script_hash:
+      ckb_host_hash(ckb_host_tx.script, ckb_host_tx.script_len, hash);
+      return ckb_host_copy(addr, len, a2, hash, sizeof(hash));
+    case SYS_ckb_load_cell_by_field:
+      return ckb_host_load_cell_by_field(addr, len, a2, a3, a4, a5);
+    case SYS_ckb_load_cell_data:
+      cell = ckb_host_cell(a3, a4, &tx_index);
+      if (cell == NULL) {
+        return CKB_INDEX_OUT_OF_BOUND;
+      }
+      return ckb_host_copy(addr, len, a2, cell->data, cell->data_len);
+    case SYS_ckb_load_witness:
+      return ckb_host_load_witness(addr, len, a2, a3, a4);
+    case SYS_ckb_debug:
+      if (getenv("CKB_HOST_DEBUG") != NULL) {
+        fprintf(stderr, "%s\n", (const char *)addr);
+      }
+      return CKB_SUCCESS;
+    default:
+      fprintf(stderr, "unsupported host syscall %ld\n", n);
+      abort();
+  }
+}
+
+// Checks a script's exit code, counting failures in ckb_host_failures
+int ckb_host_failures;
+
+void ckb_host_expect(const char *name, int actual, int expected) {
+  if (actual == expected) {
+    printf("ok   %s\n", name);
+  } else {
+    printf("FAIL %s: got %d, expected %d\n", name, actual, expected);
+    ckb_host_failures++;
+  }
+}
+
+#endif /* CKB_HOST_H_ */
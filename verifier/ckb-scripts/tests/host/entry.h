@@ -0,0 +1,7 @@
+#ifndef CKB_HOST_ENTRY_H_
+#define CKB_HOST_ENTRY_H_
+
+// Stands in for the vendored libc/entry.h when a vendored libc header is
+// built on the host, where the C runtime provides _start
+
+#endif /* CKB_HOST_ENTRY_H_ */
@@ -0,0 +1,123 @@
+// Host tests of the credit type's top-up path, see tests/ckb_host.h
+#include "ckb_host.h"
+
+#define main credit_type_main
+#include "reuse_coin_credit_type.c"
+#undef main
+
+static const uint8_t WALLET_CODE_HASH[32] = {1};
+static const uint8_t CREDIT_CODE_HASH[32] = {2};
+static const uint8_t TOKEN_CODE_HASH[32] = {3};
+static const uint8_t SCRIPT_CODE_HASH[32] = {4};
+
+static uint8_t wallet_lock[CKB_HOST_MAX_SCRIPT_SIZE];
+static size_t wallet_lock_len;
+static uint8_t wallet_lock_hash[32];
+static uint8_t token_type[CKB_HOST_MAX_SCRIPT_SIZE];
+static size_t token_type_len;
+
+static void setup_wallet() {
+  uint8_t token_args[32] = {9};
+  token_type_len = ckb_host_script(token_type, TOKEN_CODE_HASH, 1, token_args,
+                                   sizeof(token_args));
+
+  // Legacy wallet args: pubkey hash, ckb rate, udt rate of 5, token type hash
+  uint8_t args[MIN_ARGS_LENGTH] = {0};
+  uint128_t udt_rate = 5;
+  memcpy(&args[BLAKE160_SIZE + CAPACITY_SIZE], &udt_rate, BALANCE_SIZE);
+  ckb_host_hash(token_type, token_type_len,
+                &args[BLAKE160_SIZE + CAPACITY_SIZE + BALANCE_SIZE]);
+  wallet_lock_len =
+      ckb_host_script(wallet_lock, WALLET_CODE_HASH, 1, args, sizeof(args));
+  ckb_host_hash(wallet_lock, wallet_lock_len, wallet_lock_hash);
+}
+
+static void add_wallet(size_t source, uint128_t balance) {
+  CkbHostCell *cell = ckb_host_add_cell(source);
+  memcpy(cell->lock, wallet_lock, wallet_lock_len);
+  cell->lock_len = wallet_lock_len;
+  memcpy(cell->type, token_type, token_type_len);
+  cell->type_len = token_type_len;
+  memcpy(cell->data, &balance, sizeof(balance));
+  cell->data_len = sizeof(balance);
+}
+
+static size_t credit_script(uint8_t *script, uint128_t price) {
+  uint8_t args[CREDIT_ARGS_LENGTH];
+  memcpy(args, wallet_lock_hash, BLAKE2B_BLOCK_SIZE);
+  memcpy(&args[BLAKE2B_BLOCK_SIZE], &price, BALANCE_SIZE);
+  return ckb_host_script(script, CREDIT_CODE_HASH, 1, args, sizeof(args));
+}
+
+static void add_credit(size_t source, uint128_t price, uint64_t credits) {
+  CkbHostCell *cell = ckb_host_add_cell(source);
+  cell->type_len = credit_script(cell->type, price);
+  memcpy(cell->data, &credits, sizeof(credits));
+  cell->data_len = sizeof(credits);
+}
+
+// A reusable script's code cell, locked by the wallet so that using it is
+// charged by the wallet
+static void add_wallet_dep() {
+  uint8_t args[1] = {0};
+  CkbHostCell *cell = ckb_host_add_cell(CKB_SOURCE_CELL_DEP);
+  memcpy(cell->lock, wallet_lock, wallet_lock_len);
+  cell->lock_len = wallet_lock_len;
+  cell->type_len =
+      ckb_host_script(cell->type, SCRIPT_CODE_HASH, 1, args, sizeof(args));
+}
+
+// A top-up of one credit at 10 per credit, into a wallet holding 100 that
+// receives deposit
+static void setup_top_up(uint128_t deposit) {
+  ckb_host_reset();
+  ckb_host_tx.script_is_type = 1;
+  ckb_host_tx.script_len = credit_script(ckb_host_tx.script, 10);
+  add_wallet(CKB_SOURCE_INPUT, 100);
+  add_credit(CKB_SOURCE_INPUT, 10, 0);
+  add_wallet(CKB_SOURCE_OUTPUT, 100 + deposit);
+  add_credit(CKB_SOURCE_OUTPUT, 10, 1);
+}
+
+int main() {
+  setup_wallet();
+
+  setup_top_up(10);
+  ckb_host_expect("top up paid into the wallet", credit_type_main(),
+                  CKB_SUCCESS);
+
+  setup_top_up(9);
+  ckb_host_expect("top up underpaid", credit_type_main(),
+                  ERROR_CREDIT_NOT_PAID);
+
+  // The wallet charges 5 for the dep, the credit type 10 for the top-up, and
+  // a single deposit of 10 would satisfy both
+  setup_top_up(10);
+  add_wallet_dep();
+  ckb_host_expect("one deposit for a top up and a dep fee",
+                  credit_type_main(), ERROR_CREDIT_WALLET_DEPS);
+
+  setup_top_up(15);
+  add_wallet_dep();
+  ckb_host_expect("top up next to a dep fee, even if both are paid",
+                  credit_type_main(), ERROR_CREDIT_WALLET_DEPS);
+
+  // A second credit type at another price, topped up from the same deposit
+  setup_top_up(10);
+  add_credit(CKB_SOURCE_INPUT, 5, 0);
+  add_credit(CKB_SOURCE_OUTPUT, 5, 2);
+  ckb_host_expect("one deposit for two credit types", credit_type_main(),
+                  ERROR_CREDIT_TYPE_QUANTITY);
+
+  // Spending credits pays nothing into the wallet, so deps may be charged
+  ckb_host_reset();
+  ckb_host_tx.script_is_type = 1;
+  ckb_host_tx.script_len = credit_script(ckb_host_tx.script, 10);
+  add_credit(CKB_SOURCE_INPUT, 10, 3);
+  add_credit(CKB_SOURCE_OUTPUT, 10, 2);
+  add_wallet_dep();
+  ckb_host_expect("spending a credit next to a dep fee", credit_type_main(),
+                  CKB_SUCCESS);
+
+  return ckb_host_failures == 0 ? 0 : 1;
+}
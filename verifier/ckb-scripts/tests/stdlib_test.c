@@ -0,0 +1,184 @@
+// Host tests of the bump allocator in deps/ckb-c-stdlib/libc/stdlib.h.
+//
+// The allocator is renamed so the host's own malloc keeps serving stdio, and
+// tests/host/entry.h replaces the RISC-V _start of the vendored entry.h.
+#include "ckb_host.h"
+
+#define malloc ckb_test_malloc
+#define free ckb_test_free
+#define calloc ckb_test_calloc
+#define realloc ckb_test_realloc
+#include "libc/stdlib.h"
+#undef malloc
+#undef free
+#undef calloc
+#undef realloc
+
+static void expect_true(const char *name, int value) {
+  ckb_host_expect(name, value != 0, 1);
+}
+
+static void reset_heap() {
+  ckb_heap_top = 0;
+  ckb_heap_last = SIZE_MAX;
+}
+
+static int aligned(void *ptr) {
+  return ((uintptr_t)ptr % CKB_HEAP_ALIGN) == 0;
+}
+
+static void test_realloc() {
+  reset_heap();
+  uint8_t *a = ckb_test_malloc(10);
+  memset(a, 7, 10);
+  uint8_t *b = ckb_test_malloc(5);
+  expect_true("blocks are aligned", aligned(a) && aligned(b));
+  expect_true("blocks follow their headers",
+              b == a + 16 + CKB_HEAP_HEADER_SIZE);
+
+  uint8_t *grown = ckb_test_realloc(b, 100);
+  expect_true("realloc grows the last block in place", grown == b);
+  expect_true("in place growth moves the top",
+              ckb_heap_used() == 2 * CKB_HEAP_HEADER_SIZE + 16 + 112);
+
+  uint8_t *shrunk = ckb_test_realloc(b, 1);
+  expect_true("realloc shrinks the last block in place", shrunk == b);
+  expect_true("in place shrinking moves the top",
+              ckb_heap_used() == 2 * CKB_HEAP_HEADER_SIZE + 16 + 16);
+
+  size_t used = ckb_heap_used();
+  uint8_t *copied = ckb_test_realloc(a, 40);
+  expect_true("realloc of an earlier block copies",
+              copied != NULL && copied != a &&
+                  copied == ckb_heap + used + CKB_HEAP_HEADER_SIZE);
+  int same = 1;
+  for (int i = 0; i < 10; i++) {
+    same = same && copied[i] == 7;
+  }
+  expect_true("the copy keeps the old contents", same);
+
+  uint8_t *truncated = ckb_test_realloc(copied, 0);
+  expect_true("realloc to 0 bytes in place", truncated == copied);
+
+  expect_true("realloc of NULL allocates",
+              ckb_test_realloc(NULL, 8) != NULL);
+}
+
+static void test_free() {
+  reset_heap();
+  uint8_t *a = ckb_test_malloc(16);
+  uint8_t *b = ckb_test_malloc(16);
+  size_t used = ckb_heap_used();
+
+  ckb_test_free(a);
+  expect_true("free of an earlier block keeps the top",
+              ckb_heap_used() == used);
+  uint8_t *c = ckb_test_malloc(16);
+  expect_true("an earlier block is not reused", c != a && c != b);
+
+  ckb_test_free(c);
+  expect_true("free of the last block rolls the top back",
+              ckb_heap_used() == used);
+  ckb_test_free(b);
+  expect_true("only the last block rolls back",
+              ckb_heap_used() == used);
+  ckb_test_free(NULL);
+  expect_true("free of NULL", ckb_heap_used() == used);
+}
+
+static void test_reset() {
+  reset_heap();
+  ckb_test_malloc(16);
+  uint8_t *last = ckb_test_malloc(16);
+  size_t below = ckb_heap_used();
+
+  ckb_heap_mark_t mark = ckb_heap_mark();
+  ckb_test_malloc(100);
+  ckb_test_malloc(200);
+  ckb_heap_reset(mark);
+  expect_true("reset releases blocks after the mark",
+              ckb_heap_used() == below);
+  expect_true("reset restores the last block",
+              ckb_test_realloc(last, 32) == last);
+  ckb_test_realloc(last, 16);
+
+  // A free that drops below the mark, then a reset to that mark, must not
+  // hand the freed block's memory out twice
+  mark = ckb_heap_mark();
+  ckb_test_free(last);
+  size_t freed = ckb_heap_used();
+  expect_true("free drops the top below the mark", freed < mark.top);
+  ckb_heap_reset(mark);
+  expect_true("reset does not raise the top again",
+              ckb_heap_used() == freed);
+  uint8_t *reused = ckb_test_malloc(16);
+  expect_true("the freed block is reused once", reused == last);
+  uint8_t *next = ckb_test_malloc(16);
+  expect_true("the next block follows it",
+              next == reused + 16 + CKB_HEAP_HEADER_SIZE);
+
+  // A block reusing memory freed below the mark and reaching past it is
+  // only released down to the mark
+  reset_heap();
+  ckb_test_malloc(16);
+  last = ckb_test_malloc(16);
+  mark = ckb_heap_mark();
+  ckb_test_free(last);
+  ckb_test_malloc(100);
+  ckb_heap_reset(mark);
+  expect_true("reset across a freed block stops at the mark",
+              ckb_heap_used() == mark.top);
+  expect_true("blocks after that reset start at the mark",
+              ckb_test_malloc(16) == ckb_heap + mark.top + CKB_HEAP_HEADER_SIZE);
+}
+
+static void test_exhaustion() {
+  reset_heap();
+  expect_true("malloc of the whole heap fails",
+              ckb_test_malloc(CKB_HEAP_SIZE) == NULL);
+  expect_true("malloc of SIZE_MAX fails", ckb_test_malloc(SIZE_MAX) == NULL);
+
+  uint8_t *all = ckb_test_malloc(CKB_HEAP_SIZE - CKB_HEAP_HEADER_SIZE);
+  expect_true("malloc of the heap less a header", all != NULL);
+  expect_true("malloc of a full heap fails", ckb_test_malloc(0) == NULL);
+  expect_true("realloc past the heap fails",
+              ckb_test_realloc(all, CKB_HEAP_SIZE) == NULL);
+  ckb_test_free(all);
+  expect_true("free of the only block empties the heap",
+              ckb_heap_used() == 0);
+
+  ckb_test_malloc(16);
+  uint8_t *rest = ckb_test_malloc(CKB_HEAP_SIZE - 3 * CKB_HEAP_HEADER_SIZE);
+  expect_true("malloc up to the end of a used heap", rest != NULL);
+  expect_true("realloc copy fails on a full heap",
+              ckb_test_realloc(ckb_heap + CKB_HEAP_HEADER_SIZE, 32) == NULL);
+}
+
+static void test_calloc() {
+  reset_heap();
+  expect_true("calloc size overflow fails",
+              ckb_test_calloc(SIZE_MAX / 2, 4) == NULL);
+  expect_true("calloc size overflow past the heap fails",
+              ckb_test_calloc((SIZE_MAX >> 4) + 1, 16) == NULL);
+  expect_true("calloc overflow allocates nothing", ckb_heap_used() == 0);
+
+  uint8_t *dirty = ckb_test_malloc(64);
+  memset(dirty, 0xff, 64);
+  ckb_test_free(dirty);
+  uint32_t *zeroed = ckb_test_calloc(16, 4);
+  int zero = zeroed != NULL;
+  for (int i = 0; zero && i < 16; i++) {
+    zero = zeroed[i] == 0;
+  }
+  expect_true("calloc clears reused memory", zero);
+  expect_true("calloc of 0 members", ckb_test_calloc(0, 4) != NULL);
+}
+
+int main() {
+  test_realloc();
+  test_free();
+  test_reset();
+  test_exhaustion();
+  test_calloc();
+  return ckb_host_failures == 0 ? 0 : 1;
+}
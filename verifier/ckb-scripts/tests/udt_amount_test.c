@@ -0,0 +1,145 @@
+// Host tests of the amount accounting in c/udt_amount.h, in both widths the
+// token scripts use, see tests/ckb_host.h
+#include "ckb_host.h"
+#include "udt_amount.h"
+
+#define ERROR_TEST_LAYOUT -99
+
+typedef unsigned __int128 uint128_t;
+
+UDT_AMOUNT_DEFINE(amount64, uint64_t, 0, ERROR_TEST_LAYOUT)
+UDT_AMOUNT_DEFINE(amount128, uint128_t, 0, ERROR_TEST_LAYOUT)
+// An amount stored after an 8 byte prefix
+UDT_AMOUNT_DEFINE(offset64, uint64_t, 8, ERROR_TEST_LAYOUT)
+
+static void add_amount(const void *amount, size_t size) {
+  CkbHostCell *cell = ckb_host_add_cell(CKB_SOURCE_INPUT);
+  memcpy(cell->data, amount, size);
+  cell->data_len = size;
+}
+
+static void add_amount64(uint64_t amount) { add_amount(&amount, sizeof(amount)); }
+
+static void add_amount128(uint128_t amount) {
+  add_amount(&amount, sizeof(amount));
+}
+
+static void test_uint64() {
+  uint64_t total;
+
+  // Seven cells cover a full unrolled pass and a partial one
+  ckb_host_reset();
+  for (uint64_t i = 1; i <= 7; i++) {
+    add_amount64(i);
+  }
+  total = 0;
+  ckb_host_expect("uint64 sum", amount64_sum(CKB_SOURCE_INPUT, &total),
+                  CKB_SUCCESS);
+  ckb_host_expect("uint64 sum total", total == 28, 1);
+
+  ckb_host_reset();
+  total = 0;
+  ckb_host_expect("uint64 sum of no cells",
+                  amount64_sum(CKB_SOURCE_INPUT, &total), CKB_SUCCESS);
+
+  ckb_host_reset();
+  add_amount64(UINT64_MAX);
+  add_amount64(0);
+  total = 0;
+  ckb_host_expect("uint64 sum up to the maximum",
+                  amount64_sum(CKB_SOURCE_INPUT, &total), CKB_SUCCESS);
+  add_amount64(1);
+  total = 0;
+  ckb_host_expect("uint64 overflow", amount64_sum(CKB_SOURCE_INPUT, &total),
+                  ERROR_UDT_AMOUNT_OVERFLOW);
+  ckb_host_expect("uint64 overflow without a total",
+                  amount64_sum(CKB_SOURCE_INPUT, NULL), CKB_SUCCESS);
+
+  // Overflow in the last cell of an unrolled pass, then in a later pass
+  ckb_host_reset();
+  add_amount64(1);
+  add_amount64(1);
+  add_amount64(1);
+  add_amount64(UINT64_MAX - 2);
+  total = 0;
+  ckb_host_expect("uint64 overflow in the fourth cell",
+                  amount64_sum(CKB_SOURCE_INPUT, &total),
+                  ERROR_UDT_AMOUNT_OVERFLOW);
+  ckb_host_reset();
+  for (int i = 0; i < 5; i++) {
+    add_amount64(UINT64_MAX / 5);
+  }
+  add_amount64(UINT64_MAX % 5 + 1);
+  total = 0;
+  ckb_host_expect("uint64 overflow in the sixth cell",
+                  amount64_sum(CKB_SOURCE_INPUT, &total),
+                  ERROR_UDT_AMOUNT_OVERFLOW);
+
+  uint8_t short_data[4] = {0};
+  uint8_t long_data[12] = {0};
+  ckb_host_reset();
+  add_amount64(1);
+  add_amount(short_data, sizeof(short_data));
+  ckb_host_expect("uint64 short data", amount64_sum(CKB_SOURCE_INPUT, NULL),
+                  ERROR_TEST_LAYOUT);
+  ckb_host_reset();
+  add_amount64(1);
+  add_amount64(1);
+  add_amount(long_data, sizeof(long_data));
+  total = 0;
+  ckb_host_expect("uint64 long data", amount64_sum(CKB_SOURCE_INPUT, &total),
+                  ERROR_TEST_LAYOUT);
+
+  uint64_t prefixed[2] = {UINT64_MAX, 42};
+  ckb_host_reset();
+  add_amount(prefixed, sizeof(prefixed));
+  total = 0;
+  ckb_host_expect("uint64 amount at an offset",
+                  offset64_sum(CKB_SOURCE_INPUT, &total), CKB_SUCCESS);
+  ckb_host_expect("uint64 amount at an offset total", total == 42, 1);
+}
+
+static void test_uint128() {
+  const uint128_t max = ~(uint128_t)0;
+  uint128_t total;
+
+  ckb_host_reset();
+  for (int i = 1; i <= 5; i++) {
+    add_amount128((uint128_t)1 << 64);
+  }
+  total = 0;
+  ckb_host_expect("uint128 sum", amount128_sum(CKB_SOURCE_INPUT, &total),
+                  CKB_SUCCESS);
+  ckb_host_expect("uint128 sum total", total == (uint128_t)5 << 64, 1);
+
+  ckb_host_reset();
+  add_amount128(max - 1);
+  add_amount128(1);
+  total = 0;
+  ckb_host_expect("uint128 sum up to the maximum",
+                  amount128_sum(CKB_SOURCE_INPUT, &total), CKB_SUCCESS);
+  add_amount128(1);
+  total = 0;
+  ckb_host_expect("uint128 overflow", amount128_sum(CKB_SOURCE_INPUT, &total),
+                  ERROR_UDT_AMOUNT_OVERFLOW);
+
+  // A carry out of the low 64 bits is not an overflow
+  ckb_host_reset();
+  add_amount128(UINT64_MAX);
+  add_amount128(1);
+  total = 0;
+  ckb_host_expect("uint128 carry into the high half",
+                  amount128_sum(CKB_SOURCE_INPUT, &total), CKB_SUCCESS);
+  ckb_host_expect("uint128 carry total", total == (uint128_t)1 << 64, 1);
+
+  ckb_host_reset();
+  add_amount64(1);
+  ckb_host_expect("uint128 data of a uint64 amount",
+                  amount128_sum(CKB_SOURCE_INPUT, NULL), ERROR_TEST_LAYOUT);
+}
+
+int main() {
+  test_uint64();
+  test_uint128();
+  return ckb_host_failures == 0 ? 0 : 1;
+}